@@ -0,0 +1,60 @@
+///@file bench.hpp
+///@author Jackson Harmer
+///@brief Minimal timing helpers shared by the benchmarks (no external dependencies).
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_BENCH_HPP
+#define BETTER_CASTS_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+namespace casts
+{
+namespace bench
+{
+    /// Prevents the compiler from optimizing away the computation of @p val.
+    template<typename T>
+    inline void do_not_optimize(const T& val)
+    {
+#if defined(__GNUC__)
+        __asm__ volatile("" : : "g"(&val) : "memory");
+#else
+        static volatile const void* sink = nullptr;
+        sink = &val;
+        (void)sink;
+#endif
+    }
+
+    /// Runs @p func @p reps times and returns the best observed time per item, in nanoseconds.
+    template<typename Func>
+    auto best_ns_per_item(Func&& func, std::size_t items, int reps = 15) -> double
+    {
+        double best = (std::numeric_limits<double>::max)();
+
+        for (int rep = 0; rep < reps; ++rep)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = (std::min)(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+
+        return best / static_cast<double>(items == 0 ? 1 : items);
+    }
+
+    /// Prints a single result line.
+    inline void report(const char* group, const char* name, std::size_t items, double ns_per_item)
+    {
+        std::printf("%-24s %-40s %12zu items %10.3f ns/item %10.1f M items/s\n", group, name, items, ns_per_item,
+            1e3 / ns_per_item);
+    }
+} //namespace bench
+} //namespace casts
+
+#endif // BETTER_CASTS_BENCH_HPP
@@ -0,0 +1,125 @@
+// Cost of overflow-safe reductions: checked_int (checked once at the final cast) next to unchecked arithmetic and to a
+// narrow_cast after every operation.
+
+#include "bench.hpp"
+#include "better_casts/checked_int.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+template<typename Reduce>
+void run(const char* group, const char* name, const std::vector<std::int32_t>& input, Reduce reduce)
+{
+    std::int32_t result = 0;
+
+    const double ns = best_ns_per_item(
+        [&]
+        {
+            result = reduce(input);
+            do_not_optimize(result);
+        },
+        input.size());
+    report(group, name, input.size(), ns);
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t count = 1 << 16;
+
+    // Small enough that neither reduction overflows, so every version runs to the end
+    std::mt19937 rng{ 42 };
+    std::uniform_int_distribution<std::int32_t> dist{ -100, 100 };
+    std::vector<std::int32_t> values(count);
+
+    for (std::int32_t& val : values)
+    {
+        val = dist(rng);
+    }
+
+    using values_t = std::vector<std::int32_t>;
+
+    run("sum", "unchecked int32", values,
+        [](const values_t& input)
+        {
+            std::int32_t sum = 0;
+
+            for (const std::int32_t val : input)
+            {
+                sum += val;
+            }
+
+            return sum;
+        });
+    run("sum", "narrow_cast_checked per add", values,
+        [](const values_t& input)
+        {
+            std::int32_t sum = 0;
+
+            for (const std::int32_t val : input)
+            {
+                sum = casts::narrow_cast_checked<std::int32_t>(std::int64_t{ sum } + val);
+            }
+
+            return sum;
+        });
+    run("sum", "checked_int", values,
+        [](const values_t& input)
+        {
+            casts::checked_int<std::int32_t> sum;
+
+            for (const std::int32_t val : input)
+            {
+                sum += val;
+            }
+
+            return casts::narrow_cast_checked<std::int32_t>(sum);
+        });
+
+    run("dot product", "unchecked int32", values,
+        [](const values_t& input)
+        {
+            std::int32_t sum = 0;
+
+            for (std::size_t idx = 1; idx < input.size(); ++idx)
+            {
+                sum += input[idx] * input[idx - 1];
+            }
+
+            return sum;
+        });
+    run("dot product", "narrow_cast_checked per op", values,
+        [](const values_t& input)
+        {
+            std::int32_t sum = 0;
+
+            for (std::size_t idx = 1; idx < input.size(); ++idx)
+            {
+                const auto product =
+                    casts::narrow_cast_checked<std::int32_t>(std::int64_t{ input[idx] } * input[idx - 1]);
+                sum = casts::narrow_cast_checked<std::int32_t>(std::int64_t{ sum } + product);
+            }
+
+            return sum;
+        });
+    run("dot product", "checked_int", values,
+        [](const values_t& input)
+        {
+            casts::checked_int<std::int32_t> sum;
+
+            for (std::size_t idx = 1; idx < input.size(); ++idx)
+            {
+                sum += casts::checked_int<std::int32_t>{ input[idx] } * input[idx - 1];
+            }
+
+            return casts::narrow_cast_checked<std::int32_t>(sum);
+        });
+}
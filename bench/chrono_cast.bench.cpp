@@ -0,0 +1,111 @@
+#include "bench.hpp"
+#include "better_casts/chrono_cast.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+using ms32 = std::chrono::duration<std::int32_t, std::milli>;
+
+void run(const char* shape, std::size_t count)
+{
+    std::mt19937_64 rng{ 42 };
+    std::uniform_int_distribution<std::int64_t> dist{ -2'000'000'000'000'000LL, 2'000'000'000'000'000LL };
+    std::vector<std::chrono::nanoseconds> input(count);
+    std::vector<ms32> output(count);
+
+    for (auto& val : input)
+    {
+        val = std::chrono::nanoseconds{ dist(rng) };
+    }
+
+    // Baseline: std::chrono::duration_cast, which truncates and silently wraps on overflow
+    const double std_cast = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output[i] = std::chrono::duration_cast<ms32>(input[i]);
+            }
+
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "std::chrono::duration_cast", count, std_cast);
+
+#ifdef __SIZEOF_INT128__
+    // What a hand-written checked conversion typically looks like: an exact 128-bit multiply per element
+    const double wide_checked = best_ns_per_item(
+        [&]
+        {
+            bool valid = true;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const auto scaled = static_cast<casts::detail::int128_t>(input[i].count()) / 1'000'000;
+                valid = valid && scaled >= INT32_MIN && scaled <= INT32_MAX;
+                output[i] = ms32{ static_cast<std::int32_t>(scaled) };
+            }
+
+            do_not_optimize(valid);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "128-bit checked loop", count, wide_checked);
+#endif
+
+    const double scalar_checked = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output[i] = casts::duration_narrow_cast_checked<ms32>(input[i]);
+            }
+
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "duration_narrow_cast_checked loop", count, scalar_checked);
+
+    const double batch_unchecked = best_ns_per_item(
+        [&]
+        {
+            casts::duration_narrow_cast_batch_unchecked(input.data(), count, output.data());
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "duration_narrow_cast_batch_unchecked", count, batch_unchecked);
+
+    const double batch_checked = best_ns_per_item(
+        [&]
+        {
+            casts::duration_narrow_cast_batch_checked(input.data(), count, output.data());
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "duration_narrow_cast_batch_checked", count, batch_checked);
+
+    const double batch_round = best_ns_per_item(
+        [&]
+        {
+            casts::duration_narrow_cast_batch_checked(input.data(), count, output.data(), casts::float_cast_op::round);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "batch_checked (round)", count, batch_round);
+}
+} // namespace
+
+int main()
+{
+    run("column 4096", 4096);
+    run("column 1M", 1 << 20);
+}
@@ -0,0 +1,76 @@
+# Prints the code each cast adds per call site, from the symbol sizes of the code_size.cpp object.
+#
+# Usage: cmake -DNM=<nm> -DOBJECT=<code_size object> -P code_size.cmake
+#
+# Hot bytes are the call site itself; cold bytes are the parts the compiler split off into .text.unlikely
+# (`*.cold` symbols). Out-of-line helpers shared by every site (ex. the throw helpers) are not counted.
+
+execute_process(
+        COMMAND ${NM} -S ${OBJECT}
+        OUTPUT_VARIABLE symbols
+        RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${OBJECT}")
+endif ()
+
+set(variants
+        narrow_unchecked
+        narrow_checked
+        narrow_inline_throw
+        float_unchecked
+        float_checked
+        float_inline_throw
+)
+
+foreach (variant IN LISTS variants)
+    set(${variant}_sites 0)
+    set(${variant}_hot 0)
+    set(${variant}_cold 0)
+endforeach ()
+
+string(REPLACE "\n" ";" lines "${symbols}")
+
+foreach (line IN LISTS lines)
+    # ex. 0000000000000000 0000000000000120 W _ZN9code_size13float_checkedILi0EE4callEd
+    if (line MATCHES "^[0-9a-f]+ ([0-9a-f]+) [tTwW] _ZN9code_size[0-9]+([a-z_]+)ILi[0-9]+EE4call[A-Za-z]+(\\.cold)?$")
+        set(variant ${CMAKE_MATCH_2})
+        math(EXPR bytes "0x${CMAKE_MATCH_1}")
+
+        if (CMAKE_MATCH_3)
+            math(EXPR ${variant}_cold "${${variant}_cold} + ${bytes}")
+        else ()
+            math(EXPR ${variant}_sites "${${variant}_sites} + 1")
+            math(EXPR ${variant}_hot "${${variant}_hot} + ${bytes}")
+        endif ()
+    endif ()
+endforeach ()
+
+message("Code added per call site (x86-64 bytes, averaged over the sites of each variant)")
+message("")
+message("  variant                  sites     hot    cold")
+
+foreach (variant IN LISTS variants)
+    if (${variant}_sites EQUAL 0)
+        message(FATAL_ERROR "No call sites found for ${variant}")
+    endif ()
+
+    math(EXPR hot "${${variant}_hot} / ${${variant}_sites}")
+    math(EXPR cold "${${variant}_cold} / ${${variant}_sites}")
+
+    string(LENGTH "${variant}" length)
+    math(EXPR padding "24 - ${length}")
+    string(REPEAT " " ${padding} spaces)
+    string(LENGTH "${hot}" hot_length)
+    math(EXPR hot_padding "8 - ${hot_length}")
+    string(REPEAT " " ${hot_padding} hot_spaces)
+    string(LENGTH "${cold}" cold_length)
+    math(EXPR cold_padding "8 - ${cold_length}")
+    string(REPEAT " " ${cold_padding} cold_spaces)
+
+    message("  ${variant}${spaces} ${${variant}_sites}${hot_spaces}${hot}${cold_spaces}${cold}")
+endforeach ()
+
+message("")
+message("`*_inline_throw` is a checked cast with the throw expressions at the call site (before the throw helpers).")
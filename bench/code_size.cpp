@@ -0,0 +1,124 @@
+// Call sites measured by the code_size_report target (bench/code_size.cmake reads their symbol sizes).
+//
+// Each site is a distinct function calling one cast, so the size of a site is the code a cast adds where it is used.
+// The `*_inline_throw` sites are the checked casts as they were written before the failure paths were moved out of
+// line (a `throw` expression in each check), kept as the reference the report compares against.
+
+#include "better_casts.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace code_size
+{
+constexpr std::size_t sites = 64;
+
+using narrow_fn = std::int32_t (*)(std::int64_t);
+using float_fn = std::int32_t (*)(double);
+
+template<int N>
+struct narrow_unchecked
+{
+    static auto call(std::int64_t val) -> std::int32_t { return casts::narrow_cast_unchecked<std::int32_t>(val + N); }
+};
+
+template<int N>
+struct narrow_checked
+{
+    static auto call(std::int64_t val) -> std::int32_t { return casts::narrow_cast_checked<std::int32_t>(val + N); }
+};
+
+template<int N>
+struct narrow_inline_throw
+{
+    static auto call(std::int64_t val) -> std::int32_t
+    {
+        const std::int64_t from_val = val + N;
+
+        if (from_val > std::int64_t{ (std::numeric_limits<std::int32_t>::max)() })
+        {
+            throw casts::narrow_cast_error("narrow_cast failed: input exceeded max value for output type");
+        }
+
+        if (from_val < std::int64_t{ (std::numeric_limits<std::int32_t>::min)() })
+        {
+            throw casts::narrow_cast_error("narrow_cast failed: input exceeded min value for output type");
+        }
+
+        return static_cast<std::int32_t>(from_val);
+    }
+};
+
+template<int N>
+struct float_unchecked
+{
+    static auto call(double val) -> std::int32_t
+    {
+        return casts::float_cast_unchecked<std::int32_t>(val + N, casts::float_cast_op::truncate);
+    }
+};
+
+template<int N>
+struct float_checked
+{
+    static auto call(double val) -> std::int32_t
+    {
+        return casts::float_cast_checked<std::int32_t>(val + N, casts::float_cast_op::truncate);
+    }
+};
+
+template<int N>
+struct float_inline_throw
+{
+    static auto call(double val) -> std::int32_t
+    {
+        const double from_val = val + N;
+
+        if (casts::detail::math::is_nan(from_val))
+        {
+            throw casts::float_cast_error("float_cast failed: cannot cast from NaN");
+        }
+
+        if (casts::detail::math::is_inf(from_val))
+        {
+            throw casts::float_cast_error("float_cast failed: cannot cast from Infinity");
+        }
+
+        if (!(from_val < 2147483648.0))
+        {
+            throw casts::float_cast_error("float_cast (truncate) failed: input exceeded max value for output type");
+        }
+
+        if (!(from_val - -2147483648.0 > -1.0))
+        {
+            throw casts::float_cast_error("float_cast (truncate) failed: input exceeded min value for output type");
+        }
+
+        return static_cast<std::int32_t>(from_val);
+    }
+};
+
+template<template<int> class Site, typename Fn, typename Indices>
+struct table;
+
+template<template<int> class Site, typename Fn, std::size_t... N>
+struct table<Site, Fn, std::index_sequence<N...>>
+{
+    static constexpr Fn entries[] = { &Site<static_cast<int>(N)>::call... };
+};
+
+template<template<int> class Site, typename Fn, std::size_t... N>
+constexpr Fn table<Site, Fn, std::index_sequence<N...>>::entries[];
+
+using indices = std::make_index_sequence<sites>;
+
+// Referenced from exported constants so that no site is discarded
+extern const narrow_fn* const narrow_unchecked_sites = table<narrow_unchecked, narrow_fn, indices>::entries;
+extern const narrow_fn* const narrow_checked_sites = table<narrow_checked, narrow_fn, indices>::entries;
+extern const narrow_fn* const narrow_inline_throw_sites = table<narrow_inline_throw, narrow_fn, indices>::entries;
+extern const float_fn* const float_unchecked_sites = table<float_unchecked, float_fn, indices>::entries;
+extern const float_fn* const float_checked_sites = table<float_checked, float_fn, indices>::entries;
+extern const float_fn* const float_inline_throw_sites = table<float_inline_throw, float_fn, indices>::entries;
+} // namespace code_size
@@ -0,0 +1,73 @@
+// Cost of the scalar casts in unoptimized (-O0) builds, where nothing is inlined unless it is forced.
+// bench/CMakeLists.txt compiles this benchmark with optimizations disabled whatever the build type.
+
+#include "bench.hpp"
+#include "better_casts.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+constexpr std::size_t count = 1 << 20;
+
+template<typename To, typename From, typename Cast>
+void run(const char* name, const std::vector<From>& input, Cast cast)
+{
+    std::vector<To> output(input.size());
+    // Raw pointers, as std::vector::operator[] is itself a call at -O0
+    const From* in = input.data();
+    To* out = output.data();
+
+    const double ns = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = cast(in[i]);
+            }
+
+            do_not_optimize(output);
+        },
+        input.size());
+    report("-O0, 1M values", name, input.size(), ns);
+}
+} // namespace
+
+int main()
+{
+    std::vector<std::int64_t> ints(count);
+    std::vector<double> doubles(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ints[i] = static_cast<std::int64_t>(i % 60000) - 30000;
+        doubles[i] = static_cast<double>(ints[i]) + 0.25;
+    }
+
+    // Baseline: the loop and the lambda call that every row below also pays
+    run<std::int32_t>("static_cast", ints, [](std::int64_t val) { return static_cast<std::int32_t>(val); });
+
+    run<std::int32_t>("narrow_cast_unchecked", ints,
+        [](std::int64_t val) { return casts::narrow_cast_unchecked<std::int32_t>(val); });
+    run<std::int32_t>(
+        "narrow_cast_checked", ints, [](std::int64_t val) { return casts::narrow_cast_checked<std::int32_t>(val); });
+    run<std::uint64_t>("sign_cast_checked", ints,
+        [](std::int64_t val) { return casts::sign_cast_checked<std::uint64_t>(val + 30000); });
+    run<std::int32_t>(
+        "float_cast_unchecked", doubles, [](double val) { return casts::float_cast_unchecked<std::int32_t>(val); });
+    run<std::int32_t>(
+        "float_cast_checked", doubles, [](double val) { return casts::float_cast_checked<std::int32_t>(val); });
+    run<std::int32_t>("float_cast_checked (round)", doubles,
+        [](double val) { return casts::float_cast_checked<std::int32_t>(val, casts::float_cast_op::round); });
+    run<std::int32_t>("float_cast_checked (floor)", doubles,
+        [](double val) { return casts::float_cast_checked<std::int32_t>(val, casts::float_cast_op::floor); });
+    // The generic casts add one more dispatch layer
+    run<std::int32_t>("narrow_cast", ints, [](std::int64_t val) { return casts::narrow_cast<std::int32_t>(val); });
+    run<std::int32_t>("float_cast", doubles, [](double val) { return casts::float_cast<std::int32_t>(val); });
+}
@@ -0,0 +1,202 @@
+#include "bench.hpp"
+#include "better_casts.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+constexpr std::size_t object_count = 4096;
+constexpr int depth = 8;
+
+struct plain_root
+{
+    plain_root() = default;
+    plain_root(const plain_root&) = default;
+    plain_root(plain_root&&) = default;
+    auto operator=(const plain_root&) -> plain_root& = default;
+    auto operator=(plain_root&&) -> plain_root& = default;
+    virtual ~plain_root() = default;
+
+    int payload = 1;
+};
+
+struct tagged_root
+{
+    tagged_root() = default;
+    tagged_root(const tagged_root&) = default;
+    tagged_root(tagged_root&&) = default;
+    auto operator=(const tagged_root&) -> tagged_root& = default;
+    auto operator=(tagged_root&&) -> tagged_root& = default;
+    virtual ~tagged_root() = default;
+
+    virtual auto dynamic_type_tag() const noexcept -> const casts::type_tag&
+    {
+        return casts::type_tag_of<tagged_root>();
+    }
+
+    int payload = 1;
+};
+
+// Deep: plain_root <- level<0> <- ... <- level<depth>
+template<int N>
+struct plain_level : plain_level<N - 1>
+{
+};
+
+template<>
+struct plain_level<0> : plain_root
+{
+};
+
+template<int N>
+struct tagged_level : tagged_level<N - 1>
+{
+    using down_cast_parent = tagged_level<N - 1>;
+
+    auto dynamic_type_tag() const noexcept -> const casts::type_tag& override
+    {
+        return casts::type_tag_of<tagged_level>();
+    }
+};
+
+template<>
+struct tagged_level<0> : tagged_root
+{
+    using down_cast_parent = tagged_root;
+
+    auto dynamic_type_tag() const noexcept -> const casts::type_tag& override
+    {
+        return casts::type_tag_of<tagged_level>();
+    }
+};
+
+// Wide: root <- message <- leaf<0..15>
+struct plain_message : plain_root
+{
+};
+
+struct tagged_message : tagged_root
+{
+    using down_cast_parent = tagged_root;
+
+    auto dynamic_type_tag() const noexcept -> const casts::type_tag& override
+    {
+        return casts::type_tag_of<tagged_message>();
+    }
+};
+
+template<int I>
+struct plain_leaf final : plain_message
+{
+};
+
+template<int I>
+struct tagged_leaf final : tagged_message
+{
+    using down_cast_parent = tagged_message;
+
+    auto dynamic_type_tag() const noexcept -> const casts::type_tag& override
+    {
+        return casts::type_tag_of<tagged_leaf>();
+    }
+};
+
+template<typename Root, template<int> class Leaf, int... Is>
+auto make_wide(std::integer_sequence<int, Is...> /*leaves*/) -> std::vector<std::unique_ptr<Root>>
+{
+    using factory = std::unique_ptr<Root> (*)();
+    const factory factories[] = { +[]() -> std::unique_ptr<Root> { return std::make_unique<Leaf<Is>>(); }... };
+
+    std::mt19937 rng{ 42 };
+    std::uniform_int_distribution<std::size_t> dist{ 0, sizeof...(Is) - 1 };
+    std::vector<std::unique_ptr<Root>> objects;
+    for (std::size_t i = 0; i < object_count; ++i)
+    {
+        objects.push_back(factories[dist(rng)]());
+    }
+
+    return objects;
+}
+
+template<typename Root>
+auto pointers(const std::vector<std::unique_ptr<Root>>& objects) -> std::vector<Root*>
+{
+    std::vector<Root*> ptrs;
+    for (const auto& obj : objects)
+    {
+        ptrs.push_back(obj.get());
+    }
+
+    return ptrs;
+}
+
+template<typename Target, typename Root, typename Cast>
+void run_one(const char* group, const char* name, const std::vector<Root*>& ptrs, Cast cast)
+{
+    const double result = best_ns_per_item(
+        [&]
+        {
+            int sum = 0;
+            for (Root* ptr : ptrs)
+            {
+                const Target* const casted = cast(ptr);
+                sum += casted != nullptr ? casted->payload : 0;
+            }
+
+            do_not_optimize(sum);
+        },
+        ptrs.size());
+    report(group, name, ptrs.size(), result);
+}
+
+template<typename Target, typename Root>
+void run_rtti(const char* group, const std::vector<Root*>& ptrs)
+{
+    run_one<Target>(group, "dynamic_cast", ptrs, [](Root* ptr) { return dynamic_cast<Target*>(ptr); });
+    run_one<Target>(group, "down_cast_checked (rtti cache)", ptrs,
+        [](Root* ptr) { return casts::down_cast_checked<Target*>(ptr); });
+    run_one<Target>(group, "down_cast_unchecked", ptrs,
+        [](Root* ptr) { return casts::down_cast_unchecked<Target*>(ptr); });
+}
+
+template<typename Target, typename Root>
+void run_tagged(const char* group, const std::vector<Root*>& ptrs)
+{
+    run_one<Target>(group, "down_cast_checked (type tags)", ptrs,
+        [](Root* ptr) { return casts::down_cast_checked<Target*>(ptr); });
+}
+} // namespace
+
+int main()
+{
+    {
+        std::vector<std::unique_ptr<plain_root>> objects;
+        std::vector<std::unique_ptr<tagged_root>> tagged_objects;
+        for (std::size_t i = 0; i < object_count; ++i)
+        {
+            objects.push_back(std::make_unique<plain_level<depth>>());
+            tagged_objects.push_back(std::make_unique<tagged_level<depth>>());
+        }
+
+        run_rtti<plain_level<1>>("deep (to level 1)", pointers(objects));
+        run_tagged<tagged_level<1>>("deep (to level 1)", pointers(tagged_objects));
+        run_rtti<plain_level<depth - 1>>("deep (to level 7)", pointers(objects));
+        run_tagged<tagged_level<depth - 1>>("deep (to level 7)", pointers(tagged_objects));
+    }
+
+    {
+        const auto objects = make_wide<plain_root, plain_leaf>(std::make_integer_sequence<int, 16>{});
+        const auto tagged_objects = make_wide<tagged_root, tagged_leaf>(std::make_integer_sequence<int, 16>{});
+
+        run_rtti<plain_message>("wide (16 leaves)", pointers(objects));
+        run_tagged<tagged_message>("wide (16 leaves)", pointers(tagged_objects));
+    }
+}
@@ -0,0 +1,148 @@
+// Throughput of the float_cast rounding operations, next to the rounding core they replaced (kept below as the
+// reference) and to the <cmath> functions followed by a cast.
+
+#include "bench.hpp"
+#include "better_casts.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+/// The previous rounding core: a truncation through std::uintmax_t, then float compares to pick the neighbour.
+namespace previous
+{
+    template<typename T>
+    auto abs(T val) -> T
+    {
+        return val < 0 ? -val : val;
+    }
+
+    template<typename T>
+    auto trunc(T val) -> T
+    {
+        constexpr T integral_limit = casts::detail::math::pow2<T>(std::numeric_limits<T>::digits);
+
+        if (!(abs(val) < integral_limit))
+        {
+            return val;
+        }
+
+        const auto magnitude = static_cast<T>(static_cast<std::uintmax_t>(abs(val)));
+        return val < T{ 0 } ? -magnitude : magnitude;
+    }
+
+    template<typename To, typename From>
+    auto round(From val) -> To
+    {
+        if (val >= From{ 0 })
+        {
+            return abs(trunc(val) - val) >= abs(trunc(val) - val + From{ 1 })
+                ? static_cast<To>(static_cast<To>(val) + 1)
+                : static_cast<To>(val);
+        }
+
+        return abs(trunc(val) - val) >= abs(trunc(val) - val - From{ 1 }) ? static_cast<To>(static_cast<To>(val) - 1)
+                                                                          : static_cast<To>(val);
+    }
+
+    template<typename To, typename From>
+    auto floor(From val) -> To
+    {
+        if (!(trunc(val) < val) && !(trunc(val) > val))
+        {
+            return static_cast<To>(val);
+        }
+
+        return val < From{ 0 } ? static_cast<To>(static_cast<To>(val) - 1) : static_cast<To>(val);
+    }
+
+    template<typename To, typename From>
+    auto ceiling(From val) -> To
+    {
+        if (!(trunc(val) < val) && !(trunc(val) > val))
+        {
+            return static_cast<To>(val);
+        }
+
+        return val < From{ 0 } ? static_cast<To>(val) : static_cast<To>(static_cast<To>(val) + 1);
+    }
+} // namespace previous
+
+template<typename To, typename From, typename Cast>
+void run(const char* group, const char* name, const std::vector<From>& input, Cast cast)
+{
+    std::vector<To> output(input.size());
+
+    const double ns = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                output[idx] = cast(input[idx]);
+            }
+
+            do_not_optimize(output);
+        },
+        input.size());
+    report(group, name, input.size(), ns);
+}
+
+/// Runs every operation with each implementation on @p input.
+template<typename To, typename From>
+void run_all(const char* group, const std::vector<From>& input)
+{
+    using casts::float_cast_unchecked;
+    namespace op = casts::float_cast_op;
+
+    run<To>(group, "truncate", input, [](From val) { return float_cast_unchecked<To>(val, op::truncate); });
+
+    run<To>(group, "floor", input, [](From val) { return float_cast_unchecked<To>(val, op::floor); });
+    run<To>(group, "floor (previous)", input, [](From val) { return previous::floor<To>(val); });
+    run<To>(group, "floor (std::floor)", input, [](From val) { return static_cast<To>(std::floor(val)); });
+
+    run<To>(group, "ceiling", input, [](From val) { return float_cast_unchecked<To>(val, op::ceiling); });
+    run<To>(group, "ceiling (previous)", input, [](From val) { return previous::ceiling<To>(val); });
+    run<To>(group, "ceiling (std::ceil)", input, [](From val) { return static_cast<To>(std::ceil(val)); });
+
+    run<To>(group, "round", input, [](From val) { return float_cast_unchecked<To>(val, op::round); });
+    run<To>(group, "round (previous)", input, [](From val) { return previous::round<To>(val); });
+    run<To>(group, "round (std::round)", input, [](From val) { return static_cast<To>(std::round(val)); });
+
+    run<To>(group, "round_even", input, [](From val) { return float_cast_unchecked<To>(val, op::round_even); });
+    run<To>(group, "round_even (std::nearbyint)", input,
+        [](From val) { return static_cast<To>(std::nearbyint(val)); });
+
+    run<To>(group, "round_half_down", input,
+        [](From val) { return float_cast_unchecked<To>(val, op::round_half_down); });
+    run<To>(group, "stochastic", input, [](From val) { return float_cast_unchecked<To>(val, op::stochastic); });
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t count = 1 << 16;
+
+    // Signs and fractions are random, so neither the rounding direction nor a branch on it can be predicted
+    std::mt19937_64 rng{ 42 };
+    std::uniform_real_distribution<double> dist{ -1e9, 1e9 };
+    std::vector<double> doubles(count);
+    std::vector<float> floats(count);
+
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+        doubles[idx] = dist(rng);
+        floats[idx] = static_cast<float>(doubles[idx] / 1024.0);
+    }
+
+    run_all<std::int32_t>("float -> int32", floats);
+    run_all<std::int64_t>("double -> int64", doubles);
+}
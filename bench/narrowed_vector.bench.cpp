@@ -0,0 +1,147 @@
+// Memory and scan speed of a column of small int64 values held in a narrowed_vector and in a std::vector<int64_t>.
+
+#include "bench.hpp"
+#include "better_casts/narrowed_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+/// Sums @p size stored elements, in 32-bit partial sums for the 8 and 16-bit widths (a block of 65536 of them cannot
+/// overflow), so that each vector lane only widens once per block.
+template<typename Lane>
+auto sum_lanes(const Lane* data, std::size_t size) -> std::int64_t
+{
+    using partial_t = std::conditional_t<(sizeof(Lane) < sizeof(std::int32_t)), std::int32_t, std::int64_t>;
+    constexpr std::size_t block = 65536;
+
+    std::int64_t sum = 0;
+
+    for (std::size_t first = 0; first < size; first += block)
+    {
+        const std::size_t last = size - first < block ? size : first + block;
+        partial_t partial = 0;
+
+        for (std::size_t idx = first; idx < last; ++idx)
+        {
+            partial += data[idx];
+        }
+
+        sum += partial;
+    }
+
+    return sum;
+}
+
+template<typename Func>
+void run(const char* group, const char* name, std::size_t items, Func func)
+{
+    report(group, name, items, best_ns_per_item(func, items));
+}
+
+void run_column(const char* group, std::int64_t max_value)
+{
+    // Large enough that the std::vector does not fit in the caches
+    constexpr std::size_t count = std::size_t{ 1 } << 23;
+
+    std::mt19937_64 rng{ 42 };
+    std::uniform_int_distribution<std::int64_t> dist{ -max_value, max_value };
+    std::vector<std::int64_t> column(count);
+
+    for (std::int64_t& val : column)
+    {
+        val = dist(rng);
+    }
+
+    std::uniform_int_distribution<std::size_t> pick{ 0, count - 1 };
+    std::vector<std::size_t> indices(std::size_t{ 1 } << 16);
+
+    for (std::size_t& idx : indices)
+    {
+        idx = pick(rng);
+    }
+
+    const casts::narrowed_vector<std::int64_t> narrowed{ column.data(), column.size() };
+
+    std::printf("%-24s std::vector %zu bytes, narrowed_vector %zu bytes (%zu-byte elements)\n", group,
+        column.size() * sizeof(std::int64_t), narrowed.storage_bytes(), narrowed.width());
+
+    run(group, "append std::vector", count,
+        [&]
+        {
+            std::vector<std::int64_t> copy;
+            copy.insert(copy.end(), column.begin(), column.end());
+            do_not_optimize(copy.data());
+        });
+    run(group, "append narrowed_vector", count,
+        [&]
+        {
+            casts::narrowed_vector<std::int64_t> copy;
+            copy.append(column.data(), column.size());
+            do_not_optimize(copy);
+        });
+
+    run(group, "sum std::vector", count,
+        [&]
+        {
+            std::int64_t sum = 0;
+
+            for (const std::int64_t val : column)
+            {
+                sum += val;
+            }
+
+            do_not_optimize(sum);
+        });
+    run(group, "sum narrowed_vector visit", count,
+        [&]
+        {
+            std::int64_t sum = 0;
+
+            narrowed.visit([&](const auto* data, std::size_t size) { sum = sum_lanes(data, size); });
+
+            do_not_optimize(sum);
+        });
+
+    run(group, "random access std::vector", indices.size(),
+        [&]
+        {
+            std::int64_t sum = 0;
+
+            for (const std::size_t idx : indices)
+            {
+                sum += column[idx];
+            }
+
+            do_not_optimize(sum);
+        });
+    run(group, "random access narrowed_vector", indices.size(),
+        [&]
+        {
+            std::int64_t sum = 0;
+
+            for (const std::size_t idx : indices)
+            {
+                sum += narrowed[idx];
+            }
+
+            do_not_optimize(sum);
+        });
+}
+} // namespace
+
+int main()
+{
+    run_column("int64 in 8 bits", 100);
+    run_column("int64 in 16 bits", 30000);
+    run_column("int64 in 32 bits", 2000000000);
+}
@@ -0,0 +1,92 @@
+// Throughput of the normalized integer casts on RGBA images, next to the float_cast loop callers write without them.
+
+#include "bench.hpp"
+#include "better_casts/norm_cast.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+template<typename To, typename From, typename Cast>
+void run(const char* group, const char* name, const std::vector<From>& input, Cast cast)
+{
+    std::vector<To> output(input.size());
+
+    const double ns = best_ns_per_item(
+        [&]
+        {
+            cast(input.data(), input.size(), output.data());
+            do_not_optimize(output);
+        },
+        input.size());
+    report(group, name, input.size(), ns);
+}
+} // namespace
+
+int main()
+{
+    // A 1024x1024 RGBA image, a little outside of [0, 1] so some channels clamp
+    constexpr std::size_t count = 1024 * 1024 * 4;
+
+    std::mt19937 rng{ 42 };
+    std::uniform_real_distribution<float> dist{ -0.05F, 1.05F };
+    std::vector<float> pixels(count);
+    std::generate(pixels.begin(), pixels.end(), [&] { return dist(rng); });
+
+    // Baseline: clamp, scale and round each channel with a checked float_cast
+    run<std::uint8_t>("float -> unorm8", "scalar float_cast loop", pixels,
+        [](const float* in, std::size_t size, std::uint8_t* out)
+        {
+            for (std::size_t idx = 0; idx < size; ++idx)
+            {
+                const float clamped = (std::min)((std::max)(in[idx], 0.0F), 1.0F);
+                out[idx] = casts::float_cast_checked<std::uint8_t>(clamped * 255.0F, casts::float_cast_op::round);
+            }
+        });
+    run<std::uint8_t>("float -> unorm8", "scalar unorm_cast loop", pixels,
+        [](const float* in, std::size_t size, std::uint8_t* out)
+        {
+            for (std::size_t idx = 0; idx < size; ++idx)
+            {
+                out[idx] = casts::unorm_cast_checked<std::uint8_t>(in[idx]);
+            }
+        });
+    run<std::uint8_t>("float -> unorm8", "unorm_cast_batch_checked", pixels,
+        [](const float* in, std::size_t size, std::uint8_t* out) { casts::unorm_cast_batch_checked(in, size, out); });
+    run<std::uint16_t>("float -> unorm16", "unorm_cast_batch_checked", pixels,
+        [](const float* in, std::size_t size, std::uint16_t* out) { casts::unorm_cast_batch_checked(in, size, out); });
+    run<std::int8_t>("float -> snorm8", "snorm_cast_batch_checked", pixels,
+        [](const float* in, std::size_t size, std::int8_t* out) { casts::snorm_cast_batch_checked(in, size, out); });
+
+    std::vector<std::uint8_t> bytes(count);
+    casts::unorm_cast_batch_unchecked(pixels.data(), count, bytes.data());
+
+    run<float>("unorm8 -> float", "scalar division loop", bytes,
+        [](const std::uint8_t* in, std::size_t size, float* out)
+        {
+            for (std::size_t idx = 0; idx < size; ++idx)
+            {
+                out[idx] = static_cast<float>(in[idx]) / 255.0F;
+            }
+        });
+    run<float>("unorm8 -> float", "scalar unorm_cast loop (table)", bytes,
+        [](const std::uint8_t* in, std::size_t size, float* out)
+        {
+            for (std::size_t idx = 0; idx < size; ++idx)
+            {
+                out[idx] = casts::unorm_cast<float>(in[idx]);
+            }
+        });
+    run<float>("unorm8 -> float", "unorm_cast_batch", bytes,
+        [](const std::uint8_t* in, std::size_t size, float* out) { casts::unorm_cast_batch(in, size, out); });
+    run<double>("unorm8 -> double", "unorm_cast_batch (table)", bytes,
+        [](const std::uint8_t* in, std::size_t size, double* out) { casts::unorm_cast_batch(in, size, out); });
+}
@@ -0,0 +1,98 @@
+#include "bench.hpp"
+#include "better_casts/nullable_cast.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+void run(const char* shape, std::size_t count, double null_rate)
+{
+    std::mt19937_64 rng{ 42 };
+    std::uniform_real_distribution<double> dist{ -1e9, 1e9 };
+    std::bernoulli_distribution is_null{ null_rate };
+    std::vector<std::int64_t> ints(count);
+    std::vector<double> doubles(count);
+    std::vector<std::int32_t> output(count);
+    std::vector<std::uint8_t> validity(casts::validity_bitmap_size(count));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        doubles[i] = is_null(rng) ? std::numeric_limits<double>::quiet_NaN() : dist(rng);
+        ints[i] = is_null(rng) ? std::int64_t{ 1 } << 40U : static_cast<std::int64_t>(dist(rng));
+    }
+
+    // Baseline: the bandwidth floor of writing the output column
+    const double copy = best_ns_per_item(
+        [&]
+        {
+            std::memcpy(output.data(), ints.data(), count * sizeof(std::int32_t));
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "memcpy (output bytes)", count, copy);
+
+    // What callers write today to turn failures into nulls
+    const double scalar = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const bool valid = ints[i] >= (std::numeric_limits<std::int32_t>::min)()
+                    && ints[i] <= (std::numeric_limits<std::int32_t>::max)();
+                output[i] = valid ? static_cast<std::int32_t>(ints[i]) : 0;
+
+                if (valid)
+                {
+                    validity[i / 8] = static_cast<std::uint8_t>(validity[i / 8] | (1U << (i % 8)));
+                }
+                else
+                {
+                    validity[i / 8] = static_cast<std::uint8_t>(validity[i / 8] & ~(1U << (i % 8)));
+                }
+            }
+
+            do_not_optimize(validity);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "scalar int64 -> int32 + bits", count, scalar);
+
+    const double narrow = best_ns_per_item(
+        [&]
+        {
+            const std::size_t nulls =
+                casts::narrow_cast_batch_nullable(ints.data(), count, output.data(), validity.data());
+            do_not_optimize(nulls);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "narrow_cast_batch_nullable", count, narrow);
+
+    const double rounded = best_ns_per_item(
+        [&]
+        {
+            const std::size_t nulls = casts::float_cast_batch_nullable(
+                doubles.data(), count, output.data(), validity.data(), casts::float_cast_op::round);
+            do_not_optimize(nulls);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "float_cast_batch_nullable (round)", count, rounded);
+}
+} // namespace
+
+int main()
+{
+    run("1M rows, 0.1% null", 1 << 20, 0.001);
+    run("1M rows, 10% null", 1 << 20, 0.1);
+    run("16M rows, 10% null", 1 << 24, 0.1);
+}
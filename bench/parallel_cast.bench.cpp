@@ -0,0 +1,91 @@
+#include "bench.hpp"
+#include "better_casts/parallel_cast.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+/// Thread counts from 1 to the number of hardware threads, doubling (plus the hardware count itself).
+auto thread_counts() -> std::vector<unsigned>
+{
+    const unsigned hardware = std::thread::hardware_concurrency() == 0 ? 1 : std::thread::hardware_concurrency();
+    std::vector<unsigned> counts;
+
+    for (unsigned threads = 1; threads < hardware; threads *= 2)
+    {
+        counts.push_back(threads);
+    }
+
+    counts.push_back(hardware);
+    return counts;
+}
+
+void run(const char* shape, std::size_t count)
+{
+    std::mt19937_64 rng{ 42 };
+    std::uniform_real_distribution<float> dist{ -0.99F, 0.99F };
+    std::vector<float> floats(count);
+    std::vector<std::int16_t> output(count);
+    std::vector<std::int32_t> ints(count);
+    std::vector<std::uint8_t> validity(casts::validity_bitmap_size(count));
+
+    for (float& val : floats)
+    {
+        val = dist(rng);
+    }
+
+    const double sequential = best_ns_per_item(
+        [&]
+        {
+            casts::fixed_cast_batch_checked<casts::q15>(floats.data(), count, output.data());
+            do_not_optimize(output);
+        },
+        count, 7);
+    report(shape, "fixed_cast_batch_checked (sequential)", count, sequential);
+
+    for (unsigned threads : thread_counts())
+    {
+        const casts::thread_executor executor{ threads };
+
+        const double fixed = best_ns_per_item(
+            [&]
+            {
+                casts::fixed_cast_batch_checked<casts::q15>(executor, floats.data(), count, output.data());
+                do_not_optimize(output);
+            },
+            count, 7);
+        report(shape, ("fixed_cast_batch_checked, " + std::to_string(threads) + " threads").c_str(), count, fixed);
+
+        const double nullable = best_ns_per_item(
+            [&]
+            {
+                const std::size_t nulls = casts::float_cast_batch_nullable(
+                    executor, floats.data(), count, ints.data(), validity.data(), casts::float_cast_op::round);
+                do_not_optimize(nulls);
+                do_not_optimize(ints);
+            },
+            count, 7);
+        report(shape, ("float_cast_batch_nullable, " + std::to_string(threads) + " threads").c_str(), count, nullable);
+    }
+}
+} // namespace
+
+int main()
+{
+    std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+
+    // Fits in L2/L3: thread start-up dominates
+    run("1M floats", 1 << 20);
+    // Memory-bound: scales until the memory bandwidth is saturated
+    run("64M floats", 1 << 26);
+}
@@ -0,0 +1,111 @@
+#include "bench.hpp"
+#include "better_casts/parse_cast.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+void run(const char* shape, std::size_t count, std::int32_t max_value)
+{
+    constexpr std::size_t width = 12;
+
+    std::mt19937 rng{ 42 };
+    std::uniform_int_distribution<std::int32_t> dist{ -max_value, max_value };
+    std::string fixed;
+    std::string delimited;
+    std::vector<std::int32_t> output(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string field = std::to_string(dist(rng));
+        fixed += std::string(width - field.size(), ' ') + field;
+        delimited += (i == 0 ? "" : ",") + field;
+    }
+
+    // Baseline: what callers write today, strtol into a long followed by a narrow_cast
+    const double strtol_narrow = best_ns_per_item(
+        [&]
+        {
+            const char* pos = delimited.c_str();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                char* end = nullptr;
+                errno = 0;
+                const long value = std::strtol(pos, &end, 10);
+                output[i] = casts::narrow_cast_checked<std::int32_t>(value);
+                pos = end + 1;
+            }
+
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "strtol + narrow_cast", count, strtol_narrow);
+
+    const double scalar_parse = best_ns_per_item(
+        [&]
+        {
+            const char* pos = delimited.data();
+            const char* const last = delimited.data() + delimited.size();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const char* end = pos;
+                while (end != last && *end != ',')
+                {
+                    ++end;
+                }
+
+                output[i] = casts::parse_cast_checked<std::int32_t>(pos, end);
+                pos = end + 1;
+            }
+
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "parse_cast_checked loop", count, scalar_parse);
+
+    const double batch_delimited = best_ns_per_item(
+        [&]
+        {
+            casts::parse_cast_batch_checked(
+                delimited.data(), delimited.data() + delimited.size(), ',', output.data(), count);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "parse_cast_batch_checked (delimited)", count, batch_delimited);
+
+    const double batch_fixed = best_ns_per_item(
+        [&]
+        {
+            casts::parse_cast_batch_checked(fixed.data(), width, count, output.data());
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "parse_cast_batch_checked (fixed)", count, batch_fixed);
+
+    const double batch_fixed_unchecked = best_ns_per_item(
+        [&]
+        {
+            casts::parse_cast_batch_unchecked(fixed.data(), width, count, output.data());
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "parse_cast_batch_unchecked (fixed)", count, batch_fixed_unchecked);
+}
+} // namespace
+
+int main()
+{
+    run("short 1e5", 100'000, 999);
+    run("long 1e5", 100'000, 2'000'000'000);
+    run("long 1e6", 1'000'000, 2'000'000'000);
+}
@@ -0,0 +1,95 @@
+// Throughput of the PCM sample casts, next to the per-sample float_cast loop callers write without them.
+
+#include "bench.hpp"
+#include "better_casts/pcm_cast.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+template<typename T, typename F, typename Cast>
+void run(const char* group, const char* name, const std::vector<F>& input, Cast cast)
+{
+    std::vector<T> output(input.size());
+
+    const double ns = best_ns_per_item(
+        [&]
+        {
+            cast(input.data(), input.size(), output.data());
+            do_not_optimize(output);
+        },
+        input.size());
+    report(group, name, input.size(), ns);
+}
+
+template<typename T, typename F>
+void run_all(const char* group, const std::vector<F>& input)
+{
+    using casts::pcm_dither::tpdf;
+
+    // Baseline: scale, clip and round each sample with a checked float_cast
+    run<T>(group, "scalar float_cast loop", input,
+        [](const F* in, std::size_t count, T* out)
+        {
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                const F scaled = (std::min)((std::max)(in[idx] * F{ 32768 }, F{ -32768 }), F{ 32767 });
+                out[idx] = casts::float_cast_checked<T>(scaled, casts::float_cast_op::round);
+            }
+        });
+
+    run<T>(group, "scalar pcm_cast loop", input,
+        [](const F* in, std::size_t count, T* out)
+        {
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                out[idx] = casts::pcm_cast_checked<T>(in[idx]);
+            }
+        });
+
+    run<T>(group, "pcm_cast_batch_unchecked", input,
+        [](const F* in, std::size_t count, T* out) { casts::pcm_cast_batch_unchecked(in, count, out); });
+    run<T>(group, "pcm_cast_batch_checked", input,
+        [](const F* in, std::size_t count, T* out) { casts::pcm_cast_batch_checked(in, count, out); });
+    run<T>(group, "pcm_cast_batch_checked (tpdf)", input,
+        [](const F* in, std::size_t count, T* out) { casts::pcm_cast_batch_checked(in, count, out, tpdf); });
+}
+
+template<typename T>
+void run_packed(const char* group, const std::vector<float>& input)
+{
+    run<T>(group, "pcm_cast_batch_checked", input,
+        [](const float* in, std::size_t count, T* out) { casts::pcm_cast_batch_checked(in, count, out); });
+
+    std::vector<T> samples(input.size());
+    casts::pcm_cast_batch_unchecked(input.data(), input.size(), samples.data());
+
+    run<float>(group, "pcm_cast_batch (to float)", samples,
+        [](const T* in, std::size_t count, float* out) { casts::pcm_cast_batch(in, count, out); });
+}
+} // namespace
+
+int main()
+{
+    // One second of interleaved 48 kHz stereo, a little past full scale so some samples clip
+    constexpr std::size_t count = 2 * 48000;
+
+    std::mt19937 rng{ 42 };
+    std::uniform_real_distribution<float> dist{ -1.1F, 1.1F };
+    std::vector<float> floats(count);
+    std::generate(floats.begin(), floats.end(), [&] { return dist(rng); });
+    const std::vector<double> doubles(floats.begin(), floats.end());
+
+    run_all<std::int16_t>("float -> int16", floats);
+    run_all<std::int16_t>("double -> int16", doubles);
+    run_packed<casts::pcm24_t>("float <-> int24", floats);
+    run_packed<std::int32_t>("float <-> int32", floats);
+}
@@ -0,0 +1,83 @@
+#include "bench.hpp"
+#include "better_casts/quantize_cast.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+void run(const char* shape, std::size_t count)
+{
+    static constexpr casts::quant_params params{ 0.02F, -3 };
+
+    std::mt19937 rng{ 42 };
+    std::normal_distribution<float> dist{ 0.0F, 1.5F };
+    std::vector<float> input(count);
+    std::vector<std::int8_t> output(count);
+
+    std::generate(input.begin(), input.end(), [&] { return dist(rng); });
+
+    // Baseline: what callers write today, one checked-free float_cast per element plus manual saturation
+    const double scalar_float_cast = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const float scaled = (std::min)((std::max)(input[i] / params.scale, -1e9F), 1e9F);
+                const auto rounded = casts::float_cast_unchecked<std::int32_t>(scaled, casts::float_cast_op::round);
+                output[i] = static_cast<std::int8_t>((std::min)((std::max)(rounded + params.zero_point, -128), 127));
+            }
+
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "scalar float_cast loop", count, scalar_float_cast);
+
+    const double scalar_quantize = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output[i] = casts::quantize_cast_unchecked<std::int8_t>(input[i], params);
+            }
+
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "scalar quantize_cast loop", count, scalar_quantize);
+
+    const double batch_unchecked = best_ns_per_item(
+        [&]
+        {
+            casts::quantize_cast_batch_unchecked(input.data(), count, output.data(), params);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "quantize_cast_batch_unchecked", count, batch_unchecked);
+
+    const double batch_checked = best_ns_per_item(
+        [&]
+        {
+            casts::quantize_cast_batch_checked(input.data(), count, output.data(), params);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "quantize_cast_batch_checked", count, batch_checked);
+}
+} // namespace
+
+int main()
+{
+    run("fc 1x4096", 4096);
+    run("conv 7x7x512", 7 * 7 * 512);
+    run("image 224x224x3", 224 * 224 * 3);
+    run("conv 56x56x64", 56 * 56 * 64);
+    run("conv 112x112x64", 112 * 112 * 64);
+}
@@ -0,0 +1,103 @@
+#include "bench.hpp"
+#include "better_casts/range_cast.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+void run(const char* shape, std::size_t count, std::size_t table_size)
+{
+    std::mt19937_64 rng{ 42 };
+    std::uniform_int_distribution<std::int64_t> dist{ 0, static_cast<std::int64_t>(table_size) - 1 };
+    std::vector<std::int64_t> indices(count);
+    std::vector<std::int32_t> table(table_size, 1);
+    std::vector<std::int32_t> narrowed(count);
+    std::int64_t sum = 0;
+
+    for (auto& idx : indices)
+    {
+        idx = dist(rng);
+    }
+
+    // Baseline: the pattern this replaces, a checked cast per iteration
+    const double per_element = best_ns_per_item(
+        [&]
+        {
+            sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum += table[static_cast<std::size_t>(casts::narrow_cast_checked<std::int32_t>(indices[i]))];
+            }
+
+            do_not_optimize(sum);
+        },
+        count);
+    report(shape, "narrow_cast_checked per element", count, per_element);
+
+    const double narrow_per_element = best_ns_per_item(
+        [&]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                narrowed[i] = casts::narrow_cast_checked<std::int32_t>(indices[i]);
+            }
+
+            do_not_optimize(narrowed);
+        },
+        count);
+    report(shape, "narrow_cast_checked copy", count, narrow_per_element);
+
+    const double narrow_hoisted = best_ns_per_item(
+        [&]
+        {
+            const auto view = casts::range_cast_checked<std::int32_t>(indices.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                narrowed[i] = view[i];
+            }
+
+            do_not_optimize(narrowed);
+        },
+        count);
+    report(shape, "range_cast_checked copy", count, narrow_hoisted);
+
+    const double scan_only = best_ns_per_item(
+        [&]
+        {
+            const auto view = casts::range_cast_checked<std::int32_t>(indices.data(), count);
+            do_not_optimize(view);
+        },
+        count);
+    report(shape, "range_cast_checked scan", count, scan_only);
+
+    const double hoisted = best_ns_per_item(
+        [&]
+        {
+            const auto view = casts::range_cast_checked<std::int32_t>(indices.data(), count);
+
+            sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum += table[static_cast<std::size_t>(view[i])];
+            }
+
+            do_not_optimize(sum);
+        },
+        count);
+    report(shape, "range_cast_checked + gather", count, hoisted);
+}
+} // namespace
+
+int main()
+{
+    run("gather 4K into 1K", 4096, 1024);
+    run("gather 1M into 64K", 1 << 20, 1 << 16);
+}
@@ -0,0 +1,87 @@
+#include "bench.hpp"
+#include "better_casts/stream_cast.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+using converter = casts::stream_converter<std::int32_t, double, casts::stream_family::float_cast,
+    casts::stream_policy::saturate, casts::detail::math::float_op_round>;
+
+void run(const char* shape, std::size_t count)
+{
+    std::mt19937_64 rng{ 42 };
+    std::uniform_real_distribution<double> dist{ -1e9, 1e9 };
+    // One spare byte so chunks can start misaligned, as they do when a header precedes the payload
+    std::vector<unsigned char> bytes(count * sizeof(double) + 1);
+    std::vector<std::int32_t> output(count);
+    std::vector<std::uint8_t> validity(casts::validity_bitmap_size(count));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const double val = dist(rng);
+        std::memcpy(bytes.data() + 1 + i * sizeof(double), &val, sizeof(double));
+    }
+
+    std::vector<double> doubles(count);
+    std::memcpy(doubles.data(), bytes.data() + 1, count * sizeof(double));
+
+    // Baseline: the whole column is available at once
+    const double batch = best_ns_per_item(
+        [&]
+        {
+            const std::size_t nulls = casts::float_cast_batch_nullable(
+                doubles.data(), count, output.data(), validity.data(), casts::float_cast_op::round);
+            do_not_optimize(nulls);
+            do_not_optimize(output);
+        },
+        count);
+    report(shape, "float_cast_batch_nullable (round)", count, batch);
+
+    const auto stream = [&](const char* name, std::size_t chunk, const unsigned char* data)
+    {
+        const double ns = best_ns_per_item(
+            [&]
+            {
+                std::size_t total = 0;
+                converter conv([&](const std::int32_t* values, std::size_t size)
+                    {
+                        do_not_optimize(values);
+                        total += size;
+                    });
+
+                for (std::size_t offset = 0; offset < count * sizeof(double); offset += chunk)
+                {
+                    conv.push(data + offset, (std::min)(chunk, count * sizeof(double) - offset));
+                }
+
+                conv.finish();
+                do_not_optimize(total);
+            },
+            count);
+        report(shape, name, count, ns);
+    };
+
+    const auto* aligned = reinterpret_cast<const unsigned char*>(doubles.data());
+
+    stream("stream, 1500 byte chunks", 1500, aligned);
+    stream("stream, 1500 byte chunks, misaligned", 1500, bytes.data() + 1);
+    stream("stream, 64 KiB chunks", 65536, aligned);
+    stream("stream, 64 KiB chunks, misaligned", 65536, bytes.data() + 1);
+}
+} // namespace
+
+int main()
+{
+    run("1M rows", 1 << 20);
+    run("16M rows", 1 << 24);
+}
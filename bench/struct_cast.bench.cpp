@@ -0,0 +1,126 @@
+// Throughput of packing wide records: struct_cast and its batch forms next to a hand-written narrow_cast per field.
+
+#include "bench.hpp"
+#include "better_casts/struct_cast.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using casts::bench::best_ns_per_item;
+using casts::bench::do_not_optimize;
+using casts::bench::report;
+
+struct wide
+{
+    std::int64_t id;
+    double value;
+    std::int32_t count;
+    double ratio;
+};
+
+struct packed
+{
+    std::int16_t id;
+    float value;
+    std::uint32_t count;
+    std::int32_t ratio;
+};
+
+template<typename Pack>
+void run(const char* name, const std::vector<wide>& input, Pack pack)
+{
+    const double ns = best_ns_per_item([&] { pack(input.data(), input.size()); }, input.size());
+    report("wide to packed", name, input.size(), ns);
+}
+} // namespace
+
+namespace casts
+{
+template<>
+struct struct_fields<wide>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&wide::id, &wide::value, &wide::count, &wide::ratio);
+    }
+};
+
+template<>
+struct struct_fields<packed>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&packed::id, &packed::value, &packed::count, &packed::ratio);
+    }
+};
+} // namespace casts
+
+int main()
+{
+    constexpr std::size_t count = 1 << 16;
+
+    // Every field fits, so the checked versions run to the end
+    std::mt19937 rng{ 42 };
+    std::uniform_int_distribution<std::int32_t> dist{ -30000, 30000 };
+    std::vector<wide> input(count);
+
+    for (wide& record : input)
+    {
+        const std::int32_t val = dist(rng);
+        record = wide{ val, val * 0.125, val < 0 ? -val : val, val * 0.5 };
+    }
+
+    std::vector<packed> output(count);
+    std::vector<std::int16_t> ids(count);
+    std::vector<float> values(count);
+    std::vector<std::uint32_t> counts(count);
+    std::vector<std::int32_t> ratios(count);
+
+    run("narrow_cast per field", input,
+        [&](const wide* records, std::size_t size)
+        {
+            for (std::size_t idx = 0; idx < size; ++idx)
+            {
+                output[idx].id = casts::narrow_cast_checked<std::int16_t>(records[idx].id);
+                output[idx].value = casts::narrow_cast_checked<float>(records[idx].value);
+                output[idx].count = casts::sign_cast_checked<std::uint32_t>(records[idx].count);
+                output[idx].ratio = casts::float_cast_checked<std::int32_t>(records[idx].ratio);
+            }
+
+            do_not_optimize(output.data());
+        });
+    run("struct_cast_checked per record", input,
+        [&](const wide* records, std::size_t size)
+        {
+            for (std::size_t idx = 0; idx < size; ++idx)
+            {
+                output[idx] = casts::struct_cast_checked<packed>(records[idx]);
+            }
+
+            do_not_optimize(output.data());
+        });
+    run("struct_cast_batch_unchecked", input,
+        [&](const wide* records, std::size_t size)
+        {
+            casts::struct_cast_batch_unchecked(records, size, output.data());
+            do_not_optimize(output.data());
+        });
+    run("struct_cast_batch_checked", input,
+        [&](const wide* records, std::size_t size)
+        {
+            casts::struct_cast_batch_checked(records, size, output.data());
+            do_not_optimize(output.data());
+        });
+    run("struct_cast_batch_soa_checked", input,
+        [&](const wide* records, std::size_t size)
+        {
+            casts::struct_cast_batch_soa_checked(
+                records, size, ids.data(), values.data(), counts.data(), ratios.data());
+            do_not_optimize(ids.data());
+        });
+}
@@ -18,11 +18,17 @@
 #  endif
 #endif
 
+#include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 #ifdef __cpp_inline_variables
@@ -51,6 +57,30 @@
 #  define NORETURN
 #endif
 
+// Failure paths are kept out of line and in the cold section, so the checks add little code to each call site
+#if defined(__GNUC__)
+#  define COLD [[gnu::cold, gnu::noinline]]
+#  define UNLIKELY(cond) __builtin_expect(!!(cond), 0)
+#elif defined(_MSC_VER)
+#  define COLD __declspec(noinline)
+#  define UNLIKELY(cond) (cond)
+#else
+#  define COLD
+#  define UNLIKELY(cond) (cond)
+#endif
+
+// Thin wrappers are inlined even in unoptimized builds, and are not stepped into by debuggers (they forward with
+// `static_cast<From&&>` rather than `std::forward`, which is an out-of-line call at -O0)
+#if defined(__clang__)
+#  define FORCE_INLINE __attribute__((always_inline, nodebug)) inline
+#elif defined(__GNUC__)
+#  define FORCE_INLINE __attribute__((always_inline, artificial)) inline
+#elif defined(_MSC_VER)
+#  define FORCE_INLINE __forceinline
+#else
+#  define FORCE_INLINE inline
+#endif
+
 #ifdef __cpp_lib_unreachable
 #  define UNREACHABLE() std::unreachable()
 #else
@@ -64,10 +94,22 @@
 #  endif
 #endif
 
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+#  define HAS_RTTI 1
+#endif
+
+// Without exceptions (ex. -fno-exceptions), checked casts report failures to the cast failure handler instead
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#  define HAS_EXCEPTIONS 1
+#endif
+
 #define FLOAT_CAST_OP_CEILING 1
 #define FLOAT_CAST_OP_FLOOR 2
 #define FLOAT_CAST_OP_ROUND 3
 #define FLOAT_CAST_OP_TRUNCATE 4
+#define FLOAT_CAST_OP_ROUND_EVEN 5
+#define FLOAT_CAST_OP_ROUND_HALF_DOWN 6
+#define FLOAT_CAST_OP_STOCHASTIC 7
 
 #ifndef DEFAULT_FLOAT_CAST_OP
 #  define DEFAULT_FLOAT_CAST_OP FLOAT_CAST_OP_TRUNCATE
@@ -92,6 +134,13 @@ public:
     using runtime_error::runtime_error;
 };
 
+/// @brief Error thrown when a down_cast fails.
+class down_cast_error final : public cast_error
+{
+public:
+    using cast_error::cast_error;
+};
+
 /// @brief Error thrown when an enum_cast fails.
 class enum_cast_error final : public cast_error
 {
@@ -120,8 +169,56 @@ public:
     using cast_error::cast_error;
 };
 
+/// @brief Function called with the error message when a checked cast fails and exceptions are disabled.
+///
+/// It must not return (ex. log and abort, or exit); if it does, the program is aborted.
+using cast_failure_handler = void (*)(const char* message);
+
+namespace detail
+{
+    inline auto failure_handler() noexcept -> std::atomic<cast_failure_handler>&
+    {
+        static std::atomic<cast_failure_handler> handler{ nullptr };
+        return handler;
+    }
+} // namespace detail
+
+/// @brief Sets the function called when a checked cast fails and exceptions are disabled.
+///
+/// Without a handler (the default), the error message is written to stderr and the program is aborted. The handler
+/// is called on the thread of the failing cast, which may be a worker of a parallel batch cast. When exceptions are
+/// enabled, checked casts throw and the handler is never called.
+///
+/// @param handler The new handler, or nullptr to restore the default.
+/// @return The previous handler.
+inline auto set_cast_failure_handler(cast_failure_handler handler) noexcept -> cast_failure_handler
+{
+    return detail::failure_handler().exchange(handler);
+}
+
 namespace detail
 {
+    /// Throws an @p Error (one out-of-line copy per error type, shared by every cast of that family), or calls the
+    /// cast failure handler when exceptions are disabled.
+    template<typename Error>
+    NORETURN COLD inline void throw_cast_error(const char* message)
+    {
+#ifdef HAS_EXCEPTIONS
+        throw Error(message);
+#else
+        const cast_failure_handler handler = failure_handler().load();
+
+        if (handler != nullptr)
+        {
+            handler(message);
+        }
+
+        std::fputs(message, stderr);
+        std::fputc('\n', stderr);
+        std::abort();
+#endif
+    }
+
     template<typename T, bool = false>
     struct underlying_type
     {
@@ -137,6 +234,76 @@ namespace detail
     template<typename T>
     using underlying_type_t = typename underlying_type<T, std::is_enum<T>::value>::type;
 
+#ifdef __SIZEOF_INT128__
+    __extension__ using int128_t = __int128;
+    __extension__ using uint128_t = unsigned __int128;
+#endif
+
+    /// Like std::is_integral, but also true for the 128-bit integers (which the standard traits only recognize in
+    /// the GNU dialects).
+    template<typename T>
+    struct is_integer : std::is_integral<T>
+    {
+    };
+
+    template<typename T>
+    struct is_signed : std::is_signed<T>
+    {
+    };
+
+    template<typename T>
+    struct is_unsigned : std::is_unsigned<T>
+    {
+    };
+
+    template<typename T>
+    struct make_unsigned
+    {
+        using type = std::make_unsigned_t<T>;
+    };
+
+#ifdef __SIZEOF_INT128__
+    template<>
+    struct is_integer<int128_t> : std::true_type
+    {
+    };
+
+    template<>
+    struct is_integer<uint128_t> : std::true_type
+    {
+    };
+
+    template<>
+    struct is_signed<int128_t> : std::true_type
+    {
+    };
+
+    template<>
+    struct is_unsigned<uint128_t> : std::true_type
+    {
+    };
+
+    template<>
+    struct make_unsigned<int128_t>
+    {
+        using type = uint128_t;
+    };
+
+    template<>
+    struct make_unsigned<uint128_t>
+    {
+        using type = uint128_t;
+    };
+#endif
+
+    template<typename T>
+    using make_unsigned_t = typename make_unsigned<T>::type;
+
+    template<typename T>
+    struct is_arithmetic : std::integral_constant<bool, std::is_arithmetic<T>::value || is_integer<T>::value>
+    {
+    };
+
     template<typename T, typename U>
     INLINE_CONSTEXPR bool is_smaller_size = sizeof(T) < sizeof(U);
 
@@ -147,10 +314,10 @@ namespace detail
     INLINE_CONSTEXPR bool is_larger_size = sizeof(T) > sizeof(U);
 
     template<typename T, typename U>
-    INLINE_CONSTEXPR bool is_same_sign = std::is_signed<T>::value == std::is_signed<U>::value;
+    INLINE_CONSTEXPR bool is_same_sign = is_signed<T>::value == is_signed<U>::value;
 
     template<typename T, typename U>
-    INLINE_CONSTEXPR bool are_both_int = std::is_integral<T>::value && std::is_integral<U>::value;
+    INLINE_CONSTEXPR bool are_both_int = is_integer<T>::value && is_integer<U>::value;
 
     template<typename T, typename U>
     INLINE_CONSTEXPR bool are_both_float = std::is_floating_point<T>::value && std::is_floating_point<U>::value;
@@ -172,6 +339,15 @@ namespace detail
         struct float_op_truncate
         {
         };
+        struct float_op_round_even
+        {
+        };
+        struct float_op_round_half_down
+        {
+        };
+        struct float_op_stochastic
+        {
+        };
 
 #if DEFAULT_FLOAT_CAST_OP == FLOAT_CAST_OP_CEILING
         using float_op_default = float_op_ceiling;
@@ -179,6 +355,12 @@ namespace detail
         using float_op_default = float_op_floor;
 #elif DEFAULT_FLOAT_CAST_OP == FLOAT_CAST_OP_ROUND
         using float_op_default = float_op_round;
+#elif DEFAULT_FLOAT_CAST_OP == FLOAT_CAST_OP_ROUND_EVEN
+        using float_op_default = float_op_round_even;
+#elif DEFAULT_FLOAT_CAST_OP == FLOAT_CAST_OP_ROUND_HALF_DOWN
+        using float_op_default = float_op_round_half_down;
+#elif DEFAULT_FLOAT_CAST_OP == FLOAT_CAST_OP_STOCHASTIC
+        using float_op_default = float_op_stochastic;
 #else
         using float_op_default = float_op_truncate;
 #endif
@@ -194,8 +376,25 @@ namespace detail
             static constexpr auto HALF = static_cast<type>(0.5);
         };
 
+        /// Computes 2^exp exactly in the floating point type @p T (becomes Infinity if out of range).
+        template<typename T>
+        NODISCARD constexpr auto pow2(int exp) noexcept -> T
+        {
+            static_assert(std::is_floating_point<T>::value, "T must be floating point");
+
+            T result = float_const<T>::ONE;
+            const T factor = exp < 0 ? float_const<T>::HALF : static_cast<T>(2);
+
+            for (int i = exp < 0 ? -exp : exp; i > 0; --i)
+            {
+                result *= factor;
+            }
+
+            return result;
+        }
+
         template<typename T>
-        NODISCARD constexpr auto is_nan(T val) noexcept -> bool
+        NODISCARD FORCE_INLINE constexpr auto is_nan(T val) noexcept -> bool
         {
             static_assert(std::is_floating_point<T>::value, "T must be floating point to check for NaN");
 
@@ -211,7 +410,7 @@ namespace detail
         static_assert(!is_nan(INFINITY), "INFINITY must not be NAN");
 
         template<typename T>
-        NODISCARD constexpr auto is_inf(T val) noexcept -> bool
+        NODISCARD FORCE_INLINE constexpr auto is_inf(T val) noexcept -> bool
         {
             static_assert(std::is_floating_point<T>::value, "T must be floating point to check for Infinity");
 
@@ -220,7 +419,10 @@ namespace detail
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
-            return val == std::numeric_limits<T>::infinity() || val == -std::numeric_limits<T>::infinity();
+            // A constant, so unoptimized builds do not call numeric_limits at runtime
+            constexpr T infinity = std::numeric_limits<T>::infinity();
+
+            return val == infinity || val == -infinity;
 #ifdef __clang__
 #  pragma clang diagnostic pop
 #endif
@@ -230,84 +432,140 @@ namespace detail
         static_assert(is_inf(-INFINITY), "is_inf(-INFINITY) must be true");
 
         template<typename T>
-        constexpr void check_inf_nan(T val)
+        FORCE_INLINE constexpr void check_inf_nan(T val)
         {
-            if (is_nan(val))
+            if (UNLIKELY(is_nan(val)))
             {
-                throw float_cast_error("float_cast failed: cannot cast from NaN");
+                throw_cast_error<float_cast_error>("float_cast failed: cannot cast from NaN");
             }
 
-            if (is_inf(val))
+            if (UNLIKELY(is_inf(val)))
             {
-                throw float_cast_error("float_cast failed: cannot cast from Infinity");
+                throw_cast_error<float_cast_error>("float_cast failed: cannot cast from Infinity");
             }
         }
 
-        template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
-        constexpr auto trunc(T val) noexcept -> T
+        /// Bounds (as @p F) of the integers representable by @p To: `lower` is inclusive and `upper` is exclusive.
+        ///
+        /// Both are exact powers of two (or zero), so unlike `static_cast<F>(std::numeric_limits<To>::max())` they
+        /// never round. `has_upper` is false when every finite @p F is below the upper bound (ex. float to uint128).
+        template<typename To, typename F>
+        struct int_bounds
+        {
+            static_assert(is_integer<To>::value, "To must be integral");
+            static_assert(std::is_floating_point<F>::value, "F must be floating point");
+
+            static constexpr bool has_upper = std::numeric_limits<To>::digits < std::numeric_limits<F>::max_exponent;
+            static constexpr F lower =
+                is_signed<To>::value ? -pow2<F>(std::numeric_limits<To>::digits) : float_const<F>::ZERO;
+            static constexpr F upper =
+                has_upper ? pow2<F>(std::numeric_limits<To>::digits) : (std::numeric_limits<F>::max)();
+        };
+
+        template<typename To, typename F>
+        constexpr bool int_bounds<To, F>::has_upper;
+
+        template<typename To, typename F>
+        constexpr F int_bounds<To, F>::lower;
+
+        template<typename To, typename F>
+        constexpr F int_bounds<To, F>::upper;
+
+        /// Checks if the already rounded (integral) value @p val is representable by @p To.
+        template<typename To, typename F>
+        NODISCARD FORCE_INLINE constexpr auto fits_int(F val) noexcept -> bool
         {
-            return static_cast<T>(static_cast<std::intmax_t>(val));
+            return val >= int_bounds<To, F>::lower && (!int_bounds<To, F>::has_upper || val < int_bounds<To, F>::upper);
         }
 
-        template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
-        constexpr auto abs(T val) noexcept -> T
+        // The rounding operations convert once, truncating toward zero, and then correct the integer. The truncated
+        // value converts back to From exactly and `val - truncated` is exact (Sterbenz lemma), so the correction is
+        // exact for every value whose result fits in To, whatever the magnitude (no intermediate integer type).
+        // Corrections are added as 0 or 1 rather than branched on, as the direction is unpredictable in bulk.
+
+        template<typename To, typename From,
+            typename = std::enable_if_t<is_arithmetic<To>::value && std::is_floating_point<From>::value>>
+        FORCE_INLINE constexpr auto round(From val) noexcept -> To
         {
-            return val < 0 ? -val : val;
+            const To truncated = static_cast<To>(val);
+            const From fraction = val - static_cast<From>(truncated);
+            const To up = static_cast<To>(fraction >= float_const<From>::HALF);
+            const To down = static_cast<To>(fraction <= -float_const<From>::HALF);
+
+            return static_cast<To>(truncated + up - down);
         }
 
         template<typename To, typename From,
-            typename = std::enable_if_t<std::is_arithmetic<To>::value && std::is_floating_point<From>::value>>
-        constexpr auto round(From val) noexcept -> To
+            typename = std::enable_if_t<is_arithmetic<To>::value && std::is_floating_point<From>::value>>
+        FORCE_INLINE constexpr auto floor(From val) noexcept -> To
         {
-            if (val >= float_const<From>::ZERO)
-            {
-                return abs(trunc(val) - val) >= abs(trunc(val) - val + float_const<From>::ONE)
-                    ? static_cast<To>(val) + static_cast<To>(1)
-                    : static_cast<To>(val);
-            }
+            const To truncated = static_cast<To>(val);
+            const To down = static_cast<To>(static_cast<From>(truncated) > val);
 
-            return abs(trunc(val) - val) >= abs(trunc(val) - val - float_const<From>::ONE)
-                ? static_cast<To>(val) - static_cast<To>(1)
-                : static_cast<To>(val);
+            return static_cast<To>(truncated - down);
         }
 
         template<typename To, typename From,
-            typename = std::enable_if_t<std::is_arithmetic<To>::value && std::is_floating_point<From>::value>>
-        constexpr auto floor(From val) noexcept -> To
+            typename = std::enable_if_t<is_arithmetic<To>::value && std::is_floating_point<From>::value>>
+        FORCE_INLINE constexpr auto ceiling(From from_val) noexcept -> To
         {
-#ifdef __clang__
-#  pragma clang diagnostic push
-#  pragma clang diagnostic ignored "-Wfloat-equal"
-#endif
-            if (trunc(val) == val)
-            {
-                return static_cast<To>(val);
-            }
-#ifdef __clang__
-#  pragma clang diagnostic pop
-#endif
+            const To truncated = static_cast<To>(from_val);
+            const To up = static_cast<To>(static_cast<From>(truncated) < from_val);
 
-            return val < float_const<From>::ZERO ? static_cast<To>(val) - static_cast<To>(1) : static_cast<To>(val);
+            return static_cast<To>(truncated + up);
         }
 
+        /// Rounds to the nearest integer, ties to even (the IEEE 754 default, also known as banker's rounding).
         template<typename To, typename From,
-            typename = std::enable_if_t<std::is_arithmetic<To>::value && std::is_floating_point<From>::value>>
-        constexpr auto ceiling(From from_val) noexcept -> To
+            typename = std::enable_if_t<is_arithmetic<To>::value && std::is_floating_point<From>::value>>
+        FORCE_INLINE constexpr auto round_even(From val) noexcept -> To
         {
-#ifdef __clang__
-#  pragma clang diagnostic push
-#  pragma clang diagnostic ignored "-Wfloat-equal"
-#endif
-            if (trunc(from_val) == from_val)
-            {
-                return static_cast<To>(from_val);
-            }
-#ifdef __clang__
-#  pragma clang diagnostic pop
-#endif
+            const To truncated = static_cast<To>(val);
+            const From fraction = val - static_cast<From>(truncated);
+            const bool odd = (truncated & 1) != 0;
+            constexpr From half = float_const<From>::HALF;
+            // Bitwise, so that the unpredictable comparisons do not become branches
+            const To up = static_cast<To>((fraction > half) | (odd & (fraction >= half)));
+            const To down = static_cast<To>((fraction < -half) | (odd & (fraction <= -half)));
+
+            return static_cast<To>(truncated + up - down);
+        }
+
+        /// Rounds to the nearest integer, ties towards zero.
+        template<typename To, typename From,
+            typename = std::enable_if_t<is_arithmetic<To>::value && std::is_floating_point<From>::value>>
+        FORCE_INLINE constexpr auto round_half_down(From val) noexcept -> To
+        {
+            const To truncated = static_cast<To>(val);
+            const From fraction = val - static_cast<From>(truncated);
+            const To up = static_cast<To>(fraction > float_const<From>::HALF);
+            const To down = static_cast<To>(fraction < -float_const<From>::HALF);
+
+            return static_cast<To>(truncated + up - down);
+        }
+
+        /// Rounds away from zero when the discarded fraction exceeds @p threshold (in [0, 1)), towards zero otherwise.
+        /// With a uniformly distributed threshold, the expected result is @p val itself (stochastic rounding).
+        template<typename To, typename From,
+            typename = std::enable_if_t<is_arithmetic<To>::value && std::is_floating_point<From>::value>>
+        FORCE_INLINE constexpr auto stochastic_round(From val, From threshold) noexcept -> To
+        {
+            const To truncated = static_cast<To>(val);
+            const From fraction = val - static_cast<From>(truncated);
+            const To up = static_cast<To>(fraction > threshold);
+            const To down = static_cast<To>(-fraction > threshold);
+
+            return static_cast<To>(truncated + up - down);
+        }
+
+        /// Maps 64 random bits to a value uniformly distributed in [0, 1), using as many bits as @p F can hold exactly.
+        template<typename F>
+        NODISCARD FORCE_INLINE constexpr auto unit_interval(std::uint64_t bits) noexcept -> F
+        {
+            constexpr int digits = std::numeric_limits<F>::digits < 64 ? std::numeric_limits<F>::digits : 64;
+            constexpr F scale = pow2<F>(-digits);
 
-            return from_val < float_const<From>::ZERO ? static_cast<To>(from_val)
-                                                      : static_cast<To>(from_val) + static_cast<To>(1);
+            return static_cast<F>(bits >> (64 - digits)) * scale;
         }
     } //namespace math
 } // namespace detail
@@ -342,10 +600,10 @@ INLINE_CONSTEXPR bool is_enum_castable_v = is_enum_castable<To, From>::value;
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto enum_cast_unchecked(From&& from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto enum_cast_unchecked(From&& from_val) noexcept -> To
 {
     static_assert(is_enum_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
-    return static_cast<To>(std::forward<From>(from_val));
+    return static_cast<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts between enums and integers with runtime checks.
@@ -356,7 +614,7 @@ NODISCARD constexpr auto enum_cast_unchecked(From&& from_val) noexcept -> To
 /// @return The casted value.
 /// @exception enum_cast_error Thrown if the value is not contained within the enum (only if magic_enum is used).
 template<typename To, typename From>
-NODISCARD constexpr auto enum_cast_checked(From from_val) -> To
+NODISCARD FORCE_INLINE constexpr auto enum_cast_checked(From from_val) -> To
 {
     static_assert(is_enum_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
@@ -365,18 +623,18 @@ NODISCARD constexpr auto enum_cast_checked(From from_val) -> To
     {
         auto casted = magic_enum::enum_cast<To>(from_val);
 
-        if (!casted.has_value())
+        if (UNLIKELY(!casted.has_value()))
         {
-            throw enum_cast_error("enum_cast failed: value not contained within enum");
+            detail::throw_cast_error<enum_cast_error>("enum_cast failed: value not contained within enum");
         }
 
         return *casted;
     }
     else
     {
-        if (!magic_enum::enum_contains<From>(from_val))
+        if (UNLIKELY(!magic_enum::enum_contains<From>(from_val)))
         {
-            throw enum_cast_error("enum_cast failed: value not contained within enum");
+            detail::throw_cast_error<enum_cast_error>("enum_cast failed: value not contained within enum");
         }
 
         return static_cast<To>(from_val);
@@ -394,13 +652,13 @@ NODISCARD constexpr auto enum_cast_checked(From from_val) -> To
 /// @return The casted value.
 /// @exception enum_cast_error Thrown if the value is not contained within the enum (only if magic_enum is used).
 template<typename To, typename From>
-NODISCARD constexpr auto enum_cast(From&& from_val) noexcept(sizeof(To) >= sizeof(From))
-    -> std::enable_if_t<CHECK_CASTS, To>
+NODISCARD FORCE_INLINE constexpr auto enum_cast(From&& from_val) noexcept(
+    noexcept(enum_cast_checked<To>(std::declval<From>()))) -> std::enable_if_t<CHECK_CASTS, To>
 {
     static_assert(is_enum_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return enum_cast_checked<To>(std::forward<From>(from_val));
+    return enum_cast_checked<To>(static_cast<From&&>(from_val));
 }
 
 ///@brief Casts between enums and integers. Based on configuration this will call enum_cast_unchecked.
@@ -410,12 +668,12 @@ NODISCARD constexpr auto enum_cast(From&& from_val) noexcept(sizeof(To) >= sizeo
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto enum_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+NODISCARD FORCE_INLINE constexpr auto enum_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
 {
     static_assert(is_enum_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return enum_cast_unchecked<To>(std::forward<From>(from_val));
+    return enum_cast_unchecked<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Type trait to determine if two types are able to be cast via float_cast.
@@ -430,7 +688,7 @@ NODISCARD constexpr auto enum_cast(From&& from_val) noexcept -> std::enable_if_t
 template<typename To, typename From>
 struct is_float_castable :
     std::integral_constant<bool,
-        (std::is_integral<To>::value && !std::is_same<To, bool>::value && std::is_floating_point<From>::value)>
+        (detail::is_integer<To>::value && !std::is_same<To, bool>::value && std::is_floating_point<From>::value)>
 {
 };
 
@@ -438,6 +696,69 @@ struct is_float_castable :
 template<typename To, typename From>
 INLINE_CONSTEXPR bool is_float_castable_v = is_float_castable<To, From>::value;
 
+/// @brief Generator of the random bits used by stochastic rounding (float_cast_op::stochastic).
+///
+/// It returns 64 uniformly distributed bits and is called once per rounded value, possibly from several threads at
+/// once (ex. the workers of a parallel batch cast), so it must be thread safe; keeping its state in a `thread_local`
+/// avoids any synchronization.
+using stochastic_rng = std::uint64_t (*)();
+
+namespace detail
+{
+    namespace math
+    {
+        /// The built-in generator: splitmix64 over a per-thread state, so threads never contend or share a sequence.
+        inline auto default_stochastic_rng() noexcept -> std::uint64_t
+        {
+            constexpr std::uint64_t golden_gamma = 0x9E3779B97F4A7C15ULL;
+            thread_local std::uint64_t state = 0;
+
+            // Seeded on first use from the address of the state, which differs between threads
+            if (UNLIKELY(state == 0))
+            {
+                state = reinterpret_cast<std::uintptr_t>(&state) * golden_gamma;
+            }
+
+            std::uint64_t bits = (state += golden_gamma);
+            bits = (bits ^ (bits >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+            bits = (bits ^ (bits >> 27U)) * 0x94D049BB133111EBULL;
+            return bits ^ (bits >> 31U);
+        }
+
+        inline auto stochastic_rng_hook() noexcept -> std::atomic<stochastic_rng>&
+        {
+            static std::atomic<stochastic_rng> rng{ nullptr };
+            return rng;
+        }
+
+        /// Draws 64 random bits from the installed generator (or the built-in one).
+        NODISCARD inline auto stochastic_bits() -> std::uint64_t
+        {
+            const stochastic_rng rng = stochastic_rng_hook().load(std::memory_order_relaxed);
+            return rng == nullptr ? default_stochastic_rng() : rng();
+        }
+
+        /// Draws the threshold of one stochastic rounding, uniformly distributed in [0, 1).
+        template<typename F>
+        NODISCARD inline auto stochastic_threshold() -> F
+        {
+            return unit_interval<F>(stochastic_bits());
+        }
+    } //namespace math
+} // namespace detail
+
+/// @brief Sets the generator used by stochastic rounding, for every thread.
+///
+/// The default generator is a fast per-thread splitmix64 seeded differently on each thread. Installing a generator
+/// makes the rounding reproducible (ex. a seeded generator with `thread_local` state in tests).
+///
+/// @param rng The new generator, or nullptr to restore the default.
+/// @return The previous generator (nullptr for the default).
+inline auto set_stochastic_rng(stochastic_rng rng) noexcept -> stochastic_rng
+{
+    return detail::math::stochastic_rng_hook().exchange(rng);
+}
+
 /// @brief Namespace containing the singleton instances of the float_cast operation tags.
 namespace float_cast_op
 {
@@ -452,6 +773,16 @@ namespace float_cast_op
 
     /// @brief Tag for the truncate operation.
     INLINE_CONSTEXPR detail::math::float_op_truncate truncate{};
+
+    /// @brief Tag for rounding to the nearest integer, ties to even (banker's rounding, unbiased on ties).
+    INLINE_CONSTEXPR detail::math::float_op_round_even round_even{};
+
+    /// @brief Tag for rounding to the nearest integer, ties towards zero.
+    INLINE_CONSTEXPR detail::math::float_op_round_half_down round_half_down{};
+
+    /// @brief Tag for stochastic rounding: rounds away from zero with a probability equal to the magnitude of the
+    /// discarded fraction, so the expected result is the input itself (see set_stochastic_rng).
+    INLINE_CONSTEXPR detail::math::float_op_stochastic stochastic{};
 } //namespace float_cast_op
 
 /// @brief Casts floating point types to integers by performing the ceiling operation without performing runtime checks.
@@ -462,14 +793,14 @@ namespace float_cast_op
 /// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_unchecked(
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(
     From&& from_val, MAYBE_UNUSED const detail::math::float_op_ceiling tag) noexcept -> To
 {
     (void)tag;
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return detail::math::ceiling<To>(std::forward<From>(from_val));
+    return detail::math::ceiling<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts floating point types to integers by performing the floor operation without performing runtime checks.
@@ -480,14 +811,14 @@ NODISCARD constexpr auto float_cast_unchecked(
 /// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_unchecked(
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(
     From&& from_val, MAYBE_UNUSED const detail::math::float_op_floor tag) noexcept -> To
 {
     (void)tag;
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return detail::math::floor<To>(std::forward<From>(from_val));
+    return detail::math::floor<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts floating point types to integers by performing the round operation without performing runtime checks.
@@ -498,14 +829,14 @@ NODISCARD constexpr auto float_cast_unchecked(
 /// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_unchecked(
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(
     From&& from_val, MAYBE_UNUSED const detail::math::float_op_round tag) noexcept -> To
 {
     (void)tag;
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return detail::math::round<To>(std::forward<From>(from_val));
+    return detail::math::round<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts floating point types to integers by performing the truncate operation without performing runtime checks.
@@ -516,14 +847,75 @@ NODISCARD constexpr auto float_cast_unchecked(
 /// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_unchecked(
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(
     From&& from_val, MAYBE_UNUSED const detail::math::float_op_truncate tag) noexcept -> To
 {
     (void)tag;
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return static_cast<To>(std::forward<From>(from_val));
+    return static_cast<To>(static_cast<From&&>(from_val));
+}
+
+/// @brief Casts floating point types to integers by rounding to the nearest integer (ties to even) without performing
+/// runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @param tag The operation to perform (only used for overload resolution).
+/// @return The casted value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(
+    From&& from_val, MAYBE_UNUSED const detail::math::float_op_round_even tag) noexcept -> To
+{
+    (void)tag;
+    static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::math::round_even<To>(static_cast<From&&>(from_val));
+}
+
+/// @brief Casts floating point types to integers by rounding to the nearest integer (ties towards zero) without
+/// performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @param tag The operation to perform (only used for overload resolution).
+/// @return The casted value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(
+    From&& from_val, MAYBE_UNUSED const detail::math::float_op_round_half_down tag) noexcept -> To
+{
+    (void)tag;
+    static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::math::round_half_down<To>(static_cast<From&&>(from_val));
+}
+
+/// @brief Casts floating point types to integers by performing stochastic rounding without performing runtime checks.
+///
+/// Draws from the stochastic rounding generator (see set_stochastic_rng), so unlike the other operations it is not
+/// constexpr.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @param tag The operation to perform (only used for overload resolution).
+/// @return The casted value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE auto float_cast_unchecked(
+    From&& from_val, MAYBE_UNUSED const detail::math::float_op_stochastic tag) noexcept -> To
+{
+    (void)tag;
+    using val_t = std::remove_cv_t<std::remove_reference_t<From>>;
+
+    static_assert(is_float_castable_v<To, val_t>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::math::stochastic_round<To>(
+        static_cast<val_t>(from_val), detail::math::stochastic_threshold<val_t>());
 }
 
 /// @brief Casts floating point types to integers by performing the default operation without performing runtime checks.
@@ -533,9 +925,9 @@ NODISCARD constexpr auto float_cast_unchecked(
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_unchecked(From&& from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto float_cast_unchecked(From&& from_val) noexcept -> To
 {
-    return float_cast_unchecked<To, From>(std::forward<From>(from_val), detail::math::float_op_default{});
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), detail::math::float_op_default{});
 }
 
 /// @brief Casts floating point types to integers by performing the ceiling operation with performing runtime checks.
@@ -547,26 +939,30 @@ NODISCARD constexpr auto float_cast_unchecked(From&& from_val) noexcept -> To
 /// @return The casted value.
 /// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math::float_op_ceiling tag) -> To
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(
+    From&& from_val, const detail::math::float_op_ceiling tag) -> To
 {
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
+    using bounds = detail::math::int_bounds<To, std::remove_cv_t<std::remove_reference_t<From>>>;
+
     detail::math::check_inf_nan(from_val);
 
-    if (from_val > detail::math::float_const<From>::ZERO
-        && from_val > static_cast<From>((std::numeric_limits<To>::max)()))
+    // Subtracting a bound is exact near that bound, so these compare the rounded value without rounding errors
+    if (UNLIKELY(bounds::has_upper && from_val - bounds::upper > -detail::math::float_const<From>::ONE))
     {
-        throw float_cast_error("float_cast (ceiling) failed: input exceeded max value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (ceiling) failed: input exceeded max value for output type");
     }
 
-    if (from_val < detail::math::float_const<From>::ZERO
-        && from_val + detail::math::float_const<From>::ONE <= static_cast<From>((std::numeric_limits<To>::min)()))
+    if (UNLIKELY(!(from_val - bounds::lower > -detail::math::float_const<From>::ONE)))
     {
-        throw float_cast_error("float_cast (ceiling) failed: input exceeded min value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (ceiling) failed: input exceeded min value for output type");
     }
 
-    return float_cast_unchecked<To, From>(std::forward<From>(from_val), tag);
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
 }
 
 /// @brief Casts floating point types to integers by performing the floor operation with performing runtime checks.
@@ -578,26 +974,28 @@ NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math:
 /// @return The casted value.
 /// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math::float_op_floor tag) -> To
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(From&& from_val, const detail::math::float_op_floor tag) -> To
 {
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
+    using bounds = detail::math::int_bounds<To, std::remove_cv_t<std::remove_reference_t<From>>>;
+
     detail::math::check_inf_nan(from_val);
 
-    if (from_val > detail::math::float_const<From>::ZERO
-        && from_val - detail::math::float_const<From>::ONE >= static_cast<From>((std::numeric_limits<To>::max)()))
+    if (UNLIKELY(bounds::has_upper && !(from_val < bounds::upper)))
     {
-        throw float_cast_error("float_cast (floor) failed: input exceeded max value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (floor) failed: input exceeded max value for output type");
     }
 
-    if (from_val < detail::math::float_const<From>::ZERO
-        && from_val < static_cast<From>((std::numeric_limits<To>::min)()))
+    if (UNLIKELY(from_val < bounds::lower))
     {
-        throw float_cast_error("float_cast (floor) failed: input exceeded min value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (floor) failed: input exceeded min value for output type");
     }
 
-    return float_cast_unchecked<To, From>(std::forward<From>(from_val), tag);
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
 }
 
 /// @brief Casts floating point types to integers by performing the round operation with performing runtime checks.
@@ -609,26 +1007,29 @@ NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math:
 /// @return The casted value.
 /// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math::float_op_round tag) -> To
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(From&& from_val, const detail::math::float_op_round tag) -> To
 {
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
+    using bounds = detail::math::int_bounds<To, std::remove_cv_t<std::remove_reference_t<From>>>;
+
     detail::math::check_inf_nan(from_val);
 
-    if (from_val > detail::math::float_const<From>::ZERO
-        && from_val - detail::math::float_const<From>::HALF >= static_cast<From>((std::numeric_limits<To>::max)()))
+    // Subtracting a bound is exact near that bound, so these compare the rounded value without rounding errors
+    if (UNLIKELY(bounds::has_upper && !(from_val - bounds::upper < -detail::math::float_const<From>::HALF)))
     {
-        throw float_cast_error("float_cast (round) failed: input exceeded max value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (round) failed: input exceeded max value for output type");
     }
 
-    if (from_val < detail::math::float_const<From>::ZERO
-        && from_val + detail::math::float_const<From>::HALF <= static_cast<From>((std::numeric_limits<To>::min)()))
+    if (UNLIKELY(!(from_val - bounds::lower > -detail::math::float_const<From>::HALF)))
     {
-        throw float_cast_error("float_cast (round) failed: input exceeded min value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (round) failed: input exceeded min value for output type");
     }
 
-    return float_cast_unchecked<To, From>(std::forward<From>(from_val), tag);
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
 }
 
 /// @brief Casts floating point types to integers by performing the truncate operation with performing runtime checks.
@@ -640,72 +1041,188 @@ NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math:
 /// @return The casted value.
 /// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_checked(From&& from_val, const detail::math::float_op_truncate tag) -> To
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(
+    From&& from_val, const detail::math::float_op_truncate tag) -> To
 {
     using val_t = std::remove_cv_t<std::remove_reference_t<From>>;
 
     static_assert(is_float_castable_v<To, val_t>, "`From` does not meet the requirements to be casted to a `To`");
 
+    using bounds = detail::math::int_bounds<To, val_t>;
+
     detail::math::check_inf_nan(from_val);
 
-    if (from_val - detail::math::float_const<From>::ONE >= static_cast<val_t>((std::numeric_limits<To>::max)()))
+    if (UNLIKELY(bounds::has_upper && !(from_val < bounds::upper)))
     {
-        throw float_cast_error("float_cast (truncate) failed: input exceeded max value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (truncate) failed: input exceeded max value for output type");
     }
 
-    if (from_val + detail::math::float_const<From>::ONE <= static_cast<val_t>((std::numeric_limits<To>::min)()))
+    // Subtracting the bound is exact near it, so this compares the truncated value without rounding errors
+    if (UNLIKELY(!(from_val - bounds::lower > -detail::math::float_const<From>::ONE)))
     {
-        throw float_cast_error("float_cast (truncate) failed: input exceeded min value for output type");
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (truncate) failed: input exceeded min value for output type");
     }
 
-    return float_cast_unchecked<To, From>(std::forward<From>(from_val), tag);
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
 }
 
-/// @brief Casts floating point types to integers by performing the default operation with performing runtime checks.
+/// @brief Casts floating point types to integers by rounding to the nearest integer (ties to even) with performing
+/// runtime checks.
 ///
 /// @tparam To The type to cast to.
 /// @tparam From The type to cast from.
 /// @param from_val The value to cast.
+/// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
 /// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto float_cast_checked(From&& from_val) -> To
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(
+    From&& from_val, const detail::math::float_op_round_even tag) -> To
 {
-    return float_cast_checked<To, From>(std::forward<From>(from_val), detail::math::float_op_default{});
+    static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    using bounds = detail::math::int_bounds<To, std::remove_cv_t<std::remove_reference_t<From>>>;
+
+    detail::math::check_inf_nan(from_val);
+
+    // Both bounds are even, so a tie next to either one rounds onto it (out of range above, in range below)
+    if (UNLIKELY(bounds::has_upper && !(from_val - bounds::upper < -detail::math::float_const<From>::HALF)))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (round_even) failed: input exceeded max value for output type");
+    }
+
+    if (UNLIKELY(!(from_val - bounds::lower >= -detail::math::float_const<From>::HALF)))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (round_even) failed: input exceeded min value for output type");
+    }
+
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
 }
 
-///@brief Casts floating point types to integers. Based on configuration this will call float_cast_checked.
+/// @brief Casts floating point types to integers by rounding to the nearest integer (ties towards zero) with
+/// performing runtime checks.
 ///
 /// @tparam To The type to cast to.
 /// @tparam From The type to cast from.
 /// @param from_val The value to cast.
-/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
 /// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
-template<typename To, typename From, typename Op = detail::math::float_op_default>
-NODISCARD constexpr auto float_cast(From&& from_val, Op float_op = Op{}) noexcept -> std::enable_if_t<CHECK_CASTS, To>
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(
+    From&& from_val, const detail::math::float_op_round_half_down tag) -> To
 {
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return float_cast_checked<To>(std::forward<From>(from_val), float_op);
+    using bounds = detail::math::int_bounds<To, std::remove_cv_t<std::remove_reference_t<From>>>;
+
+    detail::math::check_inf_nan(from_val);
+
+    // Ties round towards zero, so a tie next to either bound rounds back into range
+    if (UNLIKELY(bounds::has_upper && !(from_val - bounds::upper <= -detail::math::float_const<From>::HALF)))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (round_half_down) failed: input exceeded max value for output type");
+    }
+
+    if (UNLIKELY(!(from_val - bounds::lower >= -detail::math::float_const<From>::HALF)))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (round_half_down) failed: input exceeded min value for output type");
+    }
+
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
 }
 
-///@brief Casts floating point types to integers. Based on configuration this will call float_cast_unchecked.
+/// @brief Casts floating point types to integers by performing stochastic rounding with performing runtime checks.
+///
+/// The check does not depend on the random draw: the value is rejected unless both of its neighbouring integers fit.
 ///
 /// @tparam To The type to cast to.
 /// @tparam From The type to cast from.
 /// @param from_val The value to cast.
-/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @param tag The operation to perform (only used for overload resolution).
 /// @return The casted value.
-template<typename To, typename From, typename Op = detail::math::float_op_default>
-NODISCARD constexpr auto float_cast(From&& from_val, Op float_op = Op{}) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE auto float_cast_checked(From&& from_val, const detail::math::float_op_stochastic tag) -> To
 {
     static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return float_cast_unchecked<To>(std::forward<From>(from_val), float_op);
-}
+    using bounds = detail::math::int_bounds<To, std::remove_cv_t<std::remove_reference_t<From>>>;
+
+    detail::math::check_inf_nan(from_val);
+
+    // The same bounds as ceiling (above) and floor (below), the two results the draw can pick from
+    if (UNLIKELY(bounds::has_upper && from_val - bounds::upper > -detail::math::float_const<From>::ONE))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (stochastic) failed: input exceeded max value for output type");
+    }
+
+    if (UNLIKELY(from_val < bounds::lower))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "float_cast (stochastic) failed: input exceeded min value for output type");
+    }
+
+    return float_cast_unchecked<To, From>(static_cast<From&&>(from_val), tag);
+}
+
+/// @brief Casts floating point types to integers by performing the default operation with performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @return The casted value.
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto float_cast_checked(From&& from_val) -> To
+{
+    return float_cast_checked<To, From>(static_cast<From&&>(from_val), detail::math::float_op_default{});
+}
+
+///@brief Casts floating point types to integers. Based on configuration this will call float_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The casted value.
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From, typename Op = detail::math::float_op_default>
+NODISCARD FORCE_INLINE constexpr auto float_cast(From&& from_val, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS, To>
+{
+    static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return float_cast_checked<To>(static_cast<From&&>(from_val), float_op);
+}
+
+///@brief Casts floating point types to integers. Based on configuration this will call float_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The casted value.
+template<typename To, typename From, typename Op = detail::math::float_op_default>
+NODISCARD FORCE_INLINE constexpr auto float_cast(From&& from_val, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    static_assert(is_float_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return float_cast_unchecked<To>(static_cast<From&&>(from_val), float_op);
+}
 
 /// @brief Type trait to determine if two types are able to be cast via narrow_cast.
 ///
@@ -723,7 +1240,7 @@ template<typename To, typename From>
 struct is_narrow_castable :
     std::integral_constant<bool,
         ((detail::is_smaller_size<To, From> || detail::is_same_size<To, From>)
-            && detail::is_same_sign<To, From> && std::is_arithmetic<To>::value && std::is_arithmetic<From>::value
+            && detail::is_same_sign<To, From> && detail::is_arithmetic<To>::value && detail::is_arithmetic<From>::value
             && !std::is_same<To, bool>::value && !std::is_same<From, bool>::value
             && detail::is_same_arithmetic<To, From> && !std::is_enum<To>::value && !std::is_enum<From>::value)>
 {
@@ -740,12 +1257,12 @@ INLINE_CONSTEXPR bool is_narrow_castable_v = is_narrow_castable<To, From>::value
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto narrow_cast_unchecked(From&& from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto narrow_cast_unchecked(From&& from_val) noexcept -> To
 {
     static_assert(is_narrow_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return static_cast<To>(std::forward<From>(from_val));
+    return static_cast<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts a value to a smaller type with runtime checks.
@@ -756,19 +1273,23 @@ NODISCARD constexpr auto narrow_cast_unchecked(From&& from_val) noexcept -> To
 /// @return The casted value.
 /// @exception narrow_cast_error Thrown if the value exceeds the range of the target type.
 template<typename To, typename From,
-    std::enable_if_t<(sizeof(To) < sizeof(From) && std::is_signed<To>::value), bool> = true>
-NODISCARD constexpr auto narrow_cast_checked(From from_val) noexcept(false) -> To
+    std::enable_if_t<(sizeof(To) < sizeof(From) && detail::is_signed<To>::value), bool> = true>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast_checked(From from_val) noexcept(false) -> To
 {
     static_assert(is_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
-    if (from_val > static_cast<From>((std::numeric_limits<To>::max)()))
+    // Constants, so unoptimized builds do not call numeric_limits at runtime
+    constexpr From upper = static_cast<From>((std::numeric_limits<To>::max)());
+    constexpr From lower = static_cast<From>((std::numeric_limits<To>::lowest)());
+
+    if (UNLIKELY(from_val > upper))
     {
-        throw narrow_cast_error("narrow_cast failed: input exceeded max value for output type");
+        detail::throw_cast_error<narrow_cast_error>("narrow_cast failed: input exceeded max value for output type");
     }
 
-    if (from_val < static_cast<From>((std::numeric_limits<To>::min)()))
+    if (UNLIKELY(from_val < lower))
     {
-        throw narrow_cast_error("narrow_cast failed: input exceeded min value for output type");
+        detail::throw_cast_error<narrow_cast_error>("narrow_cast failed: input exceeded min value for output type");
     }
 
     return static_cast<To>(from_val);
@@ -782,14 +1303,16 @@ NODISCARD constexpr auto narrow_cast_checked(From from_val) noexcept(false) -> T
 /// @return The casted value.
 /// @exception narrow_cast_error Thrown if the value exceeds the range of the target type.
 template<typename To, typename From,
-    std::enable_if_t<(sizeof(To) < sizeof(From) && std::is_unsigned<To>::value), bool> = true>
-NODISCARD constexpr auto narrow_cast_checked(From from_val) noexcept(false) -> To
+    std::enable_if_t<(sizeof(To) < sizeof(From) && detail::is_unsigned<To>::value), bool> = true>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast_checked(From from_val) noexcept(false) -> To
 {
     static_assert(is_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
-    if (from_val > static_cast<From>((std::numeric_limits<To>::max)()))
+    constexpr From upper = static_cast<From>((std::numeric_limits<To>::max)());
+
+    if (UNLIKELY(from_val > upper))
     {
-        throw narrow_cast_error("narrow_cast failed: input exceeded max value for output type");
+        detail::throw_cast_error<narrow_cast_error>("narrow_cast failed: input exceeded max value for output type");
     }
 
     return static_cast<To>(from_val);
@@ -802,7 +1325,7 @@ NODISCARD constexpr auto narrow_cast_checked(From from_val) noexcept(false) -> T
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From, std::enable_if_t<sizeof(To) == sizeof(From), bool> = true>
-NODISCARD constexpr auto narrow_cast_checked(From from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto narrow_cast_checked(From from_val) noexcept -> To
 {
     static_assert(is_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
@@ -817,13 +1340,13 @@ NODISCARD constexpr auto narrow_cast_checked(From from_val) noexcept -> To
 /// @return The casted value.
 /// @exception narrow_cast_error Thrown if the value exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto narrow_cast(From&& from_val) noexcept(sizeof(To) == sizeof(From))
-    -> std::enable_if_t<CHECK_CASTS, To>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast(From&& from_val) noexcept(
+    noexcept(narrow_cast_checked<To>(std::declval<From>()))) -> std::enable_if_t<CHECK_CASTS, To>
 {
     static_assert(is_narrow_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return narrow_cast_checked<To>(std::forward<From>(from_val));
+    return narrow_cast_checked<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts a value to a smaller type. Based on configuration this will call narrow_cast_unchecked.
@@ -833,12 +1356,12 @@ NODISCARD constexpr auto narrow_cast(From&& from_val) noexcept(sizeof(To) == siz
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto narrow_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
 {
     static_assert(is_narrow_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return narrow_cast_unchecked<To>(std::forward<From>(from_val));
+    return narrow_cast_unchecked<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Type trait to determine if two types are able to be cast via sign_cast.
@@ -854,7 +1377,7 @@ NODISCARD constexpr auto narrow_cast(From&& from_val) noexcept -> std::enable_if
 template<typename To, typename From>
 struct is_sign_castable :
     std::integral_constant<bool,
-        (std::is_integral<To>::value && std::is_integral<From>::value
+        (detail::is_integer<To>::value && detail::is_integer<From>::value
             && (detail::is_same_size<To, From> || detail::is_larger_size<To, From>) && !detail::is_same_sign<To, From>)>
 {
 };
@@ -870,10 +1393,11 @@ INLINE_CONSTEXPR bool is_sign_castable_v = is_sign_castable<To, From>::value;
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto sign_cast_unchecked(From&& from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto sign_cast_unchecked(From&& from_val) noexcept -> To
 {
-    static_assert(is_sign_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
-    return static_cast<To>(std::forward<From>(from_val));
+    static_assert(is_sign_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+    return static_cast<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts a value to a different sign with runtime checks.
@@ -883,14 +1407,14 @@ NODISCARD constexpr auto sign_cast_unchecked(From&& from_val) noexcept -> To
 /// @param from_val The value to cast.
 /// @return The casted value.
 /// @exception sign_cast_error Thrown if the value exceeds the range of the target type.
-template<typename To, typename From, std::enable_if_t<std::is_unsigned<To>::value, bool> = true>
-NODISCARD constexpr auto sign_cast_checked(From from_val) noexcept(false) -> To
+template<typename To, typename From, std::enable_if_t<detail::is_unsigned<To>::value, bool> = true>
+NODISCARD FORCE_INLINE constexpr auto sign_cast_checked(From from_val) noexcept(false) -> To
 {
     static_assert(is_sign_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
-    if (from_val < 0)
+    if (UNLIKELY(from_val < 0))
     {
-        throw sign_cast_error("sign_cast failed: cannot cast a negative number to unsigned");
+        detail::throw_cast_error<sign_cast_error>("sign_cast failed: cannot cast a negative number to unsigned");
     }
 
     return static_cast<To>(from_val);
@@ -904,14 +1428,16 @@ NODISCARD constexpr auto sign_cast_checked(From from_val) noexcept(false) -> To
 /// @return The casted value.
 /// @exception sign_cast_error Thrown if the value exceeds the range of the target type.
 template<typename To, typename From,
-    std::enable_if_t<(std::is_signed<To>::value && sizeof(To) == sizeof(From)), bool> = true>
-NODISCARD constexpr auto sign_cast_checked(From from_val) noexcept(false) -> To
+    std::enable_if_t<(detail::is_signed<To>::value && sizeof(To) == sizeof(From)), bool> = true>
+NODISCARD FORCE_INLINE constexpr auto sign_cast_checked(From from_val) noexcept(false) -> To
 {
     static_assert(is_sign_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
-    if (from_val > static_cast<From>((std::numeric_limits<To>::max)()))
+    constexpr From upper = static_cast<From>((std::numeric_limits<To>::max)());
+
+    if (UNLIKELY(from_val > upper))
     {
-        throw sign_cast_error("sign_cast failed: input exceeded max value for output type");
+        detail::throw_cast_error<sign_cast_error>("sign_cast failed: input exceeded max value for output type");
     }
 
     return static_cast<To>(from_val);
@@ -924,8 +1450,8 @@ NODISCARD constexpr auto sign_cast_checked(From from_val) noexcept(false) -> To
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From,
-    std::enable_if_t<(std::is_signed<To>::value && sizeof(To) > sizeof(From)), bool> = true>
-NODISCARD constexpr auto sign_cast_checked(From from_val) noexcept -> To
+    std::enable_if_t<(detail::is_signed<To>::value && sizeof(To) > sizeof(From)), bool> = true>
+NODISCARD FORCE_INLINE constexpr auto sign_cast_checked(From from_val) noexcept -> To
 {
     static_assert(is_sign_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
 
@@ -940,13 +1466,13 @@ NODISCARD constexpr auto sign_cast_checked(From from_val) noexcept -> To
 /// @return The casted value.
 /// @exception sign_cast_error Thrown if the value exceeds the range of the target type.
 template<typename To, typename From>
-NODISCARD constexpr auto sign_cast(From&& from_val) noexcept(std::is_signed<To>::value && sizeof(To) > sizeof(From))
-    -> std::enable_if_t<CHECK_CASTS, To>
+NODISCARD FORCE_INLINE constexpr auto sign_cast(From&& from_val) noexcept(
+    noexcept(sign_cast_checked<To>(std::declval<From>()))) -> std::enable_if_t<CHECK_CASTS, To>
 {
     static_assert(is_sign_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return sign_cast_checked<To>(std::forward<From>(from_val));
+    return sign_cast_checked<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Casts a value to a different sign. Based on configuration this will call sign_cast_unchecked.
@@ -956,18 +1482,79 @@ NODISCARD constexpr auto sign_cast(From&& from_val) noexcept(std::is_signed<To>:
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto sign_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+NODISCARD FORCE_INLINE constexpr auto sign_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
 {
     static_assert(is_sign_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return sign_cast_unchecked<To>(std::forward<From>(from_val));
+    return sign_cast_unchecked<To>(static_cast<From&&>(from_val));
 }
 
+namespace detail
+{
+    namespace pointer
+    {
+        template<typename T>
+        struct is_shared_ptr : std::false_type
+        {
+        };
+
+        template<typename T>
+        struct is_shared_ptr<std::shared_ptr<T>> : std::true_type
+        {
+        };
+
+        template<typename T>
+        struct is_unique_ptr : std::false_type
+        {
+        };
+
+        template<typename T, typename Deleter>
+        struct is_unique_ptr<std::unique_ptr<T, Deleter>> : std::true_type
+        {
+        };
+
+        template<typename T>
+        struct is_smart_pointer : std::integral_constant<bool, is_shared_ptr<T>::value || is_unique_ptr<T>::value>
+        {
+        };
+
+        template<typename T>
+        struct is_default_delete : std::false_type
+        {
+        };
+
+        template<typename T>
+        struct is_default_delete<std::default_delete<T>> : std::true_type
+        {
+        };
+
+        /// The type up_cast and down_cast check against: pointers and shared_ptrs by value whatever the value
+        /// category, unique_ptrs only as rvalues, references as given.
+        template<typename From, typename T = std::remove_cv_t<std::remove_reference_t<From>>>
+        using source_t = std::conditional_t<std::is_pointer<T>::value || is_shared_ptr<T>::value
+                || (is_unique_ptr<T>::value && !std::is_lvalue_reference<From>::value),
+            T, From>;
+
+        /// A unique_ptr owning a @p From may release it to one owning a base @p To only if deleting through the new
+        /// deleter is still correct.
+        template<typename To, typename ToDeleter, typename From, typename FromDeleter>
+        INLINE_CONSTEXPR bool is_deleter_up_castable = std::is_convertible<FromDeleter, ToDeleter>::value
+            && (!is_default_delete<ToDeleter>::value || std::has_virtual_destructor<To>::value);
+
+        template<typename ToDeleter, typename FromDeleter>
+        INLINE_CONSTEXPR bool is_deleter_down_castable = (is_default_delete<ToDeleter>::value
+                                                             && is_default_delete<FromDeleter>::value)
+            || std::is_constructible<ToDeleter, FromDeleter&&>::value;
+    } //namespace pointer
+} // namespace detail
+
 /// @brief Type trait to determine if two types are able to be cast via up_cast.
 ///
 /// In order to be castable, the following conditions must be met:
-/// - @p To and @p From must both be pointers or both be references.
+/// - @p To and @p From must both be pointers, both be references, both be `std::shared_ptr` or both be
+///   `std::unique_ptr` (whose deleter must be convertible and, for `std::default_delete`, @p To must have a
+///   virtual destructor).
 /// - @p To and @p From must be the same const-ness.
 /// - @p To must be a base of @p From.
 ///
@@ -988,22 +1575,429 @@ struct is_up_castable :
 {
 };
 
+template<typename To, typename From>
+struct is_up_castable<std::shared_ptr<To>, std::shared_ptr<From>> : is_up_castable<To*, From*>
+{
+};
+
+template<typename To, typename ToDeleter, typename From, typename FromDeleter>
+struct is_up_castable<std::unique_ptr<To, ToDeleter>, std::unique_ptr<From, FromDeleter>> :
+    std::integral_constant<bool,
+        (is_up_castable<To*, From*>::value
+            && detail::pointer::is_deleter_up_castable<To, ToDeleter, From, FromDeleter>)>
+{
+};
+
 /// @brief Helper variable for retrieving the value from is_up_castable.
 template<typename To, typename From>
 INLINE_CONSTEXPR bool is_up_castable_v = is_up_castable<To, From>::value;
 
-/// @brief Casts a pointer or reference to one of its base types (no runtime checks needed).
+/// @brief Casts a pointer, reference or smart pointer to one of its base types (no runtime checks needed).
+///
+/// Smart pointers passed as rvalues are moved, so a `std::shared_ptr` keeps its reference count untouched.
 ///
 /// @tparam To The type to cast to.
 /// @tparam From The type to cast from.
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto up_cast(From&& from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto up_cast(From&& from_val) noexcept -> To
 {
-    static_assert(is_up_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+    static_assert(is_up_castable_v<To, detail::pointer::source_t<From>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return static_cast<To>(static_cast<From&&>(from_val));
+}
+
+/// @brief Node of an opt-in, RTTI-free class hierarchy used by down_cast.
+///
+/// To opt in, the root class declares `virtual auto dynamic_type_tag() const noexcept -> const casts::type_tag&`,
+/// every class in the hierarchy overrides it to return `casts::type_tag_of<Self>()` and every class below the root
+/// declares `using down_cast_parent = DirectBase;`. down_cast_checked then walks the tag chain instead of using RTTI.
+/// Only single inheritance is modeled; a class that forgets its declarations makes down_cast fail, never succeed.
+struct type_tag
+{
+    const type_tag* parent;
+};
+
+namespace detail
+{
+    namespace down
+    {
+        template<typename...>
+        struct make_void
+        {
+            using type = void;
+        };
+
+        template<typename... Ts>
+        using void_t = typename make_void<Ts...>::type;
 
-    return static_cast<To>(std::forward<From>(from_val));
+        template<typename T>
+        using class_t = std::remove_cv_t<std::remove_pointer_t<std::remove_reference_t<T>>>;
+
+        template<typename T, typename U>
+        using copy_const_t = std::conditional_t<std::is_const<T>::value, const U, U>;
+
+        template<typename To, typename From, typename = void>
+        struct is_static_castable : std::false_type
+        {
+        };
+
+        template<typename To, typename From>
+        struct is_static_castable<To, From, void_t<decltype(static_cast<To*>(std::declval<From*>()))>> :
+            std::true_type
+        {
+        };
+
+        template<typename T, typename = void>
+        struct has_type_tag : std::false_type
+        {
+        };
+
+        template<typename T>
+        struct has_type_tag<T, void_t<decltype(std::declval<const T&>().dynamic_type_tag())>> :
+            std::is_same<decltype(std::declval<const T&>().dynamic_type_tag()), const type_tag&>
+        {
+        };
+
+        template<typename T, typename = void>
+        struct parent_of
+        {
+            using type = void;
+        };
+
+        template<typename T>
+        struct parent_of<T, void_t<typename T::down_cast_parent>>
+        {
+            using type = typename T::down_cast_parent;
+
+            static_assert(std::is_base_of<type, T>::value && !std::is_same<type, T>::value,
+                "`down_cast_parent` must name a base class");
+        };
+
+        template<typename T>
+        struct tag_holder;
+
+        template<typename T>
+        NODISCARD constexpr auto parent_tag(std::true_type /*is_root*/) noexcept -> const type_tag*
+        {
+            return nullptr;
+        }
+
+        template<typename T>
+        NODISCARD constexpr auto parent_tag(std::false_type /*is_root*/) noexcept -> const type_tag*
+        {
+            return &tag_holder<typename parent_of<T>::type>::value;
+        }
+
+        template<typename T>
+        struct tag_holder
+        {
+            static const type_tag value;
+        };
+
+        template<typename T>
+        const type_tag tag_holder<T>::value = { parent_tag<T>(std::is_void<typename parent_of<T>::type>{}) };
+
+        template<typename To>
+        NODISCARD inline auto is_tagged(const type_tag* tag) noexcept -> bool
+        {
+            const type_tag* const target = &tag_holder<To>::value;
+
+            for (; tag != nullptr; tag = tag->parent)
+            {
+                if (tag == target)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template<typename To, typename From>
+        NODISCARD inline auto cast(From* from_ptr, std::true_type /*has_type_tag*/) noexcept -> To*
+        {
+            return is_tagged<std::remove_cv_t<To>>(&from_ptr->dynamic_type_tag()) ? static_cast<To*>(from_ptr)
+                                                                                 : nullptr;
+        }
+
+#ifdef HAS_RTTI
+        struct offset_entry
+        {
+            const std::type_info* type;
+            std::ptrdiff_t from_offset;
+            std::ptrdiff_t to_offset;
+        };
+
+        INLINE_CONSTEXPR std::size_t offset_cache_size = 16;
+
+        /// dynamic_cast that remembers, per thread and per (From, To) pair, where the To subobject lives for each
+        /// (dynamic type, From subobject offset) seen. A hit costs two vtable loads instead of a hierarchy walk.
+        template<typename To, typename From>
+        NODISCARD inline auto cast(From* from_ptr, std::false_type /*has_type_tag*/) -> To*
+        {
+            using byte_ptr_t = copy_const_t<From, char>*;
+            using void_ptr_t = copy_const_t<From, void>*;
+
+            static thread_local offset_entry cache[offset_cache_size] = {};
+
+            // Both only read the vtable: offset-to-top and the type_info pointer
+            auto* const most_derived = static_cast<byte_ptr_t>(dynamic_cast<void_ptr_t>(from_ptr));
+            const std::type_info* const type = &typeid(*from_ptr);
+            const std::ptrdiff_t from_offset =
+                static_cast<byte_ptr_t>(static_cast<void_ptr_t>(from_ptr)) - most_derived;
+
+            auto& entry = cache[(reinterpret_cast<std::uintptr_t>(type) >> 4U) % offset_cache_size];
+            if (entry.type == type && entry.from_offset == from_offset)
+            {
+                return static_cast<To*>(static_cast<void_ptr_t>(most_derived + entry.to_offset));
+            }
+
+            To* const result = dynamic_cast<To*>(from_ptr);
+            if (result != nullptr)
+            {
+                entry = { type, from_offset, static_cast<byte_ptr_t>(static_cast<void_ptr_t>(result)) - most_derived };
+            }
+
+            return result;
+        }
+#else
+        template<typename To, typename From>
+        NODISCARD inline auto cast(From* from_ptr, std::false_type /*has_type_tag*/) -> To*
+        {
+            static_assert(has_type_tag<From>::value,
+                "down_cast_checked requires RTTI or a `dynamic_type_tag()` hierarchy (see casts::type_tag)");
+
+            return from_ptr;
+        }
+#endif
+
+        template<typename To, typename From>
+        NODISCARD inline auto checked_raw(From* from_ptr, std::true_type /*is_pointer*/) -> To
+        {
+            if (from_ptr == nullptr)
+            {
+                return nullptr;
+            }
+
+            To result = cast<std::remove_pointer_t<To>>(from_ptr, has_type_tag<std::remove_cv_t<From>>{});
+            if (UNLIKELY(result == nullptr))
+            {
+                throw_cast_error<down_cast_error>("down_cast failed: object is not an instance of the target type");
+            }
+
+            return result;
+        }
+
+        template<typename To, typename From>
+        NODISCARD inline auto checked_raw(From& from_ref, std::false_type /*is_pointer*/) -> To
+        {
+            auto* const result = cast<std::remove_reference_t<To>>(&from_ref, has_type_tag<std::remove_cv_t<From>>{});
+            if (UNLIKELY(result == nullptr))
+            {
+                throw_cast_error<down_cast_error>("down_cast failed: object is not an instance of the target type");
+            }
+
+            return *result;
+        }
+
+        template<typename To, typename From>
+        NODISCARD inline auto rebind(const std::shared_ptr<From>& from_ptr, typename To::element_type* raw) noexcept
+            -> To
+        {
+            return To(from_ptr, raw);
+        }
+
+        template<typename To, typename From>
+        NODISCARD inline auto rebind(std::shared_ptr<From>&& from_ptr, typename To::element_type* raw) noexcept -> To
+        {
+#if __cplusplus > 201703L
+            return To(std::move(from_ptr), raw);
+#else
+            // The rvalue aliasing constructor is C++20, before that ownership costs one increment and decrement
+            To result(from_ptr, raw);
+            from_ptr.reset();
+            return result;
+#endif
+        }
+
+        template<typename Deleter, typename FromDeleter>
+        NODISCARD inline auto rebind_deleter(FromDeleter&& /*deleter*/, std::true_type /*both_default*/) noexcept
+            -> Deleter
+        {
+            return Deleter{};
+        }
+
+        template<typename Deleter, typename FromDeleter>
+        NODISCARD inline auto rebind_deleter(FromDeleter&& deleter, std::false_type /*both_default*/) noexcept
+            -> Deleter
+        {
+            return Deleter(std::forward<FromDeleter>(deleter));
+        }
+
+        template<typename To, typename From, typename FromDeleter>
+        NODISCARD inline auto rebind(std::unique_ptr<From, FromDeleter>&& from_ptr,
+            typename To::element_type* raw) noexcept -> To
+        {
+            using deleter_t = typename To::deleter_type;
+            using both_default = std::integral_constant<bool,
+                pointer::is_default_delete<deleter_t>::value && pointer::is_default_delete<FromDeleter>::value>;
+
+            To result(raw, rebind_deleter<deleter_t>(std::move(from_ptr.get_deleter()), both_default{}));
+            static_cast<void>(from_ptr.release());
+            return result;
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE constexpr auto unchecked(
+            From&& from_val, std::false_type /*is_smart_pointer*/) noexcept -> To
+        {
+            return static_cast<To>(static_cast<From&&>(from_val));
+        }
+
+        template<typename To, typename Ptr>
+        NODISCARD inline auto unchecked(Ptr&& from_ptr, std::true_type /*is_smart_pointer*/) noexcept -> To
+        {
+            return rebind<To>(
+                std::forward<Ptr>(from_ptr), static_cast<typename To::element_type*>(from_ptr.get()));
+        }
+
+        template<typename To, typename From>
+        NODISCARD inline auto checked(From&& from_val, std::false_type /*is_smart_pointer*/) -> To
+        {
+            return checked_raw<To>(from_val, std::is_pointer<To>{});
+        }
+
+        template<typename To, typename Ptr>
+        NODISCARD inline auto checked(Ptr&& from_ptr, std::true_type /*is_smart_pointer*/) -> To
+        {
+            // Validated before ownership moves, so a failed cast leaves the source untouched
+            auto* const raw = checked_raw<typename To::element_type*>(from_ptr.get(), std::true_type{});
+
+            return rebind<To>(std::forward<Ptr>(from_ptr), raw);
+        }
+    } //namespace down
+} // namespace detail
+
+/// @brief Retrieves the tag identifying @p T in an RTTI-free down_cast hierarchy (see type_tag).
+///
+/// @tparam T The class to retrieve the tag for.
+/// @return The tag for @p T.
+template<typename T>
+NODISCARD constexpr auto type_tag_of() noexcept -> const type_tag&
+{
+    return detail::down::tag_holder<T>::value;
+}
+
+/// @brief Type trait to determine if two types are able to be cast via down_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - @p To and @p From must both be pointers, both be lvalue references, both be `std::shared_ptr` or both be
+///   `std::unique_ptr` (whose deleters must both be `std::default_delete` or @p To's be constructible from
+///   @p From's).
+/// - @p To and @p From must be the same const-ness.
+/// - @p To must be derived from @p From, and not through a virtual base.
+/// - @p From must be polymorphic.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_down_castable :
+    std::integral_constant<bool,
+        (((std::is_pointer<To>::value && std::is_pointer<From>::value)
+             || (std::is_lvalue_reference<To>::value && std::is_lvalue_reference<From>::value))
+            && std::is_const<std::remove_pointer_t<std::remove_reference_t<To>>>::value
+                == std::is_const<std::remove_pointer_t<std::remove_reference_t<From>>>::value
+            && std::is_base_of<detail::down::class_t<From>, detail::down::class_t<To>>::value
+            && !std::is_same<detail::down::class_t<From>, detail::down::class_t<To>>::value
+            && std::is_polymorphic<detail::down::class_t<From>>::value
+            && detail::down::is_static_castable<detail::down::class_t<To>, detail::down::class_t<From>>::value)>
+{
+};
+
+template<typename To, typename From>
+struct is_down_castable<std::shared_ptr<To>, std::shared_ptr<From>> : is_down_castable<To*, From*>
+{
+};
+
+template<typename To, typename ToDeleter, typename From, typename FromDeleter>
+struct is_down_castable<std::unique_ptr<To, ToDeleter>, std::unique_ptr<From, FromDeleter>> :
+    std::integral_constant<bool,
+        (is_down_castable<To*, From*>::value && detail::pointer::is_deleter_down_castable<ToDeleter, FromDeleter>)>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_down_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_down_castable_v = is_down_castable<To, From>::value;
+
+/// @brief Casts a pointer, reference or smart pointer to one of its derived types without performing runtime checks.
+///
+/// Smart pointers passed as rvalues transfer their ownership (without touching the reference count from C++20).
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @return The casted value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto down_cast_unchecked(From&& from_val) noexcept -> To
+{
+    static_assert(is_down_castable_v<To, detail::pointer::source_t<From>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::down::unchecked<To>(static_cast<From&&>(from_val),
+        detail::pointer::is_smart_pointer<std::remove_cv_t<std::remove_reference_t<From>>>{});
+}
+
+/// @brief Casts a pointer, reference or smart pointer to one of its derived types with runtime checks.
+///
+/// Uses the `dynamic_type_tag()` hierarchy when @p From provides one (see type_tag), otherwise `dynamic_cast` with a
+/// per-thread cache of subobject offsets. Null pointers are returned unchanged. A smart pointer that fails the check
+/// keeps its ownership.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @return The casted value.
+/// @exception down_cast_error Thrown if the object is not an instance of the target type.
+template<typename To, typename From>
+NODISCARD inline auto down_cast_checked(From&& from_val) -> To
+{
+    static_assert(is_down_castable_v<To, detail::pointer::source_t<From>>,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::down::checked<To>(std::forward<From>(from_val),
+        detail::pointer::is_smart_pointer<std::remove_cv_t<std::remove_reference_t<From>>>{});
+}
+
+/// @brief Casts a pointer or reference to one of its derived types. Based on configuration this will call
+/// down_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @return The casted value.
+/// @exception down_cast_error Thrown if the object is not an instance of the target type.
+template<typename To, typename From>
+NODISCARD inline auto down_cast(From&& from_val) -> std::enable_if_t<CHECK_CASTS, To>
+{
+    return down_cast_checked<To>(std::forward<From>(from_val));
+}
+
+/// @brief Casts a pointer or reference to one of its derived types. Based on configuration this will call
+/// down_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @return The casted value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto down_cast(From&& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    return down_cast_unchecked<To>(static_cast<From&&>(from_val));
 }
 
 /// @brief Type trait to determine if two types are able to be cast via void_cast.
@@ -1053,12 +2047,12 @@ static_assert(is_void_castable_v<std::nullptr_t, void*>, "Must be able to cast v
 /// @param from_val The value to cast.
 /// @return The casted value.
 template<typename To, typename From>
-NODISCARD constexpr auto void_cast(From&& from_val) noexcept -> To
+NODISCARD FORCE_INLINE constexpr auto void_cast(From&& from_val) noexcept -> To
 {
     static_assert(is_void_castable_v<To, std::remove_cv_t<std::remove_reference_t<From>>>,
         "`From` does not meet the requirements to be casted to a `To`");
 
-    return static_cast<To>(std::forward<From>(from_val));
+    return static_cast<To>(static_cast<From&&>(from_val));
 }
 } // namespace casts
 
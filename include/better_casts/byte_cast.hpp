@@ -0,0 +1,387 @@
+///@file byte_cast.hpp
+///@author Jackson Harmer
+///@brief Endian-aware loads and stores of values from byte buffers, and a C++14 bit_cast.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_BYTE_CAST_HPP
+#define BETTER_CASTS_BYTE_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/family.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <stdlib.h>
+#endif
+
+namespace casts
+{
+/// @brief Byte order of a value in memory (mirrors C++20 `std::endian`).
+enum class endian
+{
+    little,
+    big,
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    native = big,
+#else
+    native = little,
+#endif
+};
+
+/// @brief Reinterprets the object representation of @p from_val as a @p To (backport of C++20 `std::bit_cast`).
+///
+/// Like `std::bit_cast`, @p To does not need to be default constructible.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param from_val The value to cast.
+/// @return The casted value.
+/// @note Unlike `std::bit_cast`, this is not `constexpr`.
+template<typename To, typename From>
+NODISCARD inline auto bit_cast(const From& from_val) noexcept -> To
+{
+    static_assert(sizeof(To) == sizeof(From), "`To` and `From` must be the same size");
+    static_assert(std::is_trivially_copyable<To>::value && std::is_trivially_copyable<From>::value,
+        "`To` and `From` must be trivially copyable");
+
+    // Copying the bytes into suitably aligned storage creates the (trivially copyable) To object in it
+    alignas(To) unsigned char storage[sizeof(To)];
+    std::memcpy(storage, &from_val, sizeof(To));
+
+    const void* raw = storage;
+    return *void_cast<const To*>(raw);
+}
+
+namespace detail
+{
+    namespace bytes
+    {
+        template<std::size_t Size>
+        struct uint_of_size
+        {
+        };
+
+        template<>
+        struct uint_of_size<1>
+        {
+            using type = std::uint8_t;
+        };
+
+        template<>
+        struct uint_of_size<2>
+        {
+            using type = std::uint16_t;
+        };
+
+        template<>
+        struct uint_of_size<4>
+        {
+            using type = std::uint32_t;
+        };
+
+        template<>
+        struct uint_of_size<8>
+        {
+            using type = std::uint64_t;
+        };
+
+#ifdef __SIZEOF_INT128__
+        template<>
+        struct uint_of_size<16>
+        {
+            using type = uint128_t;
+        };
+#endif
+
+        template<typename T>
+        struct is_byte : std::integral_constant<bool,
+                             std::is_same<T, char>::value || std::is_same<T, unsigned char>::value
+#ifdef __cpp_lib_byte
+                                 || std::is_same<T, std::byte>::value
+#endif
+                             >
+        {
+        };
+
+        NODISCARD inline auto byteswap(std::uint8_t val) noexcept -> std::uint8_t
+        {
+            return val;
+        }
+
+        NODISCARD inline auto byteswap(std::uint16_t val) noexcept -> std::uint16_t
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap16(val);
+#elif defined(_MSC_VER)
+            return _byteswap_ushort(val);
+#else
+            return static_cast<std::uint16_t>((val << 8U) | (val >> 8U));
+#endif
+        }
+
+        NODISCARD inline auto byteswap(std::uint32_t val) noexcept -> std::uint32_t
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap32(val);
+#elif defined(_MSC_VER)
+            return _byteswap_ulong(val);
+#else
+            return (static_cast<std::uint32_t>(byteswap(static_cast<std::uint16_t>(val))) << 16U)
+                | byteswap(static_cast<std::uint16_t>(val >> 16U));
+#endif
+        }
+
+        NODISCARD inline auto byteswap(std::uint64_t val) noexcept -> std::uint64_t
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap64(val);
+#elif defined(_MSC_VER)
+            return _byteswap_uint64(val);
+#else
+            return (static_cast<std::uint64_t>(byteswap(static_cast<std::uint32_t>(val))) << 32U)
+                | byteswap(static_cast<std::uint32_t>(val >> 32U));
+#endif
+        }
+
+#ifdef __SIZEOF_INT128__
+        NODISCARD inline auto byteswap(uint128_t val) noexcept -> uint128_t
+        {
+            return (static_cast<uint128_t>(byteswap(static_cast<std::uint64_t>(val))) << 64U)
+                | byteswap(static_cast<std::uint64_t>(val >> 64U));
+        }
+#endif
+
+        template<typename T>
+        NODISCARD inline auto swap_if(T val, std::true_type /*swap*/) noexcept -> T
+        {
+            return byteswap(val);
+        }
+
+        template<typename T>
+        NODISCARD inline auto swap_if(T val, std::false_type /*swap*/) noexcept -> T
+        {
+            return val;
+        }
+
+        template<endian Order>
+        using needs_swap = std::integral_constant<bool, Order != endian::native>;
+
+        template<typename T, endian Order>
+        NODISCARD inline auto load(const void* src) noexcept -> T
+        {
+            using raw_t = typename uint_of_size<sizeof(T)>::type;
+
+            // A fixed size memcpy is the portable way to express an unaligned load; it compiles to a single mov
+            // (or movbe when the swap can be folded into the load)
+            raw_t raw;
+            std::memcpy(&raw, src, sizeof(raw));
+            return bit_cast<T>(swap_if(raw, needs_swap<Order>{}));
+        }
+
+        template<endian Order, typename T>
+        inline void store(void* dst, T val) noexcept
+        {
+            using raw_t = typename uint_of_size<sizeof(T)>::type;
+
+            const raw_t raw = swap_if(bit_cast<raw_t>(val), needs_swap<Order>{});
+            std::memcpy(dst, &raw, sizeof(raw));
+        }
+    } //namespace bytes
+} // namespace detail
+
+/// @brief Type trait to determine if a type can be loaded from (or stored to) a byte buffer via load_cast/store_cast.
+///
+/// In order to be loadable, the following conditions must be met:
+/// - @p T must be an arithmetic type or an enum (cannot be a long double or bool, as a byte other than 0 or 1 is not
+///   a valid bool).
+/// - The size of @p T must be 1, 2, 4, 8 (or 16 for 128-bit integers).
+///
+/// @tparam T The type to load or store.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename T>
+struct is_byte_loadable :
+    std::integral_constant<bool,
+        ((detail::is_arithmetic<T>::value || std::is_enum<T>::value) && !std::is_same<T, long double>::value
+            && !std::is_same<std::remove_cv_t<T>, bool>::value
+            && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8
+                || (sizeof(T) == 16 && detail::is_integer<T>::value)))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_byte_loadable.
+template<typename T>
+INLINE_CONSTEXPR bool is_byte_loadable_v = is_byte_loadable<T>::value;
+
+/// @brief Loads a @p T stored in @p Order byte order from a (possibly unaligned) byte buffer.
+///
+/// @tparam T The type to load.
+/// @tparam Order The byte order of the value in the buffer.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param src Pointer to the first of `sizeof(T)` bytes to load.
+/// @return The loaded value.
+template<typename T, endian Order = endian::native, typename Byte>
+NODISCARD inline auto load_cast(const Byte* src) noexcept -> std::enable_if_t<detail::bytes::is_byte<Byte>::value, T>
+{
+    static_assert(is_byte_loadable_v<T>, "`T` cannot be loaded from a byte buffer");
+
+    return detail::bytes::load<T, Order>(src);
+}
+
+/// @brief Loads a @p Wire value in @p Order byte order and casts it to a @p To without performing runtime checks.
+///
+/// The conversion uses the cast family matching @p To and @p Wire (enum_cast, narrow_cast, sign_cast or float_cast).
+///
+/// @tparam To The type to cast to.
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order of the value in the buffer.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param src Pointer to the first of `sizeof(Wire)` bytes to load.
+/// @return The loaded and casted value.
+template<typename To, typename Wire, endian Order = endian::native, typename Byte>
+NODISCARD inline auto load_cast_unchecked(const Byte* src) noexcept
+    -> std::enable_if_t<detail::bytes::is_byte<Byte>::value, To>
+{
+    static_assert(is_byte_loadable_v<Wire>, "`Wire` cannot be loaded from a byte buffer");
+
+    return detail::family::convert<false, To>(detail::bytes::load<Wire, Order>(src));
+}
+
+/// @brief Loads a @p Wire value in @p Order byte order and casts it to a @p To with runtime checks.
+///
+/// The conversion uses the cast family matching @p To and @p Wire (enum_cast, narrow_cast, sign_cast or float_cast).
+///
+/// @tparam To The type to cast to.
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order of the value in the buffer.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param src Pointer to the first of `sizeof(Wire)` bytes to load.
+/// @return The loaded and casted value.
+/// @exception cast_error The error of the matching cast family if the value cannot be represented by @p To.
+template<typename To, typename Wire, endian Order = endian::native, typename Byte>
+NODISCARD inline auto load_cast_checked(const Byte* src) -> std::enable_if_t<detail::bytes::is_byte<Byte>::value, To>
+{
+    static_assert(is_byte_loadable_v<Wire>, "`Wire` cannot be loaded from a byte buffer");
+
+    return detail::family::convert<true, To>(detail::bytes::load<Wire, Order>(src));
+}
+
+/// @brief Loads a @p Wire value and casts it to a @p To. Based on configuration this will call load_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order of the value in the buffer.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param src Pointer to the first of `sizeof(Wire)` bytes to load.
+/// @return The loaded and casted value.
+/// @exception cast_error The error of the matching cast family if the value cannot be represented by @p To.
+template<typename To, typename Wire, endian Order = endian::native, typename Byte>
+NODISCARD inline auto load_cast(const Byte* src)
+    -> std::enable_if_t<CHECK_CASTS && detail::bytes::is_byte<Byte>::value, To>
+{
+    return load_cast_checked<To, Wire, Order>(src);
+}
+
+/// @brief Loads a @p Wire value and casts it to a @p To. Based on configuration this will call load_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order of the value in the buffer.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param src Pointer to the first of `sizeof(Wire)` bytes to load.
+/// @return The loaded and casted value.
+template<typename To, typename Wire, endian Order = endian::native, typename Byte>
+NODISCARD inline auto load_cast(const Byte* src) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && detail::bytes::is_byte<Byte>::value, To>
+{
+    return load_cast_unchecked<To, Wire, Order>(src);
+}
+
+/// @brief Stores a @p T in @p Order byte order to a (possibly unaligned) byte buffer.
+///
+/// @tparam Order The byte order to store the value in.
+/// @tparam T The type to store.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param dst Pointer to storage for `sizeof(T)` bytes.
+/// @param val The value to store.
+template<endian Order = endian::native, typename T, typename Byte>
+inline auto store_cast(Byte* dst, T val) noexcept -> std::enable_if_t<detail::bytes::is_byte<Byte>::value>
+{
+    static_assert(is_byte_loadable_v<T>, "`T` cannot be stored to a byte buffer");
+
+    detail::bytes::store<Order>(dst, val);
+}
+
+/// @brief Casts @p from_val to a @p Wire and stores it in @p Order byte order without performing runtime checks.
+///
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order to store the value in.
+/// @tparam From The type to cast from.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param dst Pointer to storage for `sizeof(Wire)` bytes.
+/// @param from_val The value to cast and store.
+template<typename Wire, endian Order = endian::native, typename From, typename Byte>
+inline auto store_cast_unchecked(Byte* dst, From from_val) noexcept
+    -> std::enable_if_t<detail::bytes::is_byte<Byte>::value>
+{
+    static_assert(is_byte_loadable_v<Wire>, "`Wire` cannot be stored to a byte buffer");
+
+    detail::bytes::store<Order>(dst, detail::family::convert<false, Wire>(from_val));
+}
+
+/// @brief Casts @p from_val to a @p Wire and stores it in @p Order byte order with runtime checks.
+///
+/// Nothing is written to @p dst if the cast fails.
+///
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order to store the value in.
+/// @tparam From The type to cast from.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param dst Pointer to storage for `sizeof(Wire)` bytes.
+/// @param from_val The value to cast and store.
+/// @exception cast_error The error of the matching cast family if the value cannot be represented by @p Wire.
+template<typename Wire, endian Order = endian::native, typename From, typename Byte>
+inline auto store_cast_checked(Byte* dst, From from_val) -> std::enable_if_t<detail::bytes::is_byte<Byte>::value>
+{
+    static_assert(is_byte_loadable_v<Wire>, "`Wire` cannot be stored to a byte buffer");
+
+    detail::bytes::store<Order>(dst, detail::family::convert<true, Wire>(from_val));
+}
+
+/// @brief Casts @p from_val to a @p Wire and stores it. Based on configuration this will call store_cast_checked.
+///
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order to store the value in.
+/// @tparam From The type to cast from.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param dst Pointer to storage for `sizeof(Wire)` bytes.
+/// @param from_val The value to cast and store.
+/// @exception cast_error The error of the matching cast family if the value cannot be represented by @p Wire.
+template<typename Wire, endian Order = endian::native, typename From, typename Byte>
+inline auto store_cast(Byte* dst, From from_val)
+    -> std::enable_if_t<CHECK_CASTS && detail::bytes::is_byte<Byte>::value>
+{
+    store_cast_checked<Wire, Order>(dst, from_val);
+}
+
+/// @brief Casts @p from_val to a @p Wire and stores it. Based on configuration this will call store_cast_unchecked.
+///
+/// @tparam Wire The type of the value in the buffer.
+/// @tparam Order The byte order to store the value in.
+/// @tparam From The type to cast from.
+/// @tparam Byte The byte type of the buffer (char, unsigned char or std::byte).
+/// @param dst Pointer to storage for `sizeof(Wire)` bytes.
+/// @param from_val The value to cast and store.
+template<typename Wire, endian Order = endian::native, typename From, typename Byte>
+inline auto store_cast(Byte* dst, From from_val) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && detail::bytes::is_byte<Byte>::value>
+{
+    store_cast_unchecked<Wire, Order>(dst, from_val);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_BYTE_CAST_HPP
@@ -0,0 +1,344 @@
+///@file checked_int.hpp
+///@author Jackson Harmer
+///@brief Integer wrapper that records overflow in a sticky flag, validated when the value is extracted with a cast.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_CHECKED_INT_HPP
+#define BETTER_CASTS_CHECKED_INT_HPP
+
+#include "../better_casts.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace casts
+{
+namespace detail
+{
+    namespace checked
+    {
+        /// The type a checked_int<T> computes in: 64 bits for the narrower integers, so that intermediate results
+        /// only need to fit T at the final cast, and T itself otherwise.
+        template<typename T, bool = (sizeof(T) < sizeof(std::int64_t))>
+        struct wide
+        {
+            using type = T;
+        };
+
+        template<typename T>
+        struct wide<T, true>
+        {
+            using type = std::conditional_t<is_signed<T>::value, std::int64_t, std::uint64_t>;
+        };
+
+        template<typename T>
+        using wide_t = typename wide<T>::type;
+
+#if defined(__GNUC__)
+        template<typename W>
+        NODISCARD FORCE_INLINE constexpr auto add_overflow(W lhs, W rhs, W& result) noexcept -> bool
+        {
+            return __builtin_add_overflow(lhs, rhs, &result);
+        }
+
+        template<typename W>
+        NODISCARD FORCE_INLINE constexpr auto sub_overflow(W lhs, W rhs, W& result) noexcept -> bool
+        {
+            return __builtin_sub_overflow(lhs, rhs, &result);
+        }
+
+        template<typename W>
+        NODISCARD FORCE_INLINE constexpr auto mul_overflow(W lhs, W rhs, W& result) noexcept -> bool
+        {
+            return __builtin_mul_overflow(lhs, rhs, &result);
+        }
+#else
+        // Portable versions: the operation wraps in the unsigned type, then the operands and result reveal overflow
+        template<typename W>
+        NODISCARD FORCE_INLINE constexpr auto add_overflow(W lhs, W rhs, W& result) noexcept -> bool
+        {
+            using U = make_unsigned_t<W>;
+            result = static_cast<W>(static_cast<U>(lhs) + static_cast<U>(rhs));
+
+            return is_signed<W>::value ? ((lhs ^ result) & (rhs ^ result)) < W{ 0 } : result < lhs;
+        }
+
+        template<typename W>
+        NODISCARD FORCE_INLINE constexpr auto sub_overflow(W lhs, W rhs, W& result) noexcept -> bool
+        {
+            using U = make_unsigned_t<W>;
+            result = static_cast<W>(static_cast<U>(lhs) - static_cast<U>(rhs));
+
+            return is_signed<W>::value ? ((lhs ^ rhs) & (lhs ^ result)) < W{ 0 } : lhs < rhs;
+        }
+
+        template<typename W>
+        NODISCARD FORCE_INLINE constexpr auto mul_overflow(W lhs, W rhs, W& result) noexcept -> bool
+        {
+            using U = make_unsigned_t<W>;
+            result = static_cast<W>(static_cast<U>(lhs) * static_cast<U>(rhs));
+
+            if (lhs == W{ 0 } || rhs == W{ 0 })
+            {
+                return false;
+            }
+
+            // -1 times the minimum is the one product that division cannot verify
+            if (is_signed<W>::value && (lhs == static_cast<W>(-1) || rhs == static_cast<W>(-1)))
+            {
+                return lhs == (std::numeric_limits<W>::min)() || rhs == (std::numeric_limits<W>::min)();
+            }
+
+            return result / rhs != lhs;
+        }
+#endif
+
+        /// True if @p val (a non-negative value, or any value of the same sign as @p To) exceeds the max of @p To.
+        template<typename To, typename W>
+        NODISCARD FORCE_INLINE constexpr auto exceeds_max(W val) noexcept -> bool
+        {
+            using U = make_unsigned_t<std::conditional_t<(sizeof(To) > sizeof(W)), To, W>>;
+
+            return val > W{ 0 } && static_cast<U>(val) > static_cast<U>((std::numeric_limits<To>::max)());
+        }
+
+        template<typename To, typename W, std::enable_if_t<is_unsigned<W>::value, bool> = true>
+        NODISCARD FORCE_INLINE constexpr auto exceeds_min(W /*val*/) noexcept -> bool
+        {
+            return false;
+        }
+
+        template<typename To, typename W, std::enable_if_t<is_signed<W>::value, bool> = true>
+        NODISCARD FORCE_INLINE constexpr auto exceeds_min(W val) noexcept -> bool
+        {
+            return is_unsigned<To>::value ? val < W{ 0 } : val < static_cast<W>((std::numeric_limits<To>::min)());
+        }
+    } //namespace checked
+} // namespace detail
+
+/// @brief Integer that records arithmetic overflow instead of checking it, so that a chain of operations (ex. a
+/// reduction loop) is validated once, when the result is extracted with narrow_cast or sign_cast.
+///
+/// Integers narrower than 64 bits are computed in a 64-bit integer of the same sign, so intermediate results may
+/// leave the range of @p T as long as the final value fits the cast's output type. Overflow of the computation type
+/// (and, for unsigned types, results below zero) sets a sticky flag that the checked casts report.
+///
+/// @tparam T The integral type of the values.
+template<typename T>
+class checked_int
+{
+    static_assert(detail::is_integer<T>::value && !std::is_same<T, bool>::value, "T must be an integral type");
+
+public:
+    using value_type = T;
+    using wide_type = detail::checked::wide_t<T>;
+
+    /// @brief Constructs a zero.
+    constexpr checked_int() noexcept = default;
+
+    /// @brief Constructs a checked_int holding @p val.
+    constexpr checked_int(T val) noexcept : m_value(val) {}
+
+    /// @brief Returns true if any operation leading to this value overflowed.
+    NODISCARD constexpr auto overflowed() const noexcept -> bool
+    {
+        return m_overflow;
+    }
+
+    /// @brief Returns the computed value without any checks (meaningless if overflowed() is true, and may exceed the
+    /// range of @p T).
+    NODISCARD constexpr auto wide_value() const noexcept -> wide_type
+    {
+        return m_value;
+    }
+
+    constexpr auto operator+=(checked_int rhs) noexcept -> checked_int&
+    {
+        // Bitwise, so that the flag does not add a branch to the computation
+        m_overflow = m_overflow | rhs.m_overflow | detail::checked::add_overflow(m_value, rhs.m_value, m_value);
+        return *this;
+    }
+
+    constexpr auto operator-=(checked_int rhs) noexcept -> checked_int&
+    {
+        m_overflow = m_overflow | rhs.m_overflow | detail::checked::sub_overflow(m_value, rhs.m_value, m_value);
+        return *this;
+    }
+
+    constexpr auto operator*=(checked_int rhs) noexcept -> checked_int&
+    {
+        m_overflow = m_overflow | rhs.m_overflow | detail::checked::mul_overflow(m_value, rhs.m_value, m_value);
+        return *this;
+    }
+
+    NODISCARD friend constexpr auto operator+(checked_int lhs, checked_int rhs) noexcept -> checked_int
+    {
+        return lhs += rhs;
+    }
+
+    NODISCARD friend constexpr auto operator-(checked_int lhs, checked_int rhs) noexcept -> checked_int
+    {
+        return lhs -= rhs;
+    }
+
+    NODISCARD friend constexpr auto operator*(checked_int lhs, checked_int rhs) noexcept -> checked_int
+    {
+        return lhs *= rhs;
+    }
+
+    NODISCARD friend constexpr auto operator-(checked_int val) noexcept -> checked_int
+    {
+        return checked_int{} -= val;
+    }
+
+private:
+    wide_type m_value{};
+    bool m_overflow{ false };
+};
+
+/// @brief Extracts the value of a checked_int without performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast_unchecked(checked_int<T> from_val) noexcept -> To
+{
+    static_assert(is_narrow_castable_v<To, T>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return static_cast<To>(from_val.wide_value());
+}
+
+/// @brief Extracts the value of a checked_int with runtime checks, validating every operation that produced it.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+/// @exception narrow_cast_error Thrown if an operation overflowed or the value exceeds the range of the target type.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast_checked(checked_int<T> from_val) -> To
+{
+    static_assert(is_narrow_castable_v<To, T>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(from_val.overflowed()))
+    {
+        detail::throw_cast_error<narrow_cast_error>("narrow_cast failed: arithmetic overflowed before the cast");
+    }
+
+    if (UNLIKELY(detail::checked::exceeds_max<To>(from_val.wide_value())))
+    {
+        detail::throw_cast_error<narrow_cast_error>("narrow_cast failed: input exceeded max value for output type");
+    }
+
+    if (UNLIKELY(detail::checked::exceeds_min<To>(from_val.wide_value())))
+    {
+        detail::throw_cast_error<narrow_cast_error>("narrow_cast failed: input exceeded min value for output type");
+    }
+
+    return static_cast<To>(from_val.wide_value());
+}
+
+/// @brief Extracts the value of a checked_int. Based on configuration this will call narrow_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+/// @exception narrow_cast_error Thrown if an operation overflowed or the value exceeds the range of the target type.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast(checked_int<T> from_val) -> std::enable_if_t<CHECK_CASTS, To>
+{
+    return narrow_cast_checked<To>(from_val);
+}
+
+/// @brief Extracts the value of a checked_int. Based on configuration this will call narrow_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto narrow_cast(checked_int<T> from_val) noexcept
+    -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    return narrow_cast_unchecked<To>(from_val);
+}
+
+/// @brief Extracts the value of a checked_int as a different sign without performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto sign_cast_unchecked(checked_int<T> from_val) noexcept -> To
+{
+    static_assert(is_sign_castable_v<To, T>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return static_cast<To>(from_val.wide_value());
+}
+
+/// @brief Extracts the value of a checked_int as a different sign with runtime checks, validating every operation
+/// that produced it.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+/// @exception sign_cast_error Thrown if an operation overflowed or the value exceeds the range of the target type.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto sign_cast_checked(checked_int<T> from_val) -> To
+{
+    static_assert(is_sign_castable_v<To, T>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(from_val.overflowed()))
+    {
+        detail::throw_cast_error<sign_cast_error>("sign_cast failed: arithmetic overflowed before the cast");
+    }
+
+    if (UNLIKELY(detail::checked::exceeds_max<To>(from_val.wide_value())))
+    {
+        detail::throw_cast_error<sign_cast_error>("sign_cast failed: input exceeded max value for output type");
+    }
+
+    if (UNLIKELY(detail::checked::exceeds_min<To>(from_val.wide_value())))
+    {
+        detail::throw_cast_error<sign_cast_error>("sign_cast failed: cannot cast a negative number to unsigned");
+    }
+
+    return static_cast<To>(from_val.wide_value());
+}
+
+/// @brief Extracts the value of a checked_int as a different sign. Based on configuration this will call
+/// sign_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+/// @exception sign_cast_error Thrown if an operation overflowed or the value exceeds the range of the target type.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto sign_cast(checked_int<T> from_val) -> std::enable_if_t<CHECK_CASTS, To>
+{
+    return sign_cast_checked<To>(from_val);
+}
+
+/// @brief Extracts the value of a checked_int as a different sign. Based on configuration this will call
+/// sign_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam T The value type of the checked_int.
+/// @param from_val The checked_int to extract the value of.
+/// @return The casted value.
+template<typename To, typename T>
+NODISCARD FORCE_INLINE constexpr auto sign_cast(checked_int<T> from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    return sign_cast_unchecked<To>(from_val);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_CHECKED_INT_HPP
@@ -0,0 +1,464 @@
+///@file chrono_cast.hpp
+///@author Jackson Harmer
+///@brief Range-checked casts between std::chrono durations and time points with selectable rounding.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_CHRONO_CAST_HPP
+#define BETTER_CASTS_CHRONO_CAST_HPP
+
+#include "../better_casts.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <string>
+#include <type_traits>
+
+namespace casts
+{
+namespace detail
+{
+    namespace chrono
+    {
+        /// Uniform access to the tick count of durations and time points (`valid` is false for anything else).
+        template<typename T>
+        struct traits
+        {
+            static constexpr bool valid = false;
+        };
+
+        template<typename Rep, typename Period>
+        struct traits<std::chrono::duration<Rep, Period>>
+        {
+            using type = std::chrono::duration<Rep, Period>;
+            using rep = Rep;
+            using period = Period;
+            using clock = void;
+
+            static constexpr bool valid = true;
+
+            NODISCARD static constexpr auto count(const type& val) noexcept -> rep { return val.count(); }
+            NODISCARD static constexpr auto make(rep ticks) noexcept -> type { return type{ ticks }; }
+        };
+
+        template<typename Clock, typename Duration>
+        struct traits<std::chrono::time_point<Clock, Duration>>
+        {
+            using type = std::chrono::time_point<Clock, Duration>;
+            using rep = typename Duration::rep;
+            using period = typename Duration::period;
+            using clock = Clock;
+
+            static constexpr bool valid = true;
+
+            NODISCARD static constexpr auto count(const type& val) noexcept -> rep
+            {
+                return val.time_since_epoch().count();
+            }
+
+            NODISCARD static constexpr auto make(rep ticks) noexcept -> type { return type{ Duration{ ticks } }; }
+        };
+
+        template<typename Rep>
+        INLINE_CONSTEXPR bool is_tick_rep = is_integer<Rep>::value && !std::is_same<Rep, bool>::value
+            && sizeof(Rep) <= sizeof(std::intmax_t);
+
+        /// Integer type the conversion is computed in (wide enough for any tick count of the same sign).
+        template<typename Rep>
+        using wide_t = std::conditional_t<is_signed<Rep>::value, std::intmax_t, std::uintmax_t>;
+
+        /// Divides @p num by the positive @p den, rounding the quotient as requested.
+        template<typename Wide>
+        NODISCARD constexpr auto div_round(Wide num, Wide den, MAYBE_UNUSED math::float_op_truncate tag) noexcept
+            -> Wide
+        {
+            (void)tag;
+            return num / den;
+        }
+
+        template<typename Wide>
+        NODISCARD constexpr auto div_round(Wide num, Wide den, MAYBE_UNUSED math::float_op_floor tag) noexcept -> Wide
+        {
+            (void)tag;
+            return num / den - (num % den < Wide{ 0 } ? Wide{ 1 } : Wide{ 0 });
+        }
+
+        template<typename Wide>
+        NODISCARD constexpr auto div_round(Wide num, Wide den, MAYBE_UNUSED math::float_op_ceiling tag) noexcept
+            -> Wide
+        {
+            (void)tag;
+            return num / den + (num % den > Wide{ 0 } ? Wide{ 1 } : Wide{ 0 });
+        }
+
+        /// Rounds half away from zero, like float_cast.
+        template<typename Wide>
+        NODISCARD constexpr auto div_round(Wide num, Wide den, MAYBE_UNUSED math::float_op_round tag) noexcept -> Wide
+        {
+            (void)tag;
+            const Wide rem = num % den;
+            const Wide mag = rem < Wide{ 0 } ? Wide{ 0 } - rem : rem;
+            const Wide away = rem < Wide{ 0 } ? Wide{ 0 } - Wide{ 1 } : Wide{ 1 };
+
+            // Written without branches so batch loops stay vectorizable
+            return num / den + (mag >= den - mag ? away : Wide{ 0 });
+        }
+
+        /// Scales a tick count by Ratio (the source period in units of the target period) without overflow checks.
+        ///
+        /// Splitting off the quotient keeps every intermediate within the final result, so unlike `val * num / den`
+        /// (which needs 128 bits to be exact) it never overflows when the result is representable.
+        template<typename Ratio, typename Wide, typename Op>
+        NODISCARD constexpr auto scale(Wide val, Op tag) noexcept -> Wide
+        {
+            constexpr auto num = static_cast<Wide>(Ratio::num);
+            constexpr auto den = static_cast<Wide>(Ratio::den);
+
+            return val / den * num + div_round<Wide>(val % den * num, den, tag);
+        }
+
+        /// Returns a positive value if scaling @p val exceeds the max of @p ToRep, negative if it exceeds the min and
+        /// zero if it fits. Never overflows.
+        template<typename ToRep, typename Ratio, typename Wide, typename Op>
+        NODISCARD constexpr auto compare_range(Wide val, Op tag) noexcept -> int
+        {
+            constexpr auto num = static_cast<Wide>(Ratio::num);
+            constexpr auto den = static_cast<Wide>(Ratio::den);
+            constexpr auto max = static_cast<Wide>((std::numeric_limits<ToRep>::max)());
+            constexpr auto min = static_cast<Wide>((std::numeric_limits<ToRep>::min)());
+
+            // The quotient and the rounded fraction share the sign of val, so only one bound can be exceeded
+            const Wide quot = val / den;
+            const Wide frac = div_round<Wide>(val % den * num, den, tag);
+
+            if (!(val < Wide{ 0 }))
+            {
+                return quot > max / num || frac > max - quot * num ? 1 : 0;
+            }
+
+            return quot < min / num || frac < min - quot * num ? -1 : 0;
+        }
+
+        /// Bisects between a tick count that fits @p ToRep and one that does not (scaling is monotonic), returning the
+        /// last one that fits.
+        template<typename ToRep, typename Ratio, typename Wide, typename Op>
+        NODISCARD constexpr auto search_bound(Wide valid, Wide invalid) noexcept -> Wide
+        {
+            while ((invalid - valid) / 2 != Wide{ 0 })
+            {
+                const Wide mid = valid + (invalid - valid) / 2;
+
+                if (compare_range<ToRep, Ratio>(mid, Op{}) == 0)
+                {
+                    valid = mid;
+                }
+                else
+                {
+                    invalid = mid;
+                }
+            }
+
+            return valid;
+        }
+
+        template<typename ToRep, typename Ratio, typename Wide, typename Op>
+        NODISCARD constexpr auto find_bound(Wide limit) noexcept -> Wide
+        {
+            // Zero always fits, so it seeds the search when the limit does not
+            return compare_range<ToRep, Ratio>(limit, Op{}) == 0
+                ? limit
+                : search_bound<ToRep, Ratio, Wide, Op>(Wide{ 0 }, limit);
+        }
+
+        /// Smallest and largest tick counts of @p FromRep that scale into the range of @p ToRep.
+        ///
+        /// Found at compile time, so casts check each value with two compares instead of repeating the overflow
+        /// analysis.
+        template<typename ToRep, typename FromRep, typename Ratio, typename Op>
+        struct input_bounds
+        {
+            static constexpr wide_t<FromRep> lower =
+                find_bound<ToRep, Ratio, wide_t<FromRep>, Op>((std::numeric_limits<FromRep>::min)());
+            static constexpr wide_t<FromRep> upper =
+                find_bound<ToRep, Ratio, wide_t<FromRep>, Op>((std::numeric_limits<FromRep>::max)());
+        };
+
+        template<typename ToRep, typename FromRep, typename Ratio, typename Op>
+        constexpr wide_t<FromRep> input_bounds<ToRep, FromRep, Ratio, Op>::lower;
+
+        template<typename ToRep, typename FromRep, typename Ratio, typename Op>
+        constexpr wide_t<FromRep> input_bounds<ToRep, FromRep, Ratio, Op>::upper;
+
+        template<typename To, typename From>
+        using ratio_t = std::ratio_divide<typename traits<From>::period, typename traits<To>::period>;
+
+        template<typename To, typename From, typename Op>
+        NODISCARD constexpr auto cast_unchecked(const From& from_val, Op tag) noexcept -> To
+        {
+            using to_rep = typename traits<To>::rep;
+            using wide = wide_t<typename traits<From>::rep>;
+
+            const wide ticks = traits<From>::count(from_val);
+            return traits<To>::make(static_cast<to_rep>(scale<ratio_t<To, From>>(ticks, tag)));
+        }
+
+        /// Casts an array, clamping out of range tick counts so the conversion cannot overflow, and returns whether
+        /// every value fit.
+        template<typename To, typename From, typename Op>
+        inline auto batch_checked(const From* input, std::size_t count, To* output, Op tag) noexcept -> bool
+        {
+            using to_rep = typename traits<To>::rep;
+            using wide = wide_t<typename traits<From>::rep>;
+            using bounds = input_bounds<to_rep, typename traits<From>::rep, ratio_t<To, From>, Op>;
+
+            bool valid = true;
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                const wide ticks = traits<From>::count(input[idx]);
+                const wide clamped =
+                    ticks < bounds::lower ? bounds::lower : (ticks > bounds::upper ? bounds::upper : ticks);
+
+                valid &= clamped == ticks;
+                output[idx] = traits<To>::make(static_cast<to_rep>(scale<ratio_t<To, From>>(clamped, tag)));
+            }
+
+            return valid;
+        }
+
+        /// @p offset is the index of @p input in the caller's array (non-zero for the chunks of a parallel cast).
+        template<typename To, typename Op, typename From>
+        NORETURN COLD inline void throw_batch_error(const From* input, std::size_t count, std::size_t offset = 0)
+        {
+            using bounds = input_bounds<typename traits<To>::rep, typename traits<From>::rep, ratio_t<To, From>, Op>;
+
+            std::size_t idx = 0;
+
+            // Cold path: find the first offending element so the error is actionable
+            for (; idx < count; ++idx)
+            {
+                const wide_t<typename traits<From>::rep> ticks = traits<From>::count(input[idx]);
+
+                if (ticks < bounds::lower || ticks > bounds::upper)
+                {
+                    break;
+                }
+            }
+
+            throw_cast_error<narrow_cast_error>(("duration_narrow_cast failed: input at index "
+                + std::to_string(offset + idx) + " exceeded the range of the output type")
+                    .c_str());
+        }
+    } //namespace chrono
+} // namespace detail
+
+/// @brief Type trait to determine if two types are able to be cast via duration_narrow_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - @p To and @p From must both be std::chrono::duration, or both be std::chrono::time_point of the same clock.
+/// - Both representations must be integral types of the same sign, at most as large as std::intmax_t (cannot be
+/// bool).
+/// - The conversion factor between the periods must not overflow std::intmax_t.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From, bool = detail::chrono::traits<To>::valid && detail::chrono::traits<From>::valid>
+struct is_duration_narrow_castable : std::false_type
+{
+};
+
+template<typename To, typename From>
+struct is_duration_narrow_castable<To, From, true> :
+    std::integral_constant<bool,
+        (std::is_same<typename detail::chrono::traits<To>::clock, typename detail::chrono::traits<From>::clock>::value
+            && detail::chrono::is_tick_rep<typename detail::chrono::traits<To>::rep>
+            && detail::chrono::is_tick_rep<typename detail::chrono::traits<From>::rep>
+            && detail::is_same_sign<typename detail::chrono::traits<To>::rep,
+                typename detail::chrono::traits<From>::rep>
+            && detail::chrono::ratio_t<To, From>::den
+                <= (std::numeric_limits<std::intmax_t>::max)() / detail::chrono::ratio_t<To, From>::num)>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_duration_narrow_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_duration_narrow_castable_v = is_duration_narrow_castable<To, From>::value;
+
+/// @brief Casts a duration or time point to another period and/or representation without performing runtime checks.
+///
+/// Unlike `std::chrono::duration_cast`, the result is exact for any representable value (no intermediate
+/// `count * num` that can overflow) and the rounding is selected with a float_cast operation tag.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @return The casted value.
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+NODISCARD constexpr auto duration_narrow_cast_unchecked(const From& from_val, Op float_op = Op{}) noexcept -> To
+{
+    static_assert(
+        is_duration_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::chrono::cast_unchecked<To>(from_val, float_op);
+}
+
+/// @brief Casts a duration or time point to another period and/or representation with runtime checks.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @return The casted value.
+/// @exception narrow_cast_error Thrown if the rounded value exceeds the range of the target representation.
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+NODISCARD constexpr auto duration_narrow_cast_checked(const From& from_val, Op float_op = Op{}) -> To
+{
+    static_assert(
+        is_duration_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    using from_rep = typename detail::chrono::traits<From>::rep;
+    using bounds = detail::chrono::
+        input_bounds<typename detail::chrono::traits<To>::rep, from_rep, detail::chrono::ratio_t<To, From>, Op>;
+
+    const detail::chrono::wide_t<from_rep> ticks = detail::chrono::traits<From>::count(from_val);
+
+    if (UNLIKELY(ticks > bounds::upper))
+    {
+        detail::throw_cast_error<narrow_cast_error>(
+            "duration_narrow_cast failed: input exceeded max value for output type");
+    }
+
+    if (UNLIKELY(ticks < bounds::lower))
+    {
+        detail::throw_cast_error<narrow_cast_error>(
+            "duration_narrow_cast failed: input exceeded min value for output type");
+    }
+
+    return detail::chrono::cast_unchecked<To>(from_val, float_op);
+}
+
+/// @brief Casts a duration or time point to another period and/or representation. Based on configuration this will
+/// call duration_narrow_cast_checked.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @return The casted value.
+/// @exception narrow_cast_error Thrown if the rounded value exceeds the range of the target representation.
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+NODISCARD constexpr auto duration_narrow_cast(const From& from_val, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && is_duration_narrow_castable_v<To, From>, To>
+{
+    return duration_narrow_cast_checked<To>(from_val, float_op);
+}
+
+/// @brief Casts a duration or time point to another period and/or representation. Based on configuration this will
+/// call duration_narrow_cast_unchecked.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @return The casted value.
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+NODISCARD constexpr auto duration_narrow_cast(const From& from_val, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_duration_narrow_castable_v<To, From>, To>
+{
+    return duration_narrow_cast_unchecked<To>(from_val, float_op);
+}
+
+/// @brief Casts an array of durations or time points without performing runtime checks.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+void duration_narrow_cast_batch_unchecked(
+    const From* input, std::size_t count, To* output, Op float_op = Op{}) noexcept
+{
+    static_assert(
+        is_duration_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+        output[idx] = detail::chrono::cast_unchecked<To>(input[idx], float_op);
+    }
+}
+
+/// @brief Casts an array of durations or time points with runtime checks.
+///
+/// The range of tick counts that fit the target is computed once at compile time, so each element is checked with
+/// two compares (folded into a clamp that keeps the conversion free of overflow) and any error is only reported
+/// once at the end. The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @exception narrow_cast_error Thrown if any rounded value exceeds the range of the target representation.
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+void duration_narrow_cast_batch_checked(const From* input, std::size_t count, To* output, Op float_op = Op{})
+{
+    static_assert(
+        is_duration_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(!detail::chrono::batch_checked(input, count, output, float_op)))
+    {
+        detail::chrono::throw_batch_error<To, Op>(input, count);
+    }
+}
+
+/// @brief Casts an array of durations or time points. Based on configuration this will call
+/// duration_narrow_cast_batch_checked.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @exception narrow_cast_error Thrown if any rounded value exceeds the range of the target representation.
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+auto duration_narrow_cast_batch(const From* input, std::size_t count, To* output, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && is_duration_narrow_castable_v<To, From>>
+{
+    duration_narrow_cast_batch_checked(input, count, output, float_op);
+}
+
+/// @brief Casts an array of durations or time points. Based on configuration this will call
+/// duration_narrow_cast_batch_unchecked.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+template<typename To, typename From, typename Op = detail::math::float_op_truncate>
+auto duration_narrow_cast_batch(const From* input, std::size_t count, To* output, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_duration_narrow_castable_v<To, From>>
+{
+    duration_narrow_cast_batch_unchecked(input, count, output, float_op);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_CHRONO_CAST_HPP
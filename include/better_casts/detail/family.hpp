@@ -0,0 +1,261 @@
+///@file family.hpp
+///@author Jackson Harmer
+///@brief Internal helpers that route a conversion to the matching cast family (enum, narrow, sign or float).
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_DETAIL_FAMILY_HPP
+#define BETTER_CASTS_DETAIL_FAMILY_HPP
+
+#include "../../better_casts.hpp"
+#include "simd.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace casts
+{
+namespace detail
+{
+    namespace family
+    {
+        enum class kind
+        {
+            identity,
+            widen,
+            enumeration,
+            narrow,
+            sign,
+            floating,
+            none,
+        };
+
+        template<typename To, typename From>
+        INLINE_CONSTEXPR bool is_int_widening = are_both_int<To, From> && is_same_sign<To, From>
+            && is_larger_size<To, From> && !std::is_same<To, bool>::value && !std::is_same<From, bool>::value;
+
+        /// Floating point to a type holding every value of it exactly (ex. float to double).
+        template<typename To, typename From>
+        INLINE_CONSTEXPR bool is_float_widening = std::is_floating_point<To>::value
+            && std::is_floating_point<From>::value && !std::is_same<To, From>::value
+            && std::numeric_limits<To>::digits >= std::numeric_limits<From>::digits
+            && std::numeric_limits<To>::max_exponent >= std::numeric_limits<From>::max_exponent
+            && std::numeric_limits<To>::min_exponent <= std::numeric_limits<From>::min_exponent;
+
+        template<typename To, typename From>
+        INLINE_CONSTEXPR bool is_widening = is_int_widening<To, From> || is_float_widening<To, From>;
+
+        /// The cast family used to convert a @p From to a @p To, in order of preference.
+        template<typename To, typename From>
+        INLINE_CONSTEXPR kind kind_of = std::is_same<To, From>::value ? kind::identity
+            : is_widening<To, From>                                   ? kind::widen
+            : is_enum_castable_v<To, From>                            ? kind::enumeration
+            : is_narrow_castable_v<To, From>                          ? kind::narrow
+            : is_sign_castable_v<To, From>                            ? kind::sign
+            : is_float_castable_v<To, From>                           ? kind::floating
+                                                                      : kind::none;
+
+        template<kind Kind>
+        using kind_tag = std::integral_constant<kind, Kind>;
+
+        /// Checks if a @p From can be converted to a @p To by one of the cast families.
+        template<typename To, typename From>
+        struct is_convertible : std::integral_constant<bool, kind_of<To, From> != kind::none>
+        {
+        };
+
+        template<bool Checked, typename To, typename From>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::identity> /*tag*/) noexcept -> To
+        {
+            return from_val;
+        }
+
+        template<bool Checked, typename To, typename From>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::widen> /*tag*/) noexcept -> To
+        {
+            return static_cast<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::enumeration> /*tag*/) -> To
+        {
+            return enum_cast_checked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<!Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::enumeration> /*tag*/) noexcept -> To
+        {
+            return enum_cast_unchecked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::narrow> /*tag*/) -> To
+        {
+            return narrow_cast_checked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<!Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::narrow> /*tag*/) noexcept -> To
+        {
+            return narrow_cast_unchecked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::sign> /*tag*/) -> To
+        {
+            return sign_cast_checked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<!Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::sign> /*tag*/) noexcept -> To
+        {
+            return sign_cast_unchecked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::floating> /*tag*/) -> To
+        {
+            return float_cast_checked<To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::enable_if_t<!Checked, bool> = true>
+        NODISCARD constexpr auto convert(From from_val, kind_tag<kind::floating> /*tag*/) noexcept -> To
+        {
+            return float_cast_unchecked<To>(from_val);
+        }
+
+        /// Converts @p from_val with the checked (or unchecked) cast of the matching family.
+        template<bool Checked, typename To, typename From>
+        NODISCARD constexpr auto convert(From from_val) noexcept(!Checked) -> To
+        {
+            static_assert(
+                is_convertible<To, From>::value, "`From` does not meet the requirements to be casted to a `To`");
+
+            return convert<Checked, To>(from_val, kind_tag<kind_of<To, From>>{});
+        }
+
+        // try_convert mirrors convert, but reports a value the checked cast would reject by returning false instead of
+        // throwing. The rejected value is stored as the unchecked cast would store it, or as zero where that cast is
+        // undefined (floating point to integer). It has no branches, so loops over it vectorize.
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::identity> /*tag*/) noexcept
+            -> bool
+        {
+            result = from_val;
+            return true;
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::widen> /*tag*/) noexcept
+            -> bool
+        {
+            result = static_cast<To>(from_val);
+            return true;
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::enumeration> /*tag*/) noexcept
+            -> bool
+        {
+#ifdef USE_MAGIC_ENUM
+            if constexpr (std::is_enum_v<To>)
+            {
+                const auto casted = magic_enum::enum_cast<To>(from_val);
+
+                result = casted.value_or(To{});
+                return casted.has_value();
+            }
+            else
+            {
+                const bool valid = magic_enum::enum_contains<From>(from_val);
+
+                result = valid ? static_cast<To>(from_val) : To{};
+                return valid;
+            }
+#else
+            result = static_cast<To>(from_val);
+            return true;
+#endif
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::narrow> /*tag*/) noexcept
+            -> bool
+        {
+            constexpr From upper = static_cast<From>((std::numeric_limits<To>::max)());
+            constexpr From lower = static_cast<From>((std::numeric_limits<To>::lowest)());
+            // Negated like narrow_cast_checked, so a floating point NaN passes through
+            const bool valid = !(from_val > upper) & !(from_val < lower);
+            // Stored whatever the check (as narrow_cast_unchecked would), as selecting a floating point value on it
+            // becomes a branch unless the compiler may ignore floating point exceptions
+            result = static_cast<To>(from_val);
+            return valid;
+        }
+
+        template<typename To, typename From, std::enable_if_t<is_unsigned<To>::value, bool> = true>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::sign> /*tag*/) noexcept
+            -> bool
+        {
+            const bool valid = from_val >= 0;
+
+            result = static_cast<To>(from_val);
+            return valid;
+        }
+
+        template<typename To, typename From, std::enable_if_t<is_signed<To>::value, bool> = true>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::sign> /*tag*/) noexcept
+            -> bool
+        {
+            const bool valid =
+                sizeof(To) > sizeof(From) || from_val <= static_cast<From>((std::numeric_limits<To>::max)());
+
+            result = static_cast<To>(from_val);
+            return valid;
+        }
+
+        template<typename To, typename From, typename Op>
+        NODISCARD FORCE_INLINE auto try_round(From from_val, To& result, Op tag) -> bool
+        {
+            // Rounded once and then range checked, so stochastic rounding draws a single threshold
+            const From rounded = simd::round(from_val, tag);
+            const bool valid = math::fits_int<To>(rounded);
+
+            result = static_cast<To>(valid ? rounded : math::float_const<From>::ZERO);
+            return valid;
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_round(From from_val, To& result, math::float_op_truncate /*tag*/) noexcept
+            -> bool
+        {
+            using bounds = math::int_bounds<To, From>;
+
+            // The bounds of float_cast_checked, as the conversion truncates by itself (no call to std::trunc)
+            const bool below_upper = bounds::has_upper ? from_val < bounds::upper : from_val <= bounds::upper;
+            const bool valid = below_upper & (from_val - bounds::lower > -math::float_const<From>::ONE);
+
+            result = static_cast<To>(valid ? from_val : math::float_const<From>::ZERO);
+            return valid;
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result, kind_tag<kind::floating> /*tag*/) -> bool
+        {
+            return try_round(from_val, result, math::float_op_default{});
+        }
+
+        /// Converts @p from_val like the checked cast of the matching family, but returns false instead of failing.
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_convert(From from_val, To& result) -> bool
+        {
+            static_assert(
+                is_convertible<To, From>::value, "`From` does not meet the requirements to be casted to a `To`");
+
+            return try_convert(from_val, result, kind_tag<kind_of<To, From>>{});
+        }
+    } //namespace family
+} // namespace detail
+} // namespace casts
+
+#endif // BETTER_CASTS_DETAIL_FAMILY_HPP
@@ -0,0 +1,377 @@
+///@file simd.hpp
+///@author Jackson Harmer
+///@brief Internal SIMD helpers shared by the batch casts.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_DETAIL_SIMD_HPP
+#define BETTER_CASTS_DETAIL_SIMD_HPP
+
+#include "../../better_casts.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__SSE4_1__)
+#  include <immintrin.h>
+#endif
+
+namespace casts
+{
+namespace detail
+{
+    namespace simd
+    {
+        /// Rounds @p val to an integral value (in its own floating point type) by performing the ceiling operation.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_ceiling /*tag*/) noexcept -> T
+        {
+            return std::ceil(val);
+        }
+
+        /// Rounds @p val to an integral value (in its own floating point type) by performing the floor operation.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_floor /*tag*/) noexcept -> T
+        {
+            return std::floor(val);
+        }
+
+        /// Rounds @p val to an integral value (in its own floating point type), rounding halfway cases away from zero.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_round /*tag*/) noexcept -> T
+        {
+            return std::round(val);
+        }
+
+        /// Rounds @p val to an integral value (in its own floating point type) by performing the truncate operation.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_truncate /*tag*/) noexcept -> T
+        {
+            return std::trunc(val);
+        }
+
+        /// Rounds @p val to an integral value (in its own floating point type), rounding halfway cases to even.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_round_even /*tag*/) noexcept -> T
+        {
+            // std::remainder rounds the quotient to nearest even whatever the rounding mode, and is always exact
+            return val - std::remainder(val, math::float_const<T>::ONE);
+        }
+
+        /// Rounds @p val away from zero when its discarded fraction exceeds @p threshold, towards zero otherwise.
+        template<typename T>
+        NODISCARD inline auto round_away_above(T val, T threshold) noexcept -> T
+        {
+            const T truncated = std::trunc(val);
+            const T fraction = val - truncated;
+
+            return truncated + static_cast<T>(fraction > threshold) - static_cast<T>(-fraction > threshold);
+        }
+
+        /// Rounds @p val to an integral value (in its own floating point type), rounding halfway cases towards zero.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_round_half_down /*tag*/) noexcept -> T
+        {
+            return round_away_above(val, math::float_const<T>::HALF);
+        }
+
+        /// Rounds @p val to an integral value (in its own floating point type) by performing stochastic rounding.
+        template<typename T>
+        NODISCARD inline auto round(T val, math::float_op_stochastic /*tag*/) -> T
+        {
+            return round_away_above(val, math::stochastic_threshold<T>());
+        }
+
+        /// Draws one stochastic rounding threshold per vector lane.
+        template<typename T, std::size_t Lanes>
+        inline void draw_thresholds(T (&lanes)[Lanes])
+        {
+            for (T& lane : lanes)
+            {
+                lane = math::stochastic_threshold<T>();
+            }
+        }
+
+#ifdef __SSE4_1__
+        NODISCARD inline auto round(__m128 val, math::float_op_ceiling /*tag*/) noexcept -> __m128
+        {
+            return _mm_round_ps(val, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m128 val, math::float_op_floor /*tag*/) noexcept -> __m128
+        {
+            return _mm_round_ps(val, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m128 val, math::float_op_truncate /*tag*/) noexcept -> __m128
+        {
+            return _mm_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m128 val, math::float_op_round /*tag*/) noexcept -> __m128
+        {
+            // There is no hardware mode for rounding half away from zero, so truncate and add sign(val) back
+            // whenever the discarded fraction is at least one half.
+            const __m128 sign_mask = _mm_set1_ps(-0.0F);
+            const __m128 truncated = _mm_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m128 fraction = _mm_andnot_ps(sign_mask, _mm_sub_ps(val, truncated));
+            const __m128 one = _mm_or_ps(_mm_and_ps(val, sign_mask), _mm_set1_ps(1.0F));
+            const __m128 adjust = _mm_and_ps(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5F)), one);
+            return _mm_add_ps(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m128 val, math::float_op_round_even /*tag*/) noexcept -> __m128
+        {
+            return _mm_round_ps(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        /// Like float_op_round, but the discarded fraction must exceed @p threshold (not only reach it).
+        NODISCARD inline auto round_away_above(__m128 val, __m128 threshold) noexcept -> __m128
+        {
+            const __m128 sign_mask = _mm_set1_ps(-0.0F);
+            const __m128 truncated = _mm_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m128 fraction = _mm_andnot_ps(sign_mask, _mm_sub_ps(val, truncated));
+            const __m128 one = _mm_or_ps(_mm_and_ps(val, sign_mask), _mm_set1_ps(1.0F));
+            const __m128 adjust = _mm_and_ps(_mm_cmpgt_ps(fraction, threshold), one);
+            return _mm_add_ps(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m128 val, math::float_op_round_half_down /*tag*/) noexcept -> __m128
+        {
+            return round_away_above(val, _mm_set1_ps(0.5F));
+        }
+
+        NODISCARD inline auto round(__m128 val, math::float_op_stochastic /*tag*/) -> __m128
+        {
+            alignas(16) float thresholds[4];
+            draw_thresholds(thresholds);
+            return round_away_above(val, _mm_load_ps(thresholds));
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_ceiling /*tag*/) noexcept -> __m128d
+        {
+            return _mm_round_pd(val, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_floor /*tag*/) noexcept -> __m128d
+        {
+            return _mm_round_pd(val, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_truncate /*tag*/) noexcept -> __m128d
+        {
+            return _mm_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_round /*tag*/) noexcept -> __m128d
+        {
+            const __m128d sign_mask = _mm_set1_pd(-0.0);
+            const __m128d truncated = _mm_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m128d fraction = _mm_andnot_pd(sign_mask, _mm_sub_pd(val, truncated));
+            const __m128d one = _mm_or_pd(_mm_and_pd(val, sign_mask), _mm_set1_pd(1.0));
+            const __m128d adjust = _mm_and_pd(_mm_cmpge_pd(fraction, _mm_set1_pd(0.5)), one);
+            return _mm_add_pd(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_round_even /*tag*/) noexcept -> __m128d
+        {
+            return _mm_round_pd(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round_away_above(__m128d val, __m128d threshold) noexcept -> __m128d
+        {
+            const __m128d sign_mask = _mm_set1_pd(-0.0);
+            const __m128d truncated = _mm_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m128d fraction = _mm_andnot_pd(sign_mask, _mm_sub_pd(val, truncated));
+            const __m128d one = _mm_or_pd(_mm_and_pd(val, sign_mask), _mm_set1_pd(1.0));
+            const __m128d adjust = _mm_and_pd(_mm_cmpgt_pd(fraction, threshold), one);
+            return _mm_add_pd(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_round_half_down /*tag*/) noexcept -> __m128d
+        {
+            return round_away_above(val, _mm_set1_pd(0.5));
+        }
+
+        NODISCARD inline auto round(__m128d val, math::float_op_stochastic /*tag*/) -> __m128d
+        {
+            alignas(16) double thresholds[2];
+            draw_thresholds(thresholds);
+            return round_away_above(val, _mm_load_pd(thresholds));
+        }
+#endif
+
+#ifdef __AVX2__
+        NODISCARD inline auto round(__m256 val, math::float_op_ceiling /*tag*/) noexcept -> __m256
+        {
+            return _mm256_round_ps(val, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m256 val, math::float_op_floor /*tag*/) noexcept -> __m256
+        {
+            return _mm256_round_ps(val, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m256 val, math::float_op_truncate /*tag*/) noexcept -> __m256
+        {
+            return _mm256_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m256 val, math::float_op_round /*tag*/) noexcept -> __m256
+        {
+            const __m256 sign_mask = _mm256_set1_ps(-0.0F);
+            const __m256 truncated = _mm256_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m256 fraction = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(val, truncated));
+            const __m256 one = _mm256_or_ps(_mm256_and_ps(val, sign_mask), _mm256_set1_ps(1.0F));
+            const __m256 adjust = _mm256_and_ps(_mm256_cmp_ps(fraction, _mm256_set1_ps(0.5F), _CMP_GE_OQ), one);
+            return _mm256_add_ps(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m256 val, math::float_op_round_even /*tag*/) noexcept -> __m256
+        {
+            return _mm256_round_ps(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round_away_above(__m256 val, __m256 threshold) noexcept -> __m256
+        {
+            const __m256 sign_mask = _mm256_set1_ps(-0.0F);
+            const __m256 truncated = _mm256_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m256 fraction = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(val, truncated));
+            const __m256 one = _mm256_or_ps(_mm256_and_ps(val, sign_mask), _mm256_set1_ps(1.0F));
+            const __m256 adjust = _mm256_and_ps(_mm256_cmp_ps(fraction, threshold, _CMP_GT_OQ), one);
+            return _mm256_add_ps(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m256 val, math::float_op_round_half_down /*tag*/) noexcept -> __m256
+        {
+            return round_away_above(val, _mm256_set1_ps(0.5F));
+        }
+
+        NODISCARD inline auto round(__m256 val, math::float_op_stochastic /*tag*/) -> __m256
+        {
+            alignas(32) float thresholds[8];
+            draw_thresholds(thresholds);
+            return round_away_above(val, _mm256_load_ps(thresholds));
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_ceiling /*tag*/) noexcept -> __m256d
+        {
+            return _mm256_round_pd(val, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_floor /*tag*/) noexcept -> __m256d
+        {
+            return _mm256_round_pd(val, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_truncate /*tag*/) noexcept -> __m256d
+        {
+            return _mm256_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_round /*tag*/) noexcept -> __m256d
+        {
+            const __m256d sign_mask = _mm256_set1_pd(-0.0);
+            const __m256d truncated = _mm256_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m256d fraction = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(val, truncated));
+            const __m256d one = _mm256_or_pd(_mm256_and_pd(val, sign_mask), _mm256_set1_pd(1.0));
+            const __m256d adjust = _mm256_and_pd(_mm256_cmp_pd(fraction, _mm256_set1_pd(0.5), _CMP_GE_OQ), one);
+            return _mm256_add_pd(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_round_even /*tag*/) noexcept -> __m256d
+        {
+            return _mm256_round_pd(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round_away_above(__m256d val, __m256d threshold) noexcept -> __m256d
+        {
+            const __m256d sign_mask = _mm256_set1_pd(-0.0);
+            const __m256d truncated = _mm256_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m256d fraction = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(val, truncated));
+            const __m256d one = _mm256_or_pd(_mm256_and_pd(val, sign_mask), _mm256_set1_pd(1.0));
+            const __m256d adjust = _mm256_and_pd(_mm256_cmp_pd(fraction, threshold, _CMP_GT_OQ), one);
+            return _mm256_add_pd(truncated, adjust);
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_round_half_down /*tag*/) noexcept -> __m256d
+        {
+            return round_away_above(val, _mm256_set1_pd(0.5));
+        }
+
+        NODISCARD inline auto round(__m256d val, math::float_op_stochastic /*tag*/) -> __m256d
+        {
+            alignas(32) double thresholds[4];
+            draw_thresholds(thresholds);
+            return round_away_above(val, _mm256_load_pd(thresholds));
+        }
+
+        /// Narrows 8 int32 lanes to int16 with signed saturation, keeping lane order.
+        NODISCARD inline auto pack_i32_to_i16(__m256i val) noexcept -> __m128i
+        {
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(val, val), 0xD8);
+            return _mm256_castsi256_si128(packed);
+        }
+#endif
+
+#ifdef __AVX512F__
+        NODISCARD inline auto round(__m512 val, math::float_op_ceiling /*tag*/) noexcept -> __m512
+        {
+            return _mm512_roundscale_ps(val, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m512 val, math::float_op_floor /*tag*/) noexcept -> __m512
+        {
+            return _mm512_roundscale_ps(val, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m512 val, math::float_op_truncate /*tag*/) noexcept -> __m512
+        {
+            return _mm512_roundscale_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round(__m512 val, math::float_op_round /*tag*/) noexcept -> __m512
+        {
+            // AVX-512F has no floating point and/or, so build copysign(1, val) with integer operations
+            const __m512i sign_mask = _mm512_set1_epi32((std::numeric_limits<int>::min)());
+            const __m512 truncated = _mm512_roundscale_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m512 fraction = _mm512_abs_ps(_mm512_sub_ps(val, truncated));
+            const __m512 one = _mm512_castsi512_ps(_mm512_or_si512(
+                _mm512_and_si512(_mm512_castps_si512(val), sign_mask), _mm512_castps_si512(_mm512_set1_ps(1.0F))));
+            const __mmask16 needs_adjust = _mm512_cmp_ps_mask(fraction, _mm512_set1_ps(0.5F), _CMP_GE_OQ);
+            return _mm512_mask_add_ps(truncated, needs_adjust, truncated, one);
+        }
+
+        NODISCARD inline auto round(__m512 val, math::float_op_round_even /*tag*/) noexcept -> __m512
+        {
+            return _mm512_roundscale_ps(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto round_away_above(__m512 val, __m512 threshold) noexcept -> __m512
+        {
+            const __m512i sign_mask = _mm512_set1_epi32((std::numeric_limits<int>::min)());
+            const __m512 truncated = _mm512_roundscale_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            const __m512 fraction = _mm512_abs_ps(_mm512_sub_ps(val, truncated));
+            const __m512 one = _mm512_castsi512_ps(_mm512_or_si512(
+                _mm512_and_si512(_mm512_castps_si512(val), sign_mask), _mm512_castps_si512(_mm512_set1_ps(1.0F))));
+            const __mmask16 needs_adjust = _mm512_cmp_ps_mask(fraction, threshold, _CMP_GT_OQ);
+            return _mm512_mask_add_ps(truncated, needs_adjust, truncated, one);
+        }
+
+        NODISCARD inline auto round(__m512 val, math::float_op_round_half_down /*tag*/) noexcept -> __m512
+        {
+            return round_away_above(val, _mm512_set1_ps(0.5F));
+        }
+
+        NODISCARD inline auto round(__m512 val, math::float_op_stochastic /*tag*/) -> __m512
+        {
+            alignas(64) float thresholds[16];
+            draw_thresholds(thresholds);
+            return round_away_above(val, _mm512_load_ps(thresholds));
+        }
+#endif
+    } //namespace simd
+} // namespace detail
+} // namespace casts
+
+#endif // BETTER_CASTS_DETAIL_SIMD_HPP
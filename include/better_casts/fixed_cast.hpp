@@ -0,0 +1,510 @@
+///@file fixed_cast.hpp
+///@author Jackson Harmer
+///@brief Casts between floating point values and fixed-point (Q-format and decimal) representations.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_FIXED_CAST_HPP
+#define BETTER_CASTS_FIXED_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace casts
+{
+namespace detail
+{
+    namespace fixed
+    {
+        /// Computes 10^exp in the floating point type @p T (exact as long as 10^exp is representable).
+        template<typename T>
+        NODISCARD constexpr auto pow10(int exp) noexcept -> T
+        {
+            T result = math::float_const<T>::ONE;
+
+            for (int i = 0; i < exp; ++i)
+            {
+                result *= static_cast<T>(10);
+            }
+
+            return result;
+        }
+    } //namespace fixed
+} // namespace detail
+
+/// @brief Binary fixed-point format, where a raw value `r` represents the real value `r * 2^-FracBits`.
+///
+/// @tparam Rep The integral type used to store the raw value.
+/// @tparam FracBits The number of fractional bits.
+template<typename Rep, int FracBits>
+struct q_format
+{
+    static_assert(detail::is_integer<Rep>::value && !std::is_same<Rep, bool>::value, "Rep must be an integral type");
+    static_assert(FracBits >= 0 && FracBits <= std::numeric_limits<Rep>::digits, "FracBits must fit within Rep");
+
+    using rep = Rep;
+
+    /// @brief Factor that converts a real value to its raw representation.
+    template<typename F>
+    NODISCARD static constexpr auto scale() noexcept -> F
+    {
+        return detail::math::pow2<F>(FracBits);
+    }
+
+    /// @brief Converts a raw value (already converted to @p F) back to the real value it represents.
+    template<typename F>
+    NODISCARD static constexpr auto unscale(F raw) noexcept -> F
+    {
+        return raw * detail::math::pow2<F>(-FracBits);
+    }
+};
+
+/// @brief Decimal fixed-point format, where a raw value `r` represents the real value `r * 10^-Digits`.
+///
+/// @tparam Rep The integral type used to store the raw value.
+/// @tparam Digits The number of decimal digits after the decimal point (ex. 4 for a scale of 1e-4).
+template<typename Rep, int Digits>
+struct decimal_format
+{
+    static_assert(detail::is_integer<Rep>::value && !std::is_same<Rep, bool>::value, "Rep must be an integral type");
+    static_assert(Digits >= 0 && Digits <= std::numeric_limits<Rep>::digits10, "Digits must fit within Rep");
+
+    using rep = Rep;
+
+    /// @brief Factor that converts a real value to its raw representation.
+    template<typename F>
+    NODISCARD static constexpr auto scale() noexcept -> F
+    {
+        return detail::fixed::pow10<F>(Digits);
+    }
+
+    /// @brief Converts a raw value (already converted to @p F) back to the real value it represents.
+    template<typename F>
+    NODISCARD static constexpr auto unscale(F raw) noexcept -> F
+    {
+        // Division (rather than multiplying by 10^-Digits) keeps the result correctly rounded.
+        return raw / detail::fixed::pow10<F>(Digits);
+    }
+};
+
+/// @brief Q0.7 format stored in an 8-bit integer, covering [-1, 1).
+using q7 = q_format<std::int8_t, 7>;
+
+/// @brief Q0.15 format stored in a 16-bit integer, covering [-1, 1).
+using q15 = q_format<std::int16_t, 15>;
+
+/// @brief Q0.31 format stored in a 32-bit integer, covering [-1, 1).
+using q31 = q_format<std::int32_t, 31>;
+
+/// @brief Type trait to determine if a type describes a fixed-point format usable with fixed_cast.
+///
+/// May be specialized for user-defined formats providing `rep`, `scale<F>()` and `unscale<F>(F)`.
+template<typename T>
+struct is_fixed_format : std::false_type
+{
+};
+
+template<typename Rep, int FracBits>
+struct is_fixed_format<q_format<Rep, FracBits>> : std::true_type
+{
+};
+
+template<typename Rep, int Digits>
+struct is_fixed_format<decimal_format<Rep, Digits>> : std::true_type
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_fixed_format.
+template<typename T>
+INLINE_CONSTEXPR bool is_fixed_format_v = is_fixed_format<T>::value;
+
+/// @brief Type trait to determine if two types are able to be cast via fixed_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - One of @p To or @p From must be a fixed-point format (see is_fixed_format).
+/// - The other type must be a floating point type.
+///
+/// @tparam To The type (or format) to cast to.
+/// @tparam From The type (or format) to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_fixed_castable :
+    std::integral_constant<bool,
+        ((is_fixed_format_v<To> && std::is_floating_point<From>::value)
+            || (std::is_floating_point<To>::value && is_fixed_format_v<From>))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_fixed_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_fixed_castable_v = is_fixed_castable<To, From>::value;
+
+namespace detail
+{
+    namespace fixed
+    {
+        template<bool Checked, typename Rep, typename F, typename Op>
+        inline auto to_fixed_simd(const F* /*input*/, std::size_t /*count*/, Rep* /*output*/, F /*scale*/,
+            Op /*tag*/, bool& /*valid*/) noexcept -> std::size_t
+        {
+            // No vector kernel for this combination, the scalar loop handles every element
+            return 0;
+        }
+
+#ifdef __AVX2__
+        template<bool Checked, typename Op>
+        inline auto to_fixed_simd(const float* input, std::size_t count, std::int32_t* output, float scale, Op tag,
+            bool& valid) noexcept -> std::size_t
+        {
+            const __m256 factor = _mm256_set1_ps(scale);
+            const __m256 lower = _mm256_set1_ps(math::int_bounds<std::int32_t, float>::lower);
+            const __m256 upper = _mm256_set1_ps(math::int_bounds<std::int32_t, float>::upper);
+            __m256 all_valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                const __m256 rounded = simd::round(_mm256_mul_ps(_mm256_loadu_ps(input + idx), factor), tag);
+
+                if (Checked)
+                {
+                    const auto in_range = _mm256_and_ps(
+                        _mm256_cmp_ps(rounded, lower, _CMP_GE_OQ), _mm256_cmp_ps(rounded, upper, _CMP_LT_OQ));
+                    all_valid = _mm256_and_ps(all_valid, in_range);
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + idx), _mm256_cvttps_epi32(rounded));
+            }
+
+            valid = _mm256_movemask_ps(all_valid) == 0xFF;
+            return idx;
+        }
+
+        template<bool Checked, typename Op>
+        inline auto to_fixed_simd(const float* input, std::size_t count, std::int16_t* output, float scale, Op tag,
+            bool& valid) noexcept -> std::size_t
+        {
+            const __m256 factor = _mm256_set1_ps(scale);
+            const __m256 lower = _mm256_set1_ps(math::int_bounds<std::int16_t, float>::lower);
+            const __m256 upper = _mm256_set1_ps(math::int_bounds<std::int16_t, float>::upper);
+            __m256 all_valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                const __m256 rounded = simd::round(_mm256_mul_ps(_mm256_loadu_ps(input + idx), factor), tag);
+
+                if (Checked)
+                {
+                    const auto in_range = _mm256_and_ps(
+                        _mm256_cmp_ps(rounded, lower, _CMP_GE_OQ), _mm256_cmp_ps(rounded, upper, _CMP_LT_OQ));
+                    all_valid = _mm256_and_ps(all_valid, in_range);
+                }
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + idx), simd::pack_i32_to_i16(_mm256_cvttps_epi32(rounded)));
+            }
+
+            valid = _mm256_movemask_ps(all_valid) == 0xFF;
+            return idx;
+        }
+
+        template<bool Checked, typename Op>
+        inline auto to_fixed_simd(const double* input, std::size_t count, std::int32_t* output, double scale, Op tag,
+            bool& valid) noexcept -> std::size_t
+        {
+            const __m256d factor = _mm256_set1_pd(scale);
+            const __m256d lower = _mm256_set1_pd(math::int_bounds<std::int32_t, double>::lower);
+            const __m256d upper = _mm256_set1_pd(math::int_bounds<std::int32_t, double>::upper);
+            __m256d all_valid = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+            std::size_t idx = 0;
+
+            for (; idx + 4 <= count; idx += 4)
+            {
+                const __m256d rounded = simd::round(_mm256_mul_pd(_mm256_loadu_pd(input + idx), factor), tag);
+
+                if (Checked)
+                {
+                    const auto in_range = _mm256_and_pd(
+                        _mm256_cmp_pd(rounded, lower, _CMP_GE_OQ), _mm256_cmp_pd(rounded, upper, _CMP_LT_OQ));
+                    all_valid = _mm256_and_pd(all_valid, in_range);
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + idx), _mm256_cvttpd_epi32(rounded));
+            }
+
+            valid = _mm256_movemask_pd(all_valid) == 0xF;
+            return idx;
+        }
+#endif
+
+        template<typename Rep, typename F, typename Op>
+        inline auto to_fixed_scalar(const F* input, std::size_t first, std::size_t count, Rep* output, F scale,
+            Op tag) noexcept -> bool
+        {
+            bool valid = true;
+
+            for (std::size_t idx = first; idx < count; ++idx)
+            {
+                const F rounded = simd::round(input[idx] * scale, tag);
+                const bool in_range = math::fits_int<Rep>(rounded);
+
+                valid = valid && in_range;
+                output[idx] = in_range ? static_cast<Rep>(rounded) : Rep{};
+            }
+
+            return valid;
+        }
+
+        template<typename Rep, typename F, typename Op>
+        inline void to_fixed_scalar_unchecked(
+            const F* input, std::size_t first, std::size_t count, Rep* output, F scale, Op tag) noexcept
+        {
+            for (std::size_t idx = first; idx < count; ++idx)
+            {
+                output[idx] = static_cast<Rep>(simd::round(input[idx] * scale, tag));
+            }
+        }
+
+        /// Converts an array with the checks folded into the conversion, returning whether every value fit.
+        template<typename Rep, typename F, typename Op>
+        inline auto to_fixed_checked(const F* input, std::size_t count, Rep* output, F scale, Op tag) noexcept -> bool
+        {
+            bool valid = true;
+            const std::size_t done = to_fixed_simd<true>(input, count, output, scale, tag, valid);
+
+            return to_fixed_scalar(input, done, count, output, scale, tag) && valid;
+        }
+
+        /// @p offset is the index of @p input in the caller's array (non-zero for the chunks of a parallel cast).
+        template<typename Rep, typename F, typename Op>
+        NORETURN COLD inline void throw_batch_error(
+            const F* input, std::size_t count, F scale, Op tag, std::size_t offset = 0)
+        {
+            std::size_t idx = 0;
+
+            // Cold path: find the first offending element so the error is actionable
+            for (; idx < count; ++idx)
+            {
+                const F rounded = simd::round(input[idx] * scale, tag);
+
+                if (!math::fits_int<Rep>(rounded))
+                {
+                    break;
+                }
+            }
+
+            throw_cast_error<float_cast_error>(("fixed_cast failed: input at index " + std::to_string(offset + idx)
+                + " is NaN, Infinity or exceeds the range of the output type")
+                    .c_str());
+        }
+    } //namespace fixed
+} // namespace detail
+
+/// @brief Casts a floating point value to a fixed-point format without performing runtime checks.
+///
+/// @tparam Q The fixed-point format to cast to (ex. q15, decimal_format<std::int64_t, 4>).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled value.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The raw fixed-point representation of the value.
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+NODISCARD constexpr auto fixed_cast_unchecked(From&& from_val, Op float_op = Op{}) noexcept -> typename Q::rep
+{
+    using val_t = std::remove_cv_t<std::remove_reference_t<From>>;
+
+    static_assert(is_fixed_castable_v<Q, val_t>, "`From` cannot be casted to the fixed-point format `Q`");
+
+    return float_cast_unchecked<typename Q::rep>(from_val * Q::template scale<val_t>(), float_op);
+}
+
+/// @brief Casts a floating point value to a fixed-point format with runtime checks.
+///
+/// @tparam Q The fixed-point format to cast to (ex. q15, decimal_format<std::int64_t, 4>).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled value.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The raw fixed-point representation of the value.
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or the scaled value exceeds the range of the
+/// format's representation.
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+NODISCARD constexpr auto fixed_cast_checked(From&& from_val, Op float_op = Op{}) -> typename Q::rep
+{
+    using val_t = std::remove_cv_t<std::remove_reference_t<From>>;
+
+    static_assert(is_fixed_castable_v<Q, val_t>, "`From` cannot be casted to the fixed-point format `Q`");
+
+    return float_cast_checked<typename Q::rep>(from_val * Q::template scale<val_t>(), float_op);
+}
+
+/// @brief Casts a floating point value to a fixed-point format. Based on configuration this will call
+/// fixed_cast_checked.
+///
+/// @tparam Q The fixed-point format to cast to (ex. q15, decimal_format<std::int64_t, 4>).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled value.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The raw fixed-point representation of the value.
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or the scaled value exceeds the range of the
+/// format's representation.
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+NODISCARD constexpr auto fixed_cast(From&& from_val, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && is_fixed_format_v<Q>, typename Q::rep>
+{
+    return fixed_cast_checked<Q>(std::forward<From>(from_val), float_op);
+}
+
+/// @brief Casts a floating point value to a fixed-point format. Based on configuration this will call
+/// fixed_cast_unchecked.
+///
+/// @tparam Q The fixed-point format to cast to (ex. q15, decimal_format<std::int64_t, 4>).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled value.
+/// @param from_val The value to cast.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The raw fixed-point representation of the value.
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+NODISCARD constexpr auto fixed_cast(From&& from_val, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_fixed_format_v<Q>, typename Q::rep>
+{
+    return fixed_cast_unchecked<Q>(std::forward<From>(from_val), float_op);
+}
+
+/// @brief Casts a raw fixed-point value back to a floating point type (no runtime checks needed).
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam Q The fixed-point format the raw value is stored in.
+/// @param from_val The raw fixed-point value to cast.
+/// @return The real value represented by @p from_val.
+template<typename To, typename Q>
+NODISCARD constexpr auto fixed_cast(typename Q::rep from_val) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_fixed_format_v<Q>, To>
+{
+    static_assert(is_fixed_castable_v<To, Q>, "A raw `Q` value cannot be casted to a `To`");
+
+    return Q::template unscale<To>(static_cast<To>(from_val));
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format without performing runtime checks.
+///
+/// Uses SIMD kernels where available (AVX2 for float to 16/32-bit and double to 32-bit formats).
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+void fixed_cast_batch_unchecked(
+    const From* input, std::size_t count, typename Q::rep* output, Op float_op = Op{}) noexcept
+{
+    static_assert(is_fixed_castable_v<Q, From>, "`From` cannot be casted to the fixed-point format `Q`");
+
+    const From scale = Q::template scale<From>();
+    bool valid = true;
+    const std::size_t done = detail::fixed::to_fixed_simd<false>(input, count, output, scale, float_op, valid);
+
+    detail::fixed::to_fixed_scalar_unchecked(input, done, count, output, scale, float_op);
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format with runtime checks.
+///
+/// Every element is validated, but the checks are folded into the SIMD conversion and only reported once at the end,
+/// so the cost per element stays at a few instructions. The contents of @p output are unspecified if an error is
+/// thrown.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or its scaled value exceeds the range of the
+/// format's representation.
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+void fixed_cast_batch_checked(const From* input, std::size_t count, typename Q::rep* output, Op float_op = Op{})
+{
+    static_assert(is_fixed_castable_v<Q, From>, "`From` cannot be casted to the fixed-point format `Q`");
+
+    const From scale = Q::template scale<From>();
+
+    if (UNLIKELY(!detail::fixed::to_fixed_checked(input, count, output, scale, float_op)))
+    {
+        detail::fixed::throw_batch_error<typename Q::rep>(input, count, scale, float_op);
+    }
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format. Based on configuration this will call
+/// fixed_cast_batch_checked.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or its scaled value exceeds the range of the
+/// format's representation.
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+auto fixed_cast_batch(const From* input, std::size_t count, typename Q::rep* output, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && is_fixed_format_v<Q>>
+{
+    fixed_cast_batch_checked<Q>(input, count, output, float_op);
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format. Based on configuration this will call
+/// fixed_cast_batch_unchecked.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+template<typename Q, typename From, typename Op = detail::math::float_op_default>
+auto fixed_cast_batch(const From* input, std::size_t count, typename Q::rep* output, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_fixed_format_v<Q>>
+{
+    fixed_cast_batch_unchecked<Q>(input, count, output, float_op);
+}
+
+/// @brief Casts an array of raw fixed-point values back to a floating point type (no runtime checks needed).
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam Q The fixed-point format the raw values are stored in.
+/// @param input Pointer to the first of @p count raw values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count floating point values.
+template<typename To, typename Q>
+auto fixed_cast_batch(const typename Q::rep* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_fixed_format_v<Q>>
+{
+    static_assert(is_fixed_castable_v<To, Q>, "A raw `Q` value cannot be casted to a `To`");
+
+    // Simple enough for the compiler to vectorize (int -> float conversion and a multiply/divide per lane)
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+        output[idx] = Q::template unscale<To>(static_cast<To>(input[idx]));
+    }
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_FIXED_CAST_HPP
@@ -0,0 +1,787 @@
+///@file half_cast.hpp
+///@author Jackson Harmer
+///@brief Half-precision (IEEE binary16) and bfloat16 storage types and the casts to and from them.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_HALF_CAST_HPP
+#define BETTER_CASTS_HALF_CAST_HPP
+
+#include "../better_casts.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#if defined(__AVX512BF16__) || defined(__AVX2__) || defined(__F16C__)
+#  include <immintrin.h>
+#endif
+
+namespace casts
+{
+/// @brief Storage type for an IEEE 754 binary16 (half-precision) value.
+///
+/// Only the bit pattern is stored; use half_cast to convert to and from arithmetic types.
+struct float16_t
+{
+    std::uint16_t bits;
+};
+
+/// @brief Storage type for a bfloat16 value (the upper 16 bits of an IEEE 754 binary32 value).
+///
+/// Only the bit pattern is stored; use half_cast to convert to and from arithmetic types.
+struct bfloat16_t
+{
+    std::uint16_t bits;
+};
+
+static_assert(sizeof(float16_t) == 2 && sizeof(bfloat16_t) == 2, "half types must not be padded");
+static_assert(std::numeric_limits<float>::is_iec559 && std::numeric_limits<double>::is_iec559,
+    "half_cast requires IEEE 754 float and double");
+
+namespace detail
+{
+    namespace half
+    {
+        using op_round_even = math::float_op_round_even;
+
+        template<int ExpBits, int MantBits>
+        struct ieee_format
+        {
+            static constexpr int exp_bits = ExpBits;
+            static constexpr int mant_bits = MantBits;
+            static constexpr int bias = (1 << (ExpBits - 1)) - 1;
+            static constexpr int min_exp = 1 - bias;
+            static constexpr std::uint64_t exp_mask = (std::uint64_t{ 1 } << ExpBits) - 1;
+            static constexpr std::uint64_t mant_mask = (std::uint64_t{ 1 } << MantBits) - 1;
+            static constexpr std::uint64_t inf_bits = exp_mask << MantBits;
+            static constexpr std::uint64_t sign_bit = std::uint64_t{ 1 } << (ExpBits + MantBits);
+        };
+
+        template<typename T>
+        struct format_of;
+
+        template<>
+        struct format_of<float16_t> : ieee_format<5, 10>
+        {
+        };
+
+        template<>
+        struct format_of<bfloat16_t> : ieee_format<8, 7>
+        {
+        };
+
+        template<>
+        struct format_of<float> : ieee_format<8, 23>
+        {
+            using bits_type = std::uint32_t;
+        };
+
+        template<>
+        struct format_of<double> : ieee_format<11, 52>
+        {
+            using bits_type = std::uint64_t;
+        };
+
+        template<typename T>
+        struct is_half_type : std::integral_constant<bool,
+                                  std::is_same<T, float16_t>::value || std::is_same<T, bfloat16_t>::value>
+        {
+        };
+
+        enum class failure
+        {
+            none,
+            nan,
+            infinity,
+            overflow,
+        };
+
+        NORETURN COLD inline void throw_failure(failure fail)
+        {
+            if (fail == failure::nan)
+            {
+                throw_cast_error<float_cast_error>("half_cast failed: cannot cast from NaN");
+            }
+
+            if (fail == failure::infinity)
+            {
+                throw_cast_error<float_cast_error>("half_cast failed: cannot cast from Infinity");
+            }
+
+            throw_cast_error<float_cast_error>("half_cast failed: input exceeded max value for output type");
+        }
+
+        /// Rounds the value `sig * 2^(exp - frac_bits)` to the format of @p Dst and returns its magnitude bits.
+        ///
+        /// @p sig must either be normalized (leading bit at @p frac_bits) or be a subnormal of the source format.
+        /// Out of range values become Infinity when rounding to nearest and the largest finite value when
+        /// truncating, mirroring IEEE 754 overflow for the two rounding directions.
+        template<typename Dst>
+        NODISCARD constexpr auto round_to(int exp, std::uint64_t sig, int frac_bits, bool nearest_even,
+            failure& fail) noexcept -> std::uint64_t
+        {
+            using fmt = format_of<Dst>;
+
+            const int shift = frac_bits - fmt::mant_bits + (exp < fmt::min_exp ? fmt::min_exp - exp : 0);
+            std::uint64_t rounded = 0;
+
+            if (shift <= 0)
+            {
+                rounded = sig << -shift;
+            }
+            else if (shift < 64)
+            {
+                rounded = sig >> shift;
+
+                const std::uint64_t remainder = sig & ((std::uint64_t{ 1 } << shift) - 1);
+                const std::uint64_t halfway = std::uint64_t{ 1 } << (shift - 1);
+
+                if (nearest_even && (remainder > halfway || (remainder == halfway && (rounded & 1U) != 0)))
+                {
+                    ++rounded;
+                }
+            }
+
+            // Adding the rounded significand (implicit bit included) lets any rounding carry ripple into the exponent
+            const std::uint64_t exp_part =
+                exp > fmt::min_exp ? static_cast<std::uint64_t>(exp - fmt::min_exp) << fmt::mant_bits : 0;
+            const std::uint64_t magnitude = exp_part + rounded;
+
+            if (magnitude >= fmt::inf_bits)
+            {
+                fail = failure::overflow;
+                return nearest_even ? fmt::inf_bits : fmt::inf_bits - 1;
+            }
+
+            return magnitude;
+        }
+
+        template<typename Dst, typename F>
+        NODISCARD inline auto narrow_float(F val, bool nearest_even, failure& fail) noexcept -> Dst
+        {
+            using src = format_of<F>;
+            using dst = format_of<Dst>;
+
+            typename src::bits_type raw{};
+            std::memcpy(&raw, &val, sizeof(raw));
+
+            const std::uint64_t bits = raw;
+            const std::uint64_t sign = (bits & src::sign_bit) != 0 ? dst::sign_bit : 0;
+            const std::uint64_t exp_field = (bits >> src::mant_bits) & src::exp_mask;
+            const std::uint64_t mant = bits & src::mant_mask;
+
+            if (exp_field == src::exp_mask)
+            {
+                if (mant == 0)
+                {
+                    fail = failure::infinity;
+                    return Dst{ static_cast<std::uint16_t>(sign | dst::inf_bits) };
+                }
+
+                // Keep the top of the payload and force a quiet NaN
+                fail = failure::nan;
+                const std::uint64_t payload =
+                    (std::uint64_t{ 1 } << (dst::mant_bits - 1)) | (mant >> (src::mant_bits - dst::mant_bits));
+                return Dst{ static_cast<std::uint16_t>(sign | dst::inf_bits | payload) };
+            }
+
+            if (exp_field == 0 && mant == 0)
+            {
+                return Dst{ static_cast<std::uint16_t>(sign) };
+            }
+
+            const int exp = exp_field == 0 ? src::min_exp : static_cast<int>(exp_field) - src::bias;
+            const std::uint64_t sig = exp_field == 0 ? mant : mant | (std::uint64_t{ 1 } << src::mant_bits);
+
+            const std::uint64_t magnitude = round_to<Dst>(exp, sig, src::mant_bits, nearest_even, fail);
+            return Dst{ static_cast<std::uint16_t>(sign | magnitude) };
+        }
+
+        template<typename T, std::enable_if_t<is_signed<T>::value, bool> = true>
+        NODISCARD constexpr auto is_negative(T val) noexcept -> bool
+        {
+            return val < 0;
+        }
+
+        template<typename T, std::enable_if_t<is_unsigned<T>::value, bool> = true>
+        NODISCARD constexpr auto is_negative(T /*val*/) noexcept -> bool
+        {
+            return false;
+        }
+
+        template<typename Dst, typename I>
+        NODISCARD constexpr auto narrow_int(I val, bool nearest_even, failure& fail) noexcept -> Dst
+        {
+            using unsigned_t = make_unsigned_t<I>;
+            using dst = format_of<Dst>;
+
+            const bool negative = is_negative(val);
+            const unsigned_t magnitude =
+                negative ? static_cast<unsigned_t>(unsigned_t{ 0 } - static_cast<unsigned_t>(val))
+                         : static_cast<unsigned_t>(val);
+
+            if (magnitude == 0)
+            {
+                return Dst{ 0 };
+            }
+
+            int msb = 0;
+
+            for (unsigned_t rest = magnitude; rest > 1; rest >>= 1U)
+            {
+                ++msb;
+            }
+
+            // Wider than 64 bits (128-bit integers): keep the top 64 bits, folding the rest into a sticky bit
+            const int excess = msb > 63 ? msb - 63 : 0;
+            const bool sticky = excess > 0 && (magnitude & ((unsigned_t{ 1 } << excess) - 1)) != 0;
+            const auto sig = static_cast<std::uint64_t>(magnitude >> excess) | (sticky ? 1U : 0U);
+
+            const std::uint64_t sign = negative ? dst::sign_bit : 0;
+            const std::uint64_t bits = round_to<Dst>(msb, sig, msb - excess, nearest_even, fail);
+            return Dst{ static_cast<std::uint16_t>(sign | bits) };
+        }
+
+        template<typename H>
+        NODISCARD inline auto widen(H val) noexcept -> float
+        {
+            using src = format_of<H>;
+
+            const std::uint32_t bits = val.bits;
+            const std::uint32_t sign = (bits & src::sign_bit) != 0 ? 0x8000'0000U : 0U;
+            const std::uint32_t exp_field = (bits >> src::mant_bits) & static_cast<std::uint32_t>(src::exp_mask);
+            const std::uint32_t mant = bits & static_cast<std::uint32_t>(src::mant_mask);
+
+            std::uint32_t out = sign;
+
+            if (exp_field == src::exp_mask)
+            {
+                out |= 0x7F80'0000U | (mant << (23 - src::mant_bits));
+            }
+            else if (exp_field == 0)
+            {
+                if (mant != 0)
+                {
+                    // Subnormal: exact, as every subnormal of the source is a normal (or subnormal) float
+                    constexpr float scale = math::pow2<float>(src::min_exp - src::mant_bits);
+                    const float magnitude = static_cast<float>(mant) * scale;
+                    return sign != 0 ? -magnitude : magnitude;
+                }
+            }
+            else
+            {
+                const std::uint32_t exp_adjust = static_cast<std::uint32_t>(127 - src::bias);
+                out |= ((exp_field + exp_adjust) << 23) | (mant << (23 - src::mant_bits));
+            }
+
+            float result{};
+            std::memcpy(&result, &out, sizeof(result));
+            return result;
+        }
+
+        NODISCARD constexpr auto is_round_even(op_round_even /*tag*/) noexcept -> bool
+        {
+            return true;
+        }
+
+        NODISCARD constexpr auto is_round_even(math::float_op_truncate /*tag*/) noexcept -> bool
+        {
+            return false;
+        }
+
+        template<typename To>
+        using default_op = std::conditional_t<is_half_type<To>::value, op_round_even, math::float_op_default>;
+
+        // Narrowing into a half type from a floating point value
+        template<bool Checked, typename To, typename From, typename Op,
+            std::enable_if_t<(is_half_type<To>::value && std::is_floating_point<From>::value), bool> = true>
+        inline auto convert(From from_val, Op tag) noexcept(!Checked) -> To
+        {
+            static_assert(!std::is_same<From, long double>::value,
+                "half_cast from long double is not supported (convert to double first)");
+
+            failure fail = failure::none;
+            const To result = narrow_float<To>(from_val, is_round_even(tag), fail);
+
+            if (Checked && UNLIKELY(fail != failure::none))
+            {
+                throw_failure(fail);
+            }
+
+            return result;
+        }
+
+        // Narrowing into a half type from an integer
+        template<bool Checked, typename To, typename From, typename Op,
+            std::enable_if_t<(is_half_type<To>::value && is_integer<From>::value), bool> = true>
+        inline auto convert(From from_val, Op tag) noexcept(!Checked) -> To
+        {
+            failure fail = failure::none;
+            const To result = narrow_int<To>(from_val, is_round_even(tag), fail);
+
+            if (Checked && UNLIKELY(fail != failure::none))
+            {
+                throw_failure(fail);
+            }
+
+            return result;
+        }
+
+        // Converting between the two half types (exact widening to float first)
+        template<bool Checked, typename To, typename From, typename Op,
+            std::enable_if_t<(is_half_type<To>::value && is_half_type<From>::value), bool> = true>
+        inline auto convert(From from_val, Op tag) noexcept(!Checked) -> To
+        {
+            return convert<Checked, To>(widen(from_val), tag);
+        }
+
+        // Widening from a half type to a floating point type (always exact)
+        template<bool Checked, typename To, typename From, typename Op,
+            std::enable_if_t<(std::is_floating_point<To>::value && is_half_type<From>::value), bool> = true>
+        inline auto convert(From from_val, Op /*tag*/) noexcept -> To
+        {
+            return static_cast<To>(widen(from_val));
+        }
+
+        // From a half type to an integer, following the float_cast rules
+        template<bool Checked, typename To, typename From, typename Op,
+            std::enable_if_t<(is_integer<To>::value && is_half_type<From>::value && Checked), bool> = true>
+        inline auto convert(From from_val, Op tag) -> To
+        {
+            return float_cast_checked<To>(widen(from_val), tag);
+        }
+
+        template<bool Checked, typename To, typename From, typename Op,
+            std::enable_if_t<(is_integer<To>::value && is_half_type<From>::value && !Checked), bool> = true>
+        inline auto convert(From from_val, Op tag) noexcept -> To
+        {
+            return float_cast_unchecked<To>(widen(from_val), tag);
+        }
+    } //namespace half
+} // namespace detail
+
+/// @brief Type trait to determine if two types are able to be cast via half_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - At least one of @p To or @p From must be float16_t or bfloat16_t.
+/// - The other type must be a half type, a floating point type or an integral type (cannot be a bool).
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_half_castable :
+    std::integral_constant<bool,
+        ((detail::half::is_half_type<To>::value || detail::half::is_half_type<From>::value)
+            && (detail::half::is_half_type<To>::value || detail::is_arithmetic<To>::value)
+            && (detail::half::is_half_type<From>::value || detail::is_arithmetic<From>::value)
+            && !std::is_same<To, bool>::value && !std::is_same<From, bool>::value)>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_half_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_half_castable_v = is_half_castable<To, From>::value;
+
+/// @brief Namespace containing the rounding tags supported when casting to a half type.
+///
+/// Casting from a half type to an integer accepts any of the float_cast_op tags instead.
+namespace half_cast_op
+{
+    /// @brief Tag for rounding to the nearest representable value, ties to even (the IEEE 754 default).
+    INLINE_CONSTEXPR detail::half::op_round_even round_even{};
+
+    /// @brief Tag for rounding towards zero.
+    INLINE_CONSTEXPR detail::math::float_op_truncate truncate{};
+} //namespace half_cast_op
+
+/// @brief Casts to or from a half type without performing runtime checks.
+///
+/// NaN and Infinity are preserved, and values too large for a half type become Infinity (round_even) or the largest
+/// finite value (truncate).
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation (half_cast_op::round_even by default when casting to a half type, the default
+/// float_cast operation when casting to an integer).
+/// @param from_val The value to cast.
+/// @param op The operation to perform.
+/// @return The casted value.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+NODISCARD inline auto half_cast_unchecked(From from_val, Op op = Op{}) noexcept -> To
+{
+    static_assert(is_half_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::half::convert<false, To>(from_val, op);
+}
+
+/// @brief Casts to or from a half type with runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation (half_cast_op::round_even by default when casting to a half type, the default
+/// float_cast operation when casting to an integer).
+/// @param from_val The value to cast.
+/// @param op The operation to perform.
+/// @return The casted value.
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+NODISCARD inline auto half_cast_checked(From from_val, Op op = Op{}) -> To
+{
+    static_assert(is_half_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::half::convert<true, To>(from_val, op);
+}
+
+/// @brief Casts to or from a half type. Based on configuration this will call half_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param from_val The value to cast.
+/// @param op The operation to perform.
+/// @return The casted value.
+/// @exception float_cast_error Thrown if the value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+NODISCARD inline auto half_cast(From from_val, Op op = Op{}) -> std::enable_if_t<CHECK_CASTS, To>
+{
+    return half_cast_checked<To>(from_val, op);
+}
+
+/// @brief Casts to or from a half type. Based on configuration this will call half_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param from_val The value to cast.
+/// @param op The operation to perform.
+/// @return The casted value.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+NODISCARD inline auto half_cast(From from_val, Op op = Op{}) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    return half_cast_unchecked<To>(from_val, op);
+}
+
+namespace detail
+{
+    namespace half
+    {
+        template<bool Checked, typename To, typename From, typename Op>
+        inline auto batch_simd(const From* /*input*/, std::size_t /*count*/, To* /*output*/, Op /*tag*/,
+            bool& /*valid*/) noexcept -> std::size_t
+        {
+            // No vector kernel for this combination, the scalar loop handles every element
+            return 0;
+        }
+
+        /// Smallest magnitude that no longer fits (after rounding) in @p To, as a float.
+        template<typename To>
+        NODISCARD inline auto overflow_threshold(bool nearest_even) noexcept -> float
+        {
+            using fmt = format_of<To>;
+
+            // Largest finite value plus half an ulp (nearest) or a whole ulp (truncate)
+            const std::uint32_t max_exp = static_cast<std::uint32_t>(fmt::exp_mask - 1 - fmt::bias + 127);
+            const std::uint32_t threshold =
+                (max_exp << 23) | (0x007F'FFFFU & ~((1U << (23 - fmt::mant_bits - (nearest_even ? 1 : 0))) - 1));
+            const std::uint32_t bits = nearest_even ? threshold : ((max_exp + 1) << 23);
+
+            float result{};
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+#ifdef __F16C__
+        NODISCARD inline auto to_ph(__m256 val, op_round_even /*tag*/) noexcept -> __m128i
+        {
+            return _mm256_cvtps_ph(val, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        NODISCARD inline auto to_ph(__m256 val, math::float_op_truncate /*tag*/) noexcept -> __m128i
+        {
+            return _mm256_cvtps_ph(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        template<bool Checked, typename Op>
+        inline auto batch_simd(const float* input, std::size_t count, float16_t* output, Op tag, bool& valid) noexcept
+            -> std::size_t
+        {
+            const __m256 sign_mask = _mm256_set1_ps(-0.0F);
+            const __m256 threshold = _mm256_set1_ps(overflow_threshold<float16_t>(is_round_even(tag)));
+            __m256 all_valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                const __m256 val = _mm256_loadu_ps(input + idx);
+
+                if (Checked)
+                {
+                    // A single ordered compare rejects NaN, Infinity and overflow
+                    all_valid = _mm256_and_ps(
+                        all_valid, _mm256_cmp_ps(_mm256_andnot_ps(sign_mask, val), threshold, _CMP_LT_OQ));
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + idx), to_ph(val, tag));
+            }
+
+            valid = _mm256_movemask_ps(all_valid) == 0xFF;
+            return idx;
+        }
+
+        template<bool Checked, typename Op>
+        inline auto batch_simd(const float16_t* input, std::size_t count, float* output, Op /*tag*/,
+            bool& /*valid*/) noexcept -> std::size_t
+        {
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                _mm256_storeu_ps(
+                    output + idx, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + idx))));
+            }
+
+            return idx;
+        }
+#endif
+
+#ifdef __AVX2__
+        NODISCARD inline auto round_bf16_lanes(__m256i bits, op_round_even /*tag*/) noexcept -> __m256i
+        {
+            const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+            return _mm256_add_epi32(bits, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), lsb));
+        }
+
+        NODISCARD inline auto round_bf16_lanes(__m256i bits, math::float_op_truncate /*tag*/) noexcept -> __m256i
+        {
+            return bits;
+        }
+
+        template<bool Checked, typename Op>
+        inline auto batch_simd_bf16_avx2(const float* input, std::size_t count, bfloat16_t* output, Op tag,
+            bool& valid) noexcept -> std::size_t
+        {
+            const __m256i abs_mask = _mm256_set1_epi32(0x7FFF'FFFF);
+            const __m256i inf_bits = _mm256_set1_epi32(0x7F80'0000);
+            const __m256i quiet_bit = _mm256_set1_epi32(0x0040'0000);
+            const __m256 sign_mask = _mm256_set1_ps(-0.0F);
+            const __m256 threshold = _mm256_set1_ps(overflow_threshold<bfloat16_t>(is_round_even(tag)));
+            __m256 all_valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            std::size_t idx = 0;
+
+            for (; idx + 16 <= count; idx += 16)
+            {
+                __m256i halves[2];
+
+                for (int part = 0; part < 2; ++part)
+                {
+                    const float* const src = input + idx + (8 * static_cast<std::size_t>(part));
+                    const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+
+                    if (Checked)
+                    {
+                        const __m256 val = _mm256_castsi256_ps(bits);
+                        all_valid = _mm256_and_ps(
+                            all_valid, _mm256_cmp_ps(_mm256_andnot_ps(sign_mask, val), threshold, _CMP_LT_OQ));
+                    }
+
+                    // NaN lanes are quieted instead of rounded, so a payload carry can never turn them into Infinity
+                    const __m256i is_nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, abs_mask), inf_bits);
+                    const __m256i rounded = _mm256_blendv_epi8(
+                        round_bf16_lanes(bits, tag), _mm256_or_si256(bits, quiet_bit), is_nan);
+                    halves[part] = _mm256_srli_epi32(rounded, 16);
+                }
+
+                const __m256i packed =
+                    _mm256_permute4x64_epi64(_mm256_packus_epi32(halves[0], halves[1]), 0xD8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + idx), packed);
+            }
+
+            valid = _mm256_movemask_ps(all_valid) == 0xFF;
+            return idx;
+        }
+
+        template<bool Checked>
+        inline auto batch_simd(const float* input, std::size_t count, bfloat16_t* output,
+            math::float_op_truncate tag, bool& valid) noexcept -> std::size_t
+        {
+            return batch_simd_bf16_avx2<Checked>(input, count, output, tag, valid);
+        }
+
+#  ifndef __AVX512BF16__
+        template<bool Checked>
+        inline auto batch_simd(const float* input, std::size_t count, bfloat16_t* output, op_round_even tag,
+            bool& valid) noexcept -> std::size_t
+        {
+            return batch_simd_bf16_avx2<Checked>(input, count, output, tag, valid);
+        }
+#  endif
+
+        template<bool Checked, typename Op>
+        inline auto batch_simd(const bfloat16_t* input, std::size_t count, float* output, Op /*tag*/,
+            bool& /*valid*/) noexcept -> std::size_t
+        {
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                const __m256i bits =
+                    _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + idx)));
+                _mm256_storeu_ps(output + idx, _mm256_castsi256_ps(_mm256_slli_epi32(bits, 16)));
+            }
+
+            return idx;
+        }
+#endif
+
+#if defined(__AVX512BF16__) && defined(__AVX2__)
+        template<bool Checked>
+        inline auto batch_simd(const float* input, std::size_t count, bfloat16_t* output, op_round_even tag,
+            bool& valid) noexcept -> std::size_t
+        {
+            const __m512i exponent_mask = _mm512_set1_epi32(0x7F80'0000);
+            const __m512i abs_mask = _mm512_set1_epi32(0x7FFF'FFFF);
+            const __m512 threshold = _mm512_set1_ps(overflow_threshold<bfloat16_t>(is_round_even(tag)));
+            __mmask16 all_valid = 0xFFFF;
+
+            std::size_t idx = 0;
+
+            for (; idx + 16 <= count; idx += 16)
+            {
+                const __m512 val = _mm512_loadu_ps(input + idx);
+
+                if (Checked)
+                {
+                    all_valid = static_cast<__mmask16>(
+                        all_valid & _mm512_cmp_ps_mask(_mm512_abs_ps(val), threshold, _CMP_LT_OQ));
+                }
+
+                // vcvtneps2bf16 flushes subnormal inputs to zero, so blocks holding one (a zero exponent with a
+                // non-zero mantissa) are rounded by the AVX2 kernel like the scalar path
+                const __m512i bits = _mm512_castps_si512(val);
+                const __mmask16 subnormal = _mm512_mask_testn_epi32_mask(
+                    _mm512_test_epi32_mask(bits, abs_mask), bits, exponent_mask);
+
+                if (UNLIKELY(subnormal != 0))
+                {
+                    bool ignored = true;
+                    (void)batch_simd_bf16_avx2<false>(input + idx, 16, output + idx, tag, ignored);
+                    continue;
+                }
+
+                const __m256bh converted = _mm512_cvtneps_pbh(val);
+                std::memcpy(output + idx, &converted, sizeof(converted));
+            }
+
+            valid = all_valid == 0xFFFF;
+            return idx;
+        }
+#endif
+
+        template<bool Checked, typename To, typename From, typename Op>
+        inline auto batch(const From* input, std::size_t count, To* output, Op tag) noexcept(!Checked) -> void
+        {
+            bool valid = true;
+            const std::size_t done = batch_simd<Checked>(input, count, output, tag, valid);
+
+            if (Checked && !valid)
+            {
+                // Cold path: rerun the checked scalar cast to find (and report) the first offending element
+                for (std::size_t idx = 0; idx < done; ++idx)
+                {
+                    (void)convert<true, To>(input[idx], tag);
+                }
+            }
+
+            for (std::size_t idx = done; idx < count; ++idx)
+            {
+                output[idx] = convert<Checked, To>(input[idx], tag);
+            }
+        }
+    } //namespace half
+} // namespace detail
+
+/// @brief Casts an array of values to or from a half type without performing runtime checks.
+///
+/// Uses F16C (float16), AVX-512 BF16 or AVX2 (bfloat16) kernels for float arrays when the target supports them,
+/// and the portable scalar path otherwise.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+void half_cast_batch_unchecked(const From* input, std::size_t count, To* output, Op op = Op{}) noexcept
+{
+    static_assert(is_half_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::half::batch<false>(input, count, output, op);
+}
+
+/// @brief Casts an array of values to or from a half type with runtime checks.
+///
+/// The range and NaN checks are folded into the vector kernels. The contents of @p output are unspecified if an
+/// error is thrown.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+void half_cast_batch_checked(const From* input, std::size_t count, To* output, Op op = Op{})
+{
+    static_assert(is_half_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::half::batch<true>(input, count, output, op);
+}
+
+/// @brief Casts an array of values to or from a half type. Based on configuration this will call
+/// half_cast_batch_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+auto half_cast_batch(const From* input, std::size_t count, To* output, Op op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && is_half_castable_v<To, From>>
+{
+    half_cast_batch_checked(input, count, output, op);
+}
+
+/// @brief Casts an array of values to or from a half type. Based on configuration this will call
+/// half_cast_batch_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+template<typename To, typename From, typename Op = detail::half::default_op<To>>
+auto half_cast_batch(const From* input, std::size_t count, To* output, Op op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_half_castable_v<To, From>>
+{
+    half_cast_batch_unchecked(input, count, output, op);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_HALF_CAST_HPP
@@ -0,0 +1,383 @@
+///@file narrowed_vector.hpp
+///@author Jackson Harmer
+///@brief Integer container that stores its elements at the smallest width (8, 16, 32 or 64 bits) they fit in.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_NARROWED_VECTOR_HPP
+#define BETTER_CASTS_NARROWED_VECTOR_HPP
+
+#include "../better_casts.hpp"
+#include "detail/family.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace casts
+{
+namespace detail
+{
+    namespace narrowed
+    {
+        template<std::size_t Size, bool Signed>
+        struct int_of_size
+        {
+        };
+
+        template<bool Signed>
+        struct int_of_size<1, Signed>
+        {
+            using type = std::conditional_t<Signed, std::int8_t, std::uint8_t>;
+        };
+
+        template<bool Signed>
+        struct int_of_size<2, Signed>
+        {
+            using type = std::conditional_t<Signed, std::int16_t, std::uint16_t>;
+        };
+
+        template<bool Signed>
+        struct int_of_size<4, Signed>
+        {
+            using type = std::conditional_t<Signed, std::int32_t, std::uint32_t>;
+        };
+
+        template<bool Signed>
+        struct int_of_size<8, Signed>
+        {
+            using type = std::conditional_t<Signed, std::int64_t, std::uint64_t>;
+        };
+
+        /// The size of the type a narrowed_vector<T> stores its elements as at @p level (the log2 of the width). Levels
+        /// wider than @p T store a @p T, and are never used.
+        template<typename T>
+        constexpr auto lane_size(unsigned level) noexcept -> std::size_t
+        {
+            return (std::size_t{ 1 } << level) < sizeof(T) ? (std::size_t{ 1 } << level) : sizeof(T);
+        }
+
+        template<typename T, unsigned Level>
+        using lane_t = typename int_of_size<lane_size<T>(Level), is_signed<T>::value>::type;
+
+        /// The number of elements whose width is checked at once by the bulk operations.
+        constexpr std::size_t block = 4096;
+
+        /// The smallest level whose lane fits @p val, checked like narrow_cast_checked.
+        template<typename T>
+        NODISCARD FORCE_INLINE auto level_of(T val) noexcept -> unsigned
+        {
+            lane_t<T, 0> byte{};
+            lane_t<T, 1> half{};
+            lane_t<T, 2> word{};
+
+            return family::try_convert(val, byte) ? 0U
+                : family::try_convert(val, half)  ? 1U
+                : family::try_convert(val, word)  ? 2U
+                                                  : 3U;
+        }
+
+        /// A value that fits a lane exactly when every one of @p values does: the values (or their one's complement,
+        /// for negative values) ORed together. A single reduction, so it vectorizes with any instruction set.
+        template<typename T>
+        NODISCARD inline auto envelope(const T* values, std::size_t count) noexcept -> T
+        {
+            using U = make_unsigned_t<T>;
+            constexpr int sign_shift = std::numeric_limits<U>::digits - 1;
+
+            U bits = 0;
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                const auto val = static_cast<U>(values[idx]);
+                // All ones for a negative signed value, zero otherwise
+                const U negative = is_signed<T>::value ? static_cast<U>(U{ 0 } - static_cast<U>(val >> sign_shift))
+                                                       : U{ 0 };
+
+                bits = static_cast<U>(bits | (val ^ negative));
+            }
+
+            return static_cast<T>(bits);
+        }
+
+        template<typename To, typename From>
+        inline void copy(const From* input, std::size_t count, To* output) noexcept
+        {
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                output[idx] = static_cast<To>(input[idx]);
+            }
+        }
+    } //namespace narrowed
+} // namespace detail
+
+/// @brief Sequence of integers stored at the smallest width (8, 16, 32 or 64 bits, up to the width of @p T) that
+/// every element fits in, so that a column of small values takes a fraction of the memory of a std::vector<T>.
+///
+/// Inserting a value that would fail the narrow_cast check for the current width widens the whole storage first,
+/// once. The storage never narrows by itself; shrink_to_fit() narrows it back to the width of the current elements.
+/// Elements are returned by value, as they are not stored as a @p T.
+///
+/// @tparam T The integral type of the elements (at most 64 bits).
+template<typename T>
+class narrowed_vector
+{
+    static_assert(detail::is_integer<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= sizeof(std::int64_t),
+        "T must be an integral type of at most 64 bits");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// @brief Constructs an empty vector, stored at 8 bits.
+    narrowed_vector() = default;
+
+    /// @brief Constructs a vector holding @p count values copied from @p values.
+    narrowed_vector(const T* values, std::size_t count) { append(values, count); }
+
+    /// @brief Constructs a vector holding @p values.
+    narrowed_vector(std::initializer_list<T> values) { append(values.begin(), values.size()); }
+
+    /// @brief Returns the number of elements.
+    NODISCARD auto size() const noexcept -> std::size_t { return m_size; }
+
+    /// @brief Returns true if there are no elements.
+    NODISCARD auto empty() const noexcept -> bool { return m_size == 0; }
+
+    /// @brief Returns the size of a stored element, in bytes (1, 2, 4 or 8).
+    NODISCARD auto width() const noexcept -> std::size_t
+    {
+        return detail::narrowed::lane_size<T>(m_level);
+    }
+
+    /// @brief Returns the number of elements that fit in the allocated storage at the current width.
+    NODISCARD auto capacity() const noexcept -> std::size_t
+    {
+        std::size_t result = 0;
+        visit_lanes([&](const auto& lanes) { result = lanes.capacity(); });
+        return result;
+    }
+
+    /// @brief Returns the size of the allocated storage, in bytes.
+    NODISCARD auto storage_bytes() const noexcept -> std::size_t { return capacity() * width(); }
+
+    /// @brief Returns the element at @p idx (which must be less than size()).
+    NODISCARD auto operator[](std::size_t idx) const noexcept -> T
+    {
+        T result{};
+        visit_lanes([&](const auto& lanes) { result = static_cast<T>(lanes[idx]); });
+        return result;
+    }
+
+    /// @brief Returns the last element (the vector must not be empty).
+    NODISCARD auto back() const noexcept -> T { return (*this)[m_size - 1]; }
+
+    /// @brief Reserves storage for @p count elements at the current width.
+    void reserve(std::size_t count)
+    {
+        visit_lanes([&](auto& lanes) { lanes.reserve(count); });
+    }
+
+    /// @brief Appends @p val, widening the storage first if it does not fit the current width.
+    void push_back(T val)
+    {
+        const unsigned level = detail::narrowed::level_of(val);
+
+        if (level > m_level)
+        {
+            relayout(level);
+        }
+
+        visit_lanes([&](auto& lanes) { lanes.push_back(static_cast<lane_of_t<decltype(lanes)>>(val)); });
+        ++m_size;
+    }
+
+    /// @brief Appends @p count values copied from @p values, widening the storage first (once per block of values)
+    /// if they do not fit the current width.
+    ///
+    /// The width check is a single reduction per block and the copy a plain narrowing loop, so both vectorize.
+    void append(const T* values, std::size_t count)
+    {
+        reserve(m_size + count);
+
+        for (std::size_t first = 0; first < count; first += detail::narrowed::block)
+        {
+            const std::size_t size =
+                count - first < detail::narrowed::block ? count - first : detail::narrowed::block;
+            const unsigned level = detail::narrowed::level_of(detail::narrowed::envelope(values + first, size));
+
+            if (level > m_level)
+            {
+                relayout(level);
+            }
+
+            visit_lanes(
+                [&](auto& lanes)
+                {
+                    lanes.resize(m_size + size);
+                    detail::narrowed::copy(values + first, size, lanes.data() + m_size);
+                });
+            m_size += size;
+        }
+    }
+
+    /// @brief Replaces the element at @p idx (which must be less than size()) with @p val, widening the storage
+    /// first if it does not fit the current width.
+    void set(std::size_t idx, T val)
+    {
+        const unsigned level = detail::narrowed::level_of(val);
+
+        if (level > m_level)
+        {
+            relayout(level);
+        }
+
+        visit_lanes([&](auto& lanes) { lanes[idx] = static_cast<lane_of_t<decltype(lanes)>>(val); });
+    }
+
+    /// @brief Removes the last element (the vector must not be empty). The width is kept.
+    void pop_back() noexcept
+    {
+        visit_lanes([](auto& lanes) { lanes.pop_back(); });
+        --m_size;
+    }
+
+    /// @brief Removes every element and releases the storage, returning to a width of 8 bits.
+    void clear() noexcept
+    {
+        visit_lanes([](auto& lanes) { std::decay_t<decltype(lanes)>{}.swap(lanes); });
+        m_level = 0;
+        m_size = 0;
+    }
+
+    /// @brief Narrows the storage to the width of the current elements and releases the unused capacity.
+    void shrink_to_fit()
+    {
+        unsigned level = 0;
+        visit_data([&](const auto* data, std::size_t size)
+            { level = detail::narrowed::level_of(static_cast<T>(detail::narrowed::envelope(data, size))); });
+
+        if (level != m_level)
+        {
+            relayout(level);
+        }
+
+        visit_lanes([](auto& lanes) { lanes.shrink_to_fit(); });
+    }
+
+    /// @brief Copies @p count elements starting at @p first (which must be in range) to @p output, as @p T values.
+    ///
+    /// A plain widening loop over the stored elements, so it vectorizes.
+    void copy_to(std::size_t first, std::size_t count, T* output) const noexcept
+    {
+        visit_data(
+            [&](const auto* data, std::size_t /*size*/) { detail::narrowed::copy(data + first, count, output); });
+    }
+
+    /// @brief Calls @p func with a pointer to the stored elements and their count, as the integer type of the current
+    /// width (ex. `const std::int16_t*`). Scans written against the stored type read a fraction of the memory of a
+    /// std::vector<T> and vectorize with a lane per stored element.
+    ///
+    /// @param func A callable accepting `(const W*, std::size_t)` for each stored type W (ex. a generic lambda).
+    template<typename Func>
+    void visit(Func&& func) const
+    {
+        visit_data(func);
+    }
+
+private:
+    template<typename Lanes>
+    using lane_of_t = typename std::decay_t<Lanes>::value_type;
+
+    template<unsigned Level>
+    using lanes_t = std::vector<detail::narrowed::lane_t<T, Level>>;
+
+    /// Calls @p func with the storage of the current level (of @p self, a const or non-const narrowed_vector).
+    template<typename Self, typename Func>
+    static void with_lanes(Self& self, Func&& func)
+    {
+        switch (self.m_level)
+        {
+            case 0:
+                func(std::get<0>(self.m_lanes));
+                break;
+            case 1:
+                func(std::get<1>(self.m_lanes));
+                break;
+            case 2:
+                func(std::get<2>(self.m_lanes));
+                break;
+            default:
+                func(std::get<3>(self.m_lanes));
+                break;
+        }
+    }
+
+    template<typename Func>
+    void visit_lanes(Func&& func)
+    {
+        with_lanes(*this, func);
+    }
+
+    template<typename Func>
+    void visit_lanes(Func&& func) const
+    {
+        with_lanes(*this, func);
+    }
+
+    template<typename Func>
+    void visit_data(Func&& func) const
+    {
+        visit_lanes([&](const auto& lanes) { func(lanes.data(), lanes.size()); });
+    }
+
+    /// Moves the elements to the storage of @p level, keeping room for the current capacity.
+    void relayout(unsigned level)
+    {
+        switch (level)
+        {
+            case 0:
+                relayout_to<0>();
+                break;
+            case 1:
+                relayout_to<1>();
+                break;
+            case 2:
+                relayout_to<2>();
+                break;
+            default:
+                relayout_to<3>();
+                break;
+        }
+    }
+
+    template<unsigned Level>
+    void relayout_to()
+    {
+        lanes_t<Level> target;
+
+        visit_lanes(
+            [&](auto& lanes)
+            {
+                target.reserve(lanes.capacity());
+                target.resize(lanes.size());
+                detail::narrowed::copy(lanes.data(), lanes.size(), target.data());
+                std::decay_t<decltype(lanes)>{}.swap(lanes);
+            });
+
+        std::get<Level>(m_lanes).swap(target);
+        m_level = Level;
+    }
+
+    // Only the storage of the current level holds elements; the others are empty
+    std::tuple<lanes_t<0>, lanes_t<1>, lanes_t<2>, lanes_t<3>> m_lanes{};
+    unsigned m_level = 0;
+    std::size_t m_size = 0;
+};
+} // namespace casts
+
+#endif // BETTER_CASTS_NARROWED_VECTOR_HPP
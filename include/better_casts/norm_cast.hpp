@@ -0,0 +1,670 @@
+///@file norm_cast.hpp
+///@author Jackson Harmer
+///@brief Casts between floating point values and normalized integers (GPU unorm and snorm formats).
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_NORM_CAST_HPP
+#define BETTER_CASTS_NORM_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace casts
+{
+/// @brief Type trait to determine if a type is an unsigned normalized integer type (std::uint8_t or std::uint16_t).
+template<typename T>
+struct is_unorm_type :
+    std::integral_constant<bool, std::is_same<T, std::uint8_t>::value || std::is_same<T, std::uint16_t>::value>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_unorm_type.
+template<typename T>
+INLINE_CONSTEXPR bool is_unorm_type_v = is_unorm_type<T>::value;
+
+/// @brief Type trait to determine if a type is a signed normalized integer type (std::int8_t or std::int16_t).
+template<typename T>
+struct is_snorm_type :
+    std::integral_constant<bool, std::is_same<T, std::int8_t>::value || std::is_same<T, std::int16_t>::value>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_snorm_type.
+template<typename T>
+INLINE_CONSTEXPR bool is_snorm_type_v = is_snorm_type<T>::value;
+
+/// @brief Type trait to determine if two types are able to be cast via unorm_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - One of @p To or @p From must be an unsigned normalized integer type (see is_unorm_type).
+/// - The other type must be `float` or `double`.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_unorm_castable :
+    std::integral_constant<bool,
+        ((is_unorm_type_v<To> && (std::is_same<From, float>::value || std::is_same<From, double>::value))
+            || ((std::is_same<To, float>::value || std::is_same<To, double>::value) && is_unorm_type_v<From>))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_unorm_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_unorm_castable_v = is_unorm_castable<To, From>::value;
+
+/// @brief Type trait to determine if two types are able to be cast via snorm_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - One of @p To or @p From must be a signed normalized integer type (see is_snorm_type).
+/// - The other type must be `float` or `double`.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_snorm_castable :
+    std::integral_constant<bool,
+        ((is_snorm_type_v<To> && (std::is_same<From, float>::value || std::is_same<From, double>::value))
+            || ((std::is_same<To, float>::value || std::is_same<To, double>::value) && is_snorm_type_v<From>))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_snorm_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_snorm_castable_v = is_snorm_castable<To, From>::value;
+
+namespace detail
+{
+    namespace norm
+    {
+        /// Normalized range of @p T: [0, 1] for unorm and [-1, 1] for snorm, scaled by the largest value of @p T.
+        template<typename T, typename F>
+        struct bounds
+        {
+            static constexpr F scale = static_cast<F>((std::numeric_limits<T>::max)());
+            static constexpr F lower = std::is_signed<T>::value ? -math::float_const<F>::ONE : F{ 0 };
+            static constexpr F upper = math::float_const<F>::ONE;
+        };
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::scale;
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::lower;
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::upper;
+
+        /// Clamps @p val to the normalized range, scales it and rounds to nearest (ties to even). NaN becomes 0.
+        template<typename T, typename F>
+        NODISCARD FORCE_INLINE constexpr auto to_int(F val) noexcept -> T
+        {
+            using limits = bounds<T, F>;
+
+            if (UNLIKELY(math::is_nan(val)))
+            {
+                return 0;
+            }
+
+            const F clamped = val < limits::lower ? limits::lower : (val > limits::upper ? limits::upper : val);
+            return math::round_even<T>(clamped * limits::scale);
+        }
+
+        /// The exact reference conversion: a correctly rounded division by the largest value, where the most
+        /// negative snorm value also maps to -1.
+        template<typename F, typename T>
+        NODISCARD constexpr auto divide(T val) noexcept -> F
+        {
+            const F quotient = static_cast<F>(val) / bounds<T, F>::scale;
+            return quotient < bounds<T, F>::lower ? bounds<T, F>::lower : quotient;
+        }
+
+        /// Every result of the 8-bit conversions, indexed by the bits of the value.
+        template<typename F, typename T>
+        struct byte_table
+        {
+            F values[256];
+
+            constexpr byte_table() noexcept : values{}
+            {
+                for (int idx = 0; idx < 256; ++idx)
+                {
+                    values[idx] = divide<F>(static_cast<T>(static_cast<std::uint8_t>(idx)));
+                }
+            }
+        };
+
+        template<typename F, typename T>
+        INLINE_CONSTEXPR byte_table<F, T> table{};
+
+        template<typename F, typename T>
+        NODISCARD FORCE_INLINE constexpr auto to_float(T val) noexcept -> std::enable_if_t<sizeof(T) == 1, F>
+        {
+            return table<F, T>.values[static_cast<std::uint8_t>(val)];
+        }
+
+        template<typename F, typename T>
+        NODISCARD FORCE_INLINE constexpr auto to_float(T val) noexcept -> std::enable_if_t<sizeof(T) != 1, F>
+        {
+            return divide<F>(val);
+        }
+
+        template<bool Checked, typename T, typename F>
+        inline auto to_norm_simd(const F* /*input*/, std::size_t /*count*/, T* /*output*/, bool& /*valid*/) noexcept
+            -> std::size_t
+        {
+            // No vector kernel for this combination, the scalar loop handles every element
+            return 0;
+        }
+
+        template<typename F, typename T>
+        inline auto to_float_simd(const T* /*input*/, std::size_t /*count*/, F* /*output*/) noexcept -> std::size_t
+        {
+            return 0;
+        }
+
+#ifdef __AVX2__
+        inline void store_lanes(std::uint8_t* output, __m256i val) noexcept
+        {
+            const __m128i words = simd::pack_i32_to_i16(val);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(words, words));
+        }
+
+        inline void store_lanes(std::int8_t* output, __m256i val) noexcept
+        {
+            const __m128i words = simd::pack_i32_to_i16(val);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packs_epi16(words, words));
+        }
+
+        inline void store_lanes(std::uint16_t* output, __m256i val) noexcept
+        {
+            const __m128i words = _mm_packus_epi32(_mm256_castsi256_si128(val), _mm256_extracti128_si256(val, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), words);
+        }
+
+        inline void store_lanes(std::int16_t* output, __m256i val) noexcept
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), simd::pack_i32_to_i16(val));
+        }
+
+        NODISCARD inline auto load_lanes(const std::uint8_t* input) noexcept -> __m256i
+        {
+            return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+        }
+
+        NODISCARD inline auto load_lanes(const std::int8_t* input) noexcept -> __m256i
+        {
+            return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+        }
+
+        NODISCARD inline auto load_lanes(const std::uint16_t* input) noexcept -> __m256i
+        {
+            return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+        }
+
+        NODISCARD inline auto load_lanes(const std::int16_t* input) noexcept -> __m256i
+        {
+            return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+        }
+
+        template<bool Checked, typename T>
+        inline auto to_norm_simd(const float* input, std::size_t count, T* output, bool& valid) noexcept
+            -> std::size_t
+        {
+            using limits = bounds<T, float>;
+
+            const __m256 lower = _mm256_set1_ps(limits::lower);
+            const __m256 upper = _mm256_set1_ps(limits::upper);
+            const __m256 scale = _mm256_set1_ps(limits::scale);
+            __m256 all_ordered = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            const std::size_t end = count - count % 8;
+
+            for (std::size_t idx = 0; idx < end; idx += 8)
+            {
+                const __m256 val = _mm256_loadu_ps(input + idx);
+                const __m256 ordered_mask = _mm256_cmp_ps(val, val, _CMP_ORD_Q);
+
+                if (Checked)
+                {
+                    all_ordered = _mm256_and_ps(all_ordered, ordered_mask);
+                }
+
+                // NaN lanes become 0 before the clamp, which would otherwise turn them into the lower bound
+                const __m256 ordered = _mm256_and_ps(val, ordered_mask);
+                const __m256 clamped = _mm256_min_ps(_mm256_max_ps(ordered, lower), upper);
+                const __m256 rounded = simd::round(_mm256_mul_ps(clamped, scale), math::float_op_round_even{});
+
+                store_lanes(output + idx, _mm256_cvttps_epi32(rounded));
+            }
+
+            valid = _mm256_movemask_ps(all_ordered) == 0xFF;
+            return end;
+        }
+
+        template<typename T>
+        inline auto to_float_simd(const T* input, std::size_t count, float* output) noexcept -> std::size_t
+        {
+            using limits = bounds<T, float>;
+
+            const __m256 lower = _mm256_set1_ps(limits::lower);
+            const __m256 scale = _mm256_set1_ps(limits::scale);
+
+            const std::size_t end = count - count % 8;
+
+            for (std::size_t idx = 0; idx < end; idx += 8)
+            {
+                // Division rather than a reciprocal multiply, to match the correctly rounded scalar conversion
+                const __m256 quotient = _mm256_div_ps(_mm256_cvtepi32_ps(load_lanes(input + idx)), scale);
+                _mm256_storeu_ps(output + idx, std::is_signed<T>::value ? _mm256_max_ps(quotient, lower) : quotient);
+            }
+
+            return end;
+        }
+#endif
+
+        template<bool Checked, typename T, typename F>
+        inline auto to_norm_batch(const F* input, std::size_t count, T* output) noexcept -> bool
+        {
+            bool valid = true;
+
+            for (std::size_t idx = to_norm_simd<Checked>(input, count, output, valid); idx < count; ++idx)
+            {
+                valid = valid && !math::is_nan(input[idx]);
+                output[idx] = to_int<T>(input[idx]);
+            }
+
+            return valid;
+        }
+
+        template<typename F, typename T>
+        inline void to_float_batch(const T* input, std::size_t count, F* output) noexcept
+        {
+            for (std::size_t idx = to_float_simd(input, count, output); idx < count; ++idx)
+            {
+                output[idx] = to_float<F>(input[idx]);
+            }
+        }
+
+        template<typename F>
+        NORETURN COLD inline void throw_batch_error(const char* name, const F* input, std::size_t count)
+        {
+            std::size_t idx = 0;
+
+            while (idx < count && !math::is_nan(input[idx]))
+            {
+                ++idx;
+            }
+
+            throw_cast_error<float_cast_error>(
+                (std::string(name) + " failed: cannot cast from NaN (input at index " + std::to_string(idx) + ")")
+                    .c_str());
+        }
+    } //namespace norm
+} // namespace detail
+
+/// @brief Casts a floating point value to an unsigned normalized integer without performing runtime checks.
+///
+/// Follows the GPU conversion rules: the value is clamped to [0, 1], scaled by the largest value of @p To and
+/// rounded to nearest (ties to even). NaN becomes 0.
+///
+/// @tparam To The unorm type to cast to (std::uint8_t or std::uint16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+template<typename To, typename From, std::enable_if_t<is_unorm_type_v<To>, bool> = true>
+NODISCARD FORCE_INLINE constexpr auto unorm_cast_unchecked(From from_val) noexcept -> To
+{
+    static_assert(is_unorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::norm::to_int<To>(from_val);
+}
+
+/// @brief Casts a floating point value to an unsigned normalized integer with runtime checks.
+///
+/// Values outside of [0, 1] are clamped as on a GPU, which is not an error.
+///
+/// @tparam To The unorm type to cast to (std::uint8_t or std::uint16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+/// @exception float_cast_error Thrown if the value is NaN.
+template<typename To, typename From, std::enable_if_t<is_unorm_type_v<To>, bool> = true>
+NODISCARD FORCE_INLINE constexpr auto unorm_cast_checked(From from_val) -> To
+{
+    static_assert(is_unorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(detail::math::is_nan(from_val)))
+    {
+        detail::throw_cast_error<float_cast_error>("unorm_cast failed: cannot cast from NaN");
+    }
+
+    return detail::norm::to_int<To>(from_val);
+}
+
+/// @brief Casts a floating point value to an unsigned normalized integer. Based on configuration this will call
+/// unorm_cast_checked.
+///
+/// @tparam To The unorm type to cast to (std::uint8_t or std::uint16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+/// @exception float_cast_error Thrown if the value is NaN.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto unorm_cast(From from_val)
+    -> std::enable_if_t<CHECK_CASTS && is_unorm_type_v<To>, To>
+{
+    return unorm_cast_checked<To>(from_val);
+}
+
+/// @brief Casts a floating point value to an unsigned normalized integer. Based on configuration this will call
+/// unorm_cast_unchecked.
+///
+/// @tparam To The unorm type to cast to (std::uint8_t or std::uint16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto unorm_cast(From from_val) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_unorm_type_v<To>, To>
+{
+    return unorm_cast_unchecked<To>(from_val);
+}
+
+/// @brief Casts an unsigned normalized integer to a floating point value in [0, 1] (no runtime checks needed).
+///
+/// The result is the correctly rounded quotient of the value and the largest value of @p From. 8-bit values are
+/// looked up in a table computed at compile time.
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam From The unorm type to cast from.
+/// @param from_val The value to cast.
+/// @return The floating point value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto unorm_cast(From from_val) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_unorm_type_v<From>, To>
+{
+    static_assert(is_unorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::norm::to_float<To>(from_val);
+}
+
+/// @brief Casts a floating point value to a signed normalized integer without performing runtime checks.
+///
+/// Follows the GPU conversion rules: the value is clamped to [-1, 1], scaled by the largest value of @p To and
+/// rounded to nearest (ties to even), so the most negative value of @p To is never produced. NaN becomes 0.
+///
+/// @tparam To The snorm type to cast to (std::int8_t or std::int16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+template<typename To, typename From, std::enable_if_t<is_snorm_type_v<To>, bool> = true>
+NODISCARD FORCE_INLINE constexpr auto snorm_cast_unchecked(From from_val) noexcept -> To
+{
+    static_assert(is_snorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::norm::to_int<To>(from_val);
+}
+
+/// @brief Casts a floating point value to a signed normalized integer with runtime checks.
+///
+/// Values outside of [-1, 1] are clamped as on a GPU, which is not an error.
+///
+/// @tparam To The snorm type to cast to (std::int8_t or std::int16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+/// @exception float_cast_error Thrown if the value is NaN.
+template<typename To, typename From, std::enable_if_t<is_snorm_type_v<To>, bool> = true>
+NODISCARD FORCE_INLINE constexpr auto snorm_cast_checked(From from_val) -> To
+{
+    static_assert(is_snorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(detail::math::is_nan(from_val)))
+    {
+        detail::throw_cast_error<float_cast_error>("snorm_cast failed: cannot cast from NaN");
+    }
+
+    return detail::norm::to_int<To>(from_val);
+}
+
+/// @brief Casts a floating point value to a signed normalized integer. Based on configuration this will call
+/// snorm_cast_checked.
+///
+/// @tparam To The snorm type to cast to (std::int8_t or std::int16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+/// @exception float_cast_error Thrown if the value is NaN.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto snorm_cast(From from_val)
+    -> std::enable_if_t<CHECK_CASTS && is_snorm_type_v<To>, To>
+{
+    return snorm_cast_checked<To>(from_val);
+}
+
+/// @brief Casts a floating point value to a signed normalized integer. Based on configuration this will call
+/// snorm_cast_unchecked.
+///
+/// @tparam To The snorm type to cast to (std::int8_t or std::int16_t).
+/// @tparam From The (floating point) type to cast from.
+/// @param from_val The value to cast.
+/// @return The normalized integer.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto snorm_cast(From from_val) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_snorm_type_v<To>, To>
+{
+    return snorm_cast_unchecked<To>(from_val);
+}
+
+/// @brief Casts a signed normalized integer to a floating point value in [-1, 1] (no runtime checks needed).
+///
+/// The result is the correctly rounded quotient of the value and the largest value of @p From, except that the most
+/// negative value also maps to -1. 8-bit values are looked up in a table computed at compile time.
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam From The snorm type to cast from.
+/// @param from_val The value to cast.
+/// @return The floating point value.
+template<typename To, typename From>
+NODISCARD FORCE_INLINE constexpr auto snorm_cast(From from_val) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_snorm_type_v<From>, To>
+{
+    static_assert(is_snorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::norm::to_float<To>(from_val);
+}
+
+/// @brief Casts an array of floating point values to unsigned normalized integers without performing runtime checks.
+///
+/// Interleaved pixel data (ex. RGBA) is converted as it is: pass pixels * channels as @p count. Uses AVX2 kernels for
+/// float input where available.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The unorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+template<typename From, typename To>
+auto unorm_cast_batch_unchecked(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<is_unorm_type_v<To>>
+{
+    static_assert(is_unorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    (void)detail::norm::to_norm_batch<false>(input, count, output);
+}
+
+/// @brief Casts an array of floating point values to unsigned normalized integers with runtime checks.
+///
+/// The NaN check is folded into the conversion and reported once at the end; the contents of @p output are
+/// unspecified if an error is thrown.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The unorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+/// @exception float_cast_error Thrown if any value is NaN.
+template<typename From, typename To>
+auto unorm_cast_batch_checked(const From* input, std::size_t count, To* output)
+    -> std::enable_if_t<is_unorm_type_v<To>>
+{
+    static_assert(is_unorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(!detail::norm::to_norm_batch<true>(input, count, output)))
+    {
+        detail::norm::throw_batch_error("unorm_cast", input, count);
+    }
+}
+
+/// @brief Casts an array of floating point values to unsigned normalized integers. Based on configuration this will
+/// call unorm_cast_batch_checked.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The unorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+/// @exception float_cast_error Thrown if any value is NaN.
+template<typename From, typename To>
+auto unorm_cast_batch(const From* input, std::size_t count, To* output)
+    -> std::enable_if_t<CHECK_CASTS && is_unorm_type_v<To>>
+{
+    unorm_cast_batch_checked(input, count, output);
+}
+
+/// @brief Casts an array of floating point values to unsigned normalized integers. Based on configuration this will
+/// call unorm_cast_batch_unchecked.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The unorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+template<typename From, typename To>
+auto unorm_cast_batch(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_unorm_type_v<To>>
+{
+    unorm_cast_batch_unchecked(input, count, output);
+}
+
+/// @brief Casts an array of unsigned normalized integers to floating point values (no runtime checks needed).
+///
+/// Uses AVX2 kernels for float output where available, and the 8-bit table otherwise.
+///
+/// @tparam From The unorm type to cast from.
+/// @tparam To The (floating point) type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count floating point values.
+template<typename From, typename To>
+auto unorm_cast_batch(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_unorm_type_v<From>>
+{
+    static_assert(is_unorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::norm::to_float_batch(input, count, output);
+}
+
+/// @brief Casts an array of floating point values to signed normalized integers without performing runtime checks.
+///
+/// Interleaved data is converted as it is: pass elements * channels as @p count. Uses AVX2 kernels for float input
+/// where available.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The snorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+template<typename From, typename To>
+auto snorm_cast_batch_unchecked(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<is_snorm_type_v<To>>
+{
+    static_assert(is_snorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    (void)detail::norm::to_norm_batch<false>(input, count, output);
+}
+
+/// @brief Casts an array of floating point values to signed normalized integers with runtime checks.
+///
+/// The NaN check is folded into the conversion and reported once at the end; the contents of @p output are
+/// unspecified if an error is thrown.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The snorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+/// @exception float_cast_error Thrown if any value is NaN.
+template<typename From, typename To>
+auto snorm_cast_batch_checked(const From* input, std::size_t count, To* output)
+    -> std::enable_if_t<is_snorm_type_v<To>>
+{
+    static_assert(is_snorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(!detail::norm::to_norm_batch<true>(input, count, output)))
+    {
+        detail::norm::throw_batch_error("snorm_cast", input, count);
+    }
+}
+
+/// @brief Casts an array of floating point values to signed normalized integers. Based on configuration this will
+/// call snorm_cast_batch_checked.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The snorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+/// @exception float_cast_error Thrown if any value is NaN.
+template<typename From, typename To>
+auto snorm_cast_batch(const From* input, std::size_t count, To* output)
+    -> std::enable_if_t<CHECK_CASTS && is_snorm_type_v<To>>
+{
+    snorm_cast_batch_checked(input, count, output);
+}
+
+/// @brief Casts an array of floating point values to signed normalized integers. Based on configuration this will
+/// call snorm_cast_batch_unchecked.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The snorm type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count normalized integers.
+template<typename From, typename To>
+auto snorm_cast_batch(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_snorm_type_v<To>>
+{
+    snorm_cast_batch_unchecked(input, count, output);
+}
+
+/// @brief Casts an array of signed normalized integers to floating point values (no runtime checks needed).
+///
+/// Uses AVX2 kernels for float output where available, and the 8-bit table otherwise.
+///
+/// @tparam From The snorm type to cast from.
+/// @tparam To The (floating point) type to cast to.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count floating point values.
+template<typename From, typename To>
+auto snorm_cast_batch(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_snorm_type_v<From>>
+{
+    static_assert(is_snorm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::norm::to_float_batch(input, count, output);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_NORM_CAST_HPP
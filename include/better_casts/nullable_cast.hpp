@@ -0,0 +1,287 @@
+///@file nullable_cast.hpp
+///@author Jackson Harmer
+///@brief Batch casts that mark failed elements as null in an Arrow-compatible validity bitmap instead of throwing.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_NULLABLE_CAST_HPP
+#define BETTER_CASTS_NULLABLE_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/family.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+namespace casts
+{
+namespace detail
+{
+    /// Counts the bits set in @p bits (a validity bitmap byte).
+    NODISCARD FORCE_INLINE auto popcount8(unsigned bits) noexcept -> std::size_t
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcount(bits));
+#elif defined(_MSC_VER)
+        return static_cast<std::size_t>(__popcnt(bits));
+#else
+        bits = bits - ((bits >> 1U) & 0x55U);
+        bits = (bits & 0x33U) + ((bits >> 2U) & 0x33U);
+        return static_cast<std::size_t>((bits + (bits >> 4U)) & 0x0FU);
+#endif
+    }
+
+    namespace nullable
+    {
+        /// Casts @p val, returning whether it fits in @p To (the stored value is zero if it does not). Checked like
+        /// narrow_cast_checked, so a floating point NaN is valid (and stored as NaN).
+        template<typename To, typename From>
+        NODISCARD inline auto narrow(From val, To& result) noexcept -> bool
+        {
+            const bool valid = family::try_convert(val, result, family::kind_tag<family::kind::narrow>{});
+
+            result = valid ? result : To{ 0 };
+            return valid;
+        }
+
+        template<typename To, typename From, typename Op>
+        NODISCARD inline auto round(From val, Op tag, To& result) noexcept -> bool
+        {
+            const From rounded = simd::round(val, tag);
+            const bool valid = math::fits_int<To>(rounded);
+
+            result = static_cast<To>(valid ? rounded : math::float_const<From>::ZERO);
+            return valid;
+        }
+
+        /// Applies @p cast to the elements from @p first (a multiple of 8) onwards and packs the results into an Arrow
+        /// validity bitmap (least significant bit first, set for valid elements), returning the number of valid
+        /// elements.
+        ///
+        /// Elements are handled one bitmap byte at a time: the inner loop has a constant trip count and no branches,
+        /// so the compiler can vectorize the conversion and the bit packing together.
+        template<typename To, typename From, typename Cast>
+        inline auto to_bitmap(const From* input, std::size_t first, std::size_t count, To* output,
+            std::uint8_t* validity, Cast cast) noexcept -> std::size_t
+        {
+            std::size_t valid_count = 0;
+            std::size_t idx = first;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                unsigned bits = 0;
+
+                for (unsigned lane = 0; lane < 8U; ++lane)
+                {
+                    bits |= static_cast<unsigned>(cast(input[idx + lane], output[idx + lane])) << lane;
+                }
+
+                validity[idx / 8] = static_cast<std::uint8_t>(bits);
+                valid_count += popcount8(bits);
+            }
+
+            if (idx < count)
+            {
+                unsigned bits = 0;
+
+                // Padding bits of the last byte are left cleared
+                for (unsigned lane = 0; idx + lane < count; ++lane)
+                {
+                    bits |= static_cast<unsigned>(cast(input[idx + lane], output[idx + lane])) << lane;
+                }
+
+                validity[idx / 8] = static_cast<std::uint8_t>(bits);
+                valid_count += popcount8(bits);
+            }
+
+            return valid_count;
+        }
+
+        template<typename To, typename From, typename Op>
+        inline auto to_bitmap_simd(const From* /*input*/, std::size_t /*count*/, To* /*output*/,
+            std::uint8_t* /*validity*/, Op /*tag*/, std::size_t& /*valid_count*/) noexcept -> std::size_t
+        {
+            // No vector kernel for this combination, the scalar loop handles every element
+            return 0;
+        }
+
+#ifdef __AVX2__
+        // The vector kernels produce one bitmap byte per iteration straight from the compare masks (movemask), and
+        // zero the null lanes before converting so NaN and out of range lanes are stored as zero.
+
+        template<typename Op>
+        inline auto to_bitmap_simd(const float* input, std::size_t count, std::int32_t* output, std::uint8_t* validity,
+            Op tag, std::size_t& valid_count) noexcept -> std::size_t
+        {
+            const __m256 lower = _mm256_set1_ps(math::int_bounds<std::int32_t, float>::lower);
+            const __m256 upper = _mm256_set1_ps(math::int_bounds<std::int32_t, float>::upper);
+
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                const __m256 rounded = simd::round(_mm256_loadu_ps(input + idx), tag);
+                const __m256 in_range = _mm256_and_ps(
+                    _mm256_cmp_ps(rounded, lower, _CMP_GE_OQ), _mm256_cmp_ps(rounded, upper, _CMP_LT_OQ));
+                const auto bits = static_cast<unsigned>(_mm256_movemask_ps(in_range));
+
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + idx), _mm256_cvttps_epi32(_mm256_and_ps(rounded, in_range)));
+                validity[idx / 8] = static_cast<std::uint8_t>(bits);
+                valid_count += popcount8(bits);
+            }
+
+            return idx;
+        }
+
+        template<typename Op>
+        inline auto to_bitmap_simd(const double* input, std::size_t count, std::int32_t* output,
+            std::uint8_t* validity, Op tag, std::size_t& valid_count) noexcept -> std::size_t
+        {
+            const __m256d lower = _mm256_set1_pd(math::int_bounds<std::int32_t, double>::lower);
+            const __m256d upper = _mm256_set1_pd(math::int_bounds<std::int32_t, double>::upper);
+
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                unsigned bits = 0;
+
+                for (unsigned half = 0; half < 2U; ++half)
+                {
+                    const __m256d rounded = simd::round(_mm256_loadu_pd(input + idx + 4 * half), tag);
+                    const __m256d in_range = _mm256_and_pd(
+                        _mm256_cmp_pd(rounded, lower, _CMP_GE_OQ), _mm256_cmp_pd(rounded, upper, _CMP_LT_OQ));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + idx + 4 * half),
+                        _mm256_cvttpd_epi32(_mm256_and_pd(rounded, in_range)));
+                    bits |= static_cast<unsigned>(_mm256_movemask_pd(in_range)) << (4 * half);
+                }
+
+                validity[idx / 8] = static_cast<std::uint8_t>(bits);
+                valid_count += popcount8(bits);
+            }
+
+            return idx;
+        }
+
+        template<typename Op>
+        inline auto to_bitmap_simd(const std::int64_t* input, std::size_t count, std::int32_t* output,
+            std::uint8_t* validity, Op /*tag*/, std::size_t& valid_count) noexcept -> std::size_t
+        {
+            const __m256i lower = _mm256_set1_epi64x((std::numeric_limits<std::int32_t>::min)());
+            const __m256i upper = _mm256_set1_epi64x((std::numeric_limits<std::int32_t>::max)());
+            const __m256i low_halves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+            std::size_t idx = 0;
+
+            for (; idx + 8 <= count; idx += 8)
+            {
+                unsigned bits = 0;
+
+                for (unsigned half = 0; half < 2U; ++half)
+                {
+                    const __m256i val = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + idx + 4 * half));
+                    const __m256i out_of_range =
+                        _mm256_or_si256(_mm256_cmpgt_epi64(val, upper), _mm256_cmpgt_epi64(lower, val));
+                    const __m256i packed =
+                        _mm256_permutevar8x32_epi32(_mm256_andnot_si256(out_of_range, val), low_halves);
+
+                    _mm_storeu_si128(
+                        reinterpret_cast<__m128i*>(output + idx + 4 * half), _mm256_castsi256_si128(packed));
+                    bits |= (~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(out_of_range))) & 0xFU)
+                        << (4 * half);
+                }
+
+                validity[idx / 8] = static_cast<std::uint8_t>(bits);
+                valid_count += popcount8(bits);
+            }
+
+            return idx;
+        }
+#endif
+
+        template<typename To, typename From, typename Op, typename Cast>
+        inline auto cast_to_bitmap(const From* input, std::size_t count, To* output, std::uint8_t* validity, Op tag,
+            Cast cast) noexcept -> std::size_t
+        {
+            std::size_t valid_count = 0;
+            const std::size_t done = to_bitmap_simd(input, count, output, validity, tag, valid_count);
+
+            return count - valid_count - to_bitmap(input, done, count, output, validity, cast);
+        }
+    } //namespace nullable
+} // namespace detail
+
+/// @brief Number of bytes needed for the validity bitmap of @p count elements.
+NODISCARD constexpr auto validity_bitmap_size(std::size_t count) noexcept -> std::size_t
+{
+    return (count + 7) / 8;
+}
+
+/// @brief Checks the validity bit of element @p idx in an Arrow validity bitmap.
+NODISCARD constexpr auto is_valid(const std::uint8_t* validity, std::size_t idx) noexcept -> bool
+{
+    return ((static_cast<unsigned>(validity[idx / 8]) >> (idx % 8U)) & 1U) != 0U;
+}
+
+/// @brief Casts an array of values to a smaller type, marking the values that do not fit as null.
+///
+/// Writes the casted values and an Arrow-compatible validity bitmap (bit `i % 8` of byte `i / 8` is set if element
+/// `i` is valid). Null elements are written as zero. Nothing is thrown, so one bad row does not abort the batch.
+///
+/// Elements are null exactly when narrow_cast_checked would throw for them, so a floating point NaN is valid and
+/// written as NaN.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param validity Pointer to storage for validity_bitmap_size(@p count) bytes.
+/// @return The number of null elements.
+template<typename To, typename From>
+auto narrow_cast_batch_nullable(const From* input, std::size_t count, To* output, std::uint8_t* validity) noexcept
+    -> std::size_t
+{
+    static_assert(is_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::nullable::cast_to_bitmap(input, count, output, validity, detail::math::float_op_truncate{},
+        [](From val, To& result) { return detail::nullable::narrow(val, result); });
+}
+
+/// @brief Casts an array of floating point values to integers, marking the values that cannot be cast as null.
+///
+/// Writes the casted values and an Arrow-compatible validity bitmap (bit `i % 8` of byte `i / 8` is set if element
+/// `i` is valid). NaN, Infinity and values whose rounded value exceeds the range of @p To are null and written as
+/// zero. Nothing is thrown, so one bad row does not abort the batch.
+///
+/// @tparam To The (integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param validity Pointer to storage for validity_bitmap_size(@p count) bytes.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The number of null elements.
+template<typename To, typename From, typename Op = detail::math::float_op_default>
+auto float_cast_batch_nullable(
+    const From* input, std::size_t count, To* output, std::uint8_t* validity, Op float_op = Op{}) noexcept
+    -> std::size_t
+{
+    static_assert(is_float_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::nullable::cast_to_bitmap(input, count, output, validity, float_op,
+        [float_op](From val, To& result) { return detail::nullable::round(val, float_op, result); });
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_NULLABLE_CAST_HPP
@@ -0,0 +1,687 @@
+///@file parallel_cast.hpp
+///@author Jackson Harmer
+///@brief Parallel overloads of the batch casts, splitting the input into chunks processed by a work-stealing pool.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_PARALLEL_CAST_HPP
+#define BETTER_CASTS_PARALLEL_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "chrono_cast.hpp"
+#include "fixed_cast.hpp"
+#include "half_cast.hpp"
+#include "nullable_cast.hpp"
+#include "quantize_cast.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace casts
+{
+/// @brief Executor running the workers of a parallel batch cast on threads started for the call.
+///
+/// Any type with the same two members can be passed instead (ex. to run the workers on an existing thread pool):
+/// `concurrency()` returns the number of workers to use, and `operator()(workers, task)` calls `task(worker)` for
+/// each worker in `[0, workers)`, concurrently, returning once every call has returned. The tasks do not throw.
+/// Workers that never run are harmless (their chunks are stolen by the others), so an executor may run fewer.
+class thread_executor
+{
+public:
+    /// @brief Uses one worker per hardware thread.
+    thread_executor() noexcept : m_threads(std::thread::hardware_concurrency()) {}
+
+    /// @brief Uses @p threads workers (including the calling thread).
+    explicit thread_executor(unsigned threads) noexcept : m_threads(threads) {}
+
+    NODISCARD auto concurrency() const noexcept -> unsigned { return m_threads == 0 ? 1U : m_threads; }
+
+    void operator()(unsigned workers, const std::function<void(unsigned)>& task) const
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(workers);
+
+        for (unsigned worker = 1; worker < workers; ++worker)
+        {
+#ifdef HAS_EXCEPTIONS
+            try
+            {
+                threads.emplace_back(std::cref(task), worker);
+            }
+            catch (const std::system_error&)
+            {
+                // Out of threads: the workers that did start steal the chunks of the others
+                break;
+            }
+#else
+            threads.emplace_back(std::cref(task), worker);
+#endif
+        }
+
+        task(0);
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+private:
+    unsigned m_threads;
+};
+
+namespace detail
+{
+    namespace parallel
+    {
+        /// Input bytes per chunk: small enough for a chunk to stay in L2 from its conversion to its checks, large
+        /// enough to amortize claiming it.
+        constexpr std::size_t chunk_bytes = std::size_t{ 1 } << 18U;
+
+        /// Elements per chunk, a multiple of 64 so chunks hold whole validity bytes and whole vector blocks.
+        template<typename From>
+        constexpr auto chunk_size() noexcept -> std::size_t
+        {
+            return chunk_bytes / sizeof(From) < 64 ? 64 : chunk_bytes / sizeof(From) / 64 * 64;
+        }
+
+        template<typename E, typename = void>
+        struct is_executor : std::false_type
+        {
+        };
+
+        template<typename E>
+        struct is_executor<E, down::void_t<decltype(std::declval<const E&>().concurrency())>> : std::true_type
+        {
+        };
+
+        /// Chunks owned by one worker, claimed from the front by the owner and by thieves alike.
+        struct chunk_range
+        {
+            std::atomic<std::size_t> next{ 0 };
+            std::size_t end = 0;
+            // Keeps the counters of different workers on different cache lines
+            char padding[64 - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)] = {};
+        };
+
+        inline void lower_to(std::atomic<std::size_t>& value, std::size_t candidate) noexcept
+        {
+            std::size_t current = value.load(std::memory_order_relaxed);
+
+            while (candidate < current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /// Calls @p process(first, size) for every chunk of `[0, count)` on the workers of @p executor, and returns the
+        /// first index of the lowest chunk for which it returned false (or @p count if there is none).
+        ///
+        /// Each worker owns a contiguous range of chunks and steals from the other ranges once its own is exhausted.
+        /// Every claim takes the lowest unclaimed chunk of a range, so once a chunk fails, the chunks above it are
+        /// skipped while the chunks below it are still processed: the reported chunk does not depend on scheduling.
+        template<typename Executor, typename Process>
+        auto for_each_chunk(const Executor& executor, std::size_t count, std::size_t chunk, Process process)
+            -> std::size_t
+        {
+            const std::size_t chunks = (count + chunk - 1) / chunk;
+            const std::size_t workers = (std::min)(static_cast<std::size_t>(executor.concurrency()), chunks);
+            std::atomic<std::size_t> failed{ chunks };
+
+            const auto run = [&](std::size_t idx)
+            {
+                const std::size_t first = idx * chunk;
+
+                if (!process(first, (std::min)(chunk, count - first)))
+                {
+                    lower_to(failed, idx);
+                }
+            };
+
+            if (workers <= 1)
+            {
+                for (std::size_t idx = 0; idx < chunks && idx < failed.load(std::memory_order_relaxed); ++idx)
+                {
+                    run(idx);
+                }
+            }
+            else
+            {
+                std::unique_ptr<chunk_range[]> ranges(new chunk_range[workers]);
+
+                for (std::size_t worker = 0; worker < workers; ++worker)
+                {
+                    ranges[worker].next.store(chunks * worker / workers, std::memory_order_relaxed);
+                    ranges[worker].end = chunks * (worker + 1) / workers;
+                }
+
+                executor(static_cast<unsigned>(workers),
+                    [&](unsigned self)
+                    {
+                        for (std::size_t step = 0; step < workers; ++step)
+                        {
+                            chunk_range& range = ranges[(self + step) % workers];
+
+                            for (;;)
+                            {
+                                const std::size_t idx = range.next.fetch_add(1, std::memory_order_relaxed);
+
+                                if (idx >= range.end || idx > failed.load(std::memory_order_relaxed))
+                                {
+                                    break;
+                                }
+
+                                run(idx);
+                            }
+                        }
+                    });
+            }
+
+            const std::size_t lowest = failed.load(std::memory_order_relaxed);
+            return lowest == chunks ? count : lowest * chunk;
+        }
+
+        template<typename Executor>
+        INLINE_CONSTEXPR bool is_executor_v = is_executor<Executor>::value;
+    } //namespace parallel
+} // namespace detail
+
+/// @brief Casts an array of floating point values to a fixed-point format on the workers of @p executor without
+/// performing runtime checks.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+template<typename Q, typename Executor, typename From, typename Op = detail::math::float_op_default>
+auto fixed_cast_batch_unchecked(const Executor& executor, const From* input, std::size_t count,
+    typename Q::rep* output, Op float_op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(is_fixed_castable_v<Q, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::parallel::for_each_chunk(executor, count, detail::parallel::chunk_size<From>(),
+        [&](std::size_t first, std::size_t size)
+        {
+            fixed_cast_batch_unchecked<Q>(input + first, size, output + first, float_op);
+            return true;
+        });
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format on the workers of @p executor with runtime
+/// checks.
+///
+/// Workers stop early once a chunk fails, and the reported index is always that of the first offending element (as
+/// with fixed_cast_batch_checked). The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or its scaled value exceeds the range of the
+/// format's representation.
+template<typename Q, typename Executor, typename From, typename Op = detail::math::float_op_default>
+auto fixed_cast_batch_checked(const Executor& executor, const From* input, std::size_t count,
+    typename Q::rep* output, Op float_op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(is_fixed_castable_v<Q, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    const From scale = Q::template scale<From>();
+    const std::size_t chunk = detail::parallel::chunk_size<From>();
+    const std::size_t failed = detail::parallel::for_each_chunk(executor, count, chunk,
+        [&](std::size_t first, std::size_t size)
+        { return detail::fixed::to_fixed_checked(input + first, size, output + first, scale, float_op); });
+
+    if (UNLIKELY(failed != count))
+    {
+        detail::fixed::throw_batch_error<typename Q::rep>(
+            input + failed, (std::min)(chunk, count - failed), scale, float_op, failed);
+    }
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format on the workers of @p executor. Based on
+/// configuration this will call fixed_cast_batch_checked.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or its scaled value exceeds the range of the
+/// format's representation.
+template<typename Q, typename Executor, typename From, typename Op = detail::math::float_op_default>
+auto fixed_cast_batch(const Executor& executor, const From* input, std::size_t count, typename Q::rep* output,
+    Op float_op = Op{}) -> std::enable_if_t<CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    fixed_cast_batch_checked<Q>(executor, input, count, output, float_op);
+}
+
+/// @brief Casts an array of floating point values to a fixed-point format on the workers of @p executor. Based on
+/// configuration this will call fixed_cast_batch_unchecked.
+///
+/// @tparam Q The fixed-point format to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used to round the scaled values.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count raw fixed-point values.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+template<typename Q, typename Executor, typename From, typename Op = detail::math::float_op_default>
+auto fixed_cast_batch(const Executor& executor, const From* input, std::size_t count, typename Q::rep* output,
+    Op float_op = Op{}) -> std::enable_if_t<!CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    fixed_cast_batch_unchecked<Q>(executor, input, count, output, float_op);
+}
+
+/// @brief Casts an array of values to or from a half type on the workers of @p executor without performing runtime
+/// checks.
+///
+/// @tparam To The type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+template<typename To, typename Executor, typename From, typename Op = detail::half::default_op<To>>
+auto half_cast_batch_unchecked(const Executor& executor, const From* input, std::size_t count, To* output,
+    Op op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(is_half_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::parallel::for_each_chunk(executor, count, detail::parallel::chunk_size<From>(),
+        [&](std::size_t first, std::size_t size)
+        {
+            detail::half::batch<false>(input + first, size, output + first, op);
+            return true;
+        });
+}
+
+/// @brief Casts an array of values to or from a half type on the workers of @p executor with runtime checks.
+///
+/// Workers stop early once a chunk fails, and the error thrown is always that of the first offending element (as
+/// with half_cast_batch_checked). The contents of @p output are unspecified if an error is thrown. Without exceptions,
+/// the cast failure handler is called by the worker that finds an offending element, which may not be the first.
+///
+/// @tparam To The type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename Executor, typename From, typename Op = detail::half::default_op<To>>
+auto half_cast_batch_checked(const Executor& executor, const From* input, std::size_t count, To* output,
+    Op op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(is_half_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    const std::size_t chunk = detail::parallel::chunk_size<From>();
+    const std::size_t failed = detail::parallel::for_each_chunk(executor, count, chunk,
+        [&](std::size_t first, std::size_t size)
+        {
+#ifdef HAS_EXCEPTIONS
+            try
+            {
+                detail::half::batch<true>(input + first, size, output + first, op);
+                return true;
+            }
+            catch (const cast_error&)
+            {
+                return false;
+            }
+#else
+            detail::half::batch<true>(input + first, size, output + first, op);
+            return true;
+#endif
+        });
+
+    if (UNLIKELY(failed != count))
+    {
+        // Rerun the lowest failing chunk on this thread to throw its error
+        detail::half::batch<true>(input + failed, (std::min)(chunk, count - failed), output + failed, op);
+    }
+}
+
+/// @brief Casts an array of values to or from a half type on the workers of @p executor. Based on configuration this
+/// will call half_cast_batch_checked.
+///
+/// @tparam To The type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+/// @exception float_cast_error Thrown if any value is NaN, Infinity or exceeds the range of the target type.
+template<typename To, typename Executor, typename From, typename Op = detail::half::default_op<To>>
+auto half_cast_batch(const Executor& executor, const From* input, std::size_t count, To* output, Op op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    half_cast_batch_checked(executor, input, count, output, op);
+}
+
+/// @brief Casts an array of values to or from a half type on the workers of @p executor. Based on configuration this
+/// will call half_cast_batch_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The type to cast from.
+/// @tparam Op The rounding operation.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param op The operation to perform.
+template<typename To, typename Executor, typename From, typename Op = detail::half::default_op<To>>
+auto half_cast_batch(const Executor& executor, const From* input, std::size_t count, To* output, Op op = Op{})
+    -> std::enable_if_t<!CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    half_cast_batch_unchecked(executor, input, count, output, op);
+}
+
+/// @brief Quantizes an array of floating point values on the workers of @p executor without performing runtime
+/// checks.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch_unchecked(const Executor& executor, const From* input, std::size_t count, To* output,
+    const quant_params& params, Op float_op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::parallel::for_each_chunk(executor, count, detail::parallel::chunk_size<From>(),
+        [&](std::size_t first, std::size_t size)
+        {
+            quantize_cast_batch_unchecked(input + first, size, output + first, params, float_op);
+            return true;
+        });
+}
+
+/// @brief Quantizes an array of floating point values on the workers of @p executor with runtime checks.
+///
+/// Workers stop early once a chunk fails, and the reported index is always that of the first NaN (as with
+/// quantize_cast_batch_checked). The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @exception float_cast_error Thrown if any value is NaN or the parameters are invalid.
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch_checked(const Executor& executor, const From* input, std::size_t count, To* output,
+    const quant_params& params, Op float_op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::quant::check_params<To>(params);
+
+    const std::size_t chunk = detail::parallel::chunk_size<From>();
+    const std::size_t failed = detail::parallel::for_each_chunk(executor, count, chunk,
+        [&](std::size_t first, std::size_t size)
+        { return detail::quant::quantize_batch<true>(input + first, size, output + first, params, float_op); });
+
+    if (UNLIKELY(failed != count))
+    {
+        detail::quant::throw_batch_error(input + failed, (std::min)(chunk, count - failed), failed);
+    }
+}
+
+/// @brief Quantizes an array of floating point values on the workers of @p executor. Based on configuration this
+/// will call quantize_cast_batch_checked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @exception float_cast_error Thrown if any value is NaN or the parameters are invalid.
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch(const Executor& executor, const From* input, std::size_t count, To* output,
+    const quant_params& params, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    quantize_cast_batch_checked(executor, input, count, output, params, float_op);
+}
+
+/// @brief Quantizes an array of floating point values on the workers of @p executor. Based on configuration this
+/// will call quantize_cast_batch_unchecked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch(const Executor& executor, const From* input, std::size_t count, To* output,
+    const quant_params& params, Op float_op = Op{})
+    -> std::enable_if_t<!CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    quantize_cast_batch_unchecked(executor, input, count, output, params, float_op);
+}
+
+/// @brief Casts an array of durations or time points on the workers of @p executor without performing runtime
+/// checks.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_truncate>
+auto duration_narrow_cast_batch_unchecked(const Executor& executor, const From* input, std::size_t count,
+    To* output, Op float_op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(
+        is_duration_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::parallel::for_each_chunk(executor, count, detail::parallel::chunk_size<From>(),
+        [&](std::size_t first, std::size_t size)
+        {
+            duration_narrow_cast_batch_unchecked(input + first, size, output + first, float_op);
+            return true;
+        });
+}
+
+/// @brief Casts an array of durations or time points on the workers of @p executor with runtime checks.
+///
+/// Workers stop early once a chunk fails, and the reported index is always that of the first offending element (as
+/// with duration_narrow_cast_batch_checked). The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @exception narrow_cast_error Thrown if any rounded value exceeds the range of the target representation.
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_truncate>
+auto duration_narrow_cast_batch_checked(const Executor& executor, const From* input, std::size_t count,
+    To* output, Op float_op = Op{}) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>>
+{
+    static_assert(
+        is_duration_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    const std::size_t chunk = detail::parallel::chunk_size<From>();
+    const std::size_t failed = detail::parallel::for_each_chunk(executor, count, chunk,
+        [&](std::size_t first, std::size_t size)
+        { return detail::chrono::batch_checked(input + first, size, output + first, float_op); });
+
+    if (UNLIKELY(failed != count))
+    {
+        detail::chrono::throw_batch_error<To, Op>(input + failed, (std::min)(chunk, count - failed), failed);
+    }
+}
+
+/// @brief Casts an array of durations or time points on the workers of @p executor. Based on configuration this will
+/// call duration_narrow_cast_batch_checked.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+/// @exception narrow_cast_error Thrown if any rounded value exceeds the range of the target representation.
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_truncate>
+auto duration_narrow_cast_batch(const Executor& executor, const From* input, std::size_t count, To* output,
+    Op float_op = Op{}) -> std::enable_if_t<CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    duration_narrow_cast_batch_checked(executor, input, count, output, float_op);
+}
+
+/// @brief Casts an array of durations or time points on the workers of @p executor. Based on configuration this will
+/// call duration_narrow_cast_batch_unchecked.
+///
+/// @tparam To The duration or time point type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The duration or time point type to cast from.
+/// @tparam Op The float_cast operation used to round partial ticks.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param float_op The operation to perform (truncates by default, like `std::chrono::duration_cast`).
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_truncate>
+auto duration_narrow_cast_batch(const Executor& executor, const From* input, std::size_t count, To* output,
+    Op float_op = Op{}) -> std::enable_if_t<!CHECK_CASTS && detail::parallel::is_executor_v<Executor>>
+{
+    duration_narrow_cast_batch_unchecked(executor, input, count, output, float_op);
+}
+
+/// @brief Casts an array of values to a smaller type on the workers of @p executor, marking the values that do not
+/// fit as null.
+///
+/// Chunks hold whole validity bytes, so the workers never write to the same byte of @p validity.
+///
+/// @tparam To The type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The type to cast from.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param validity Pointer to storage for validity_bitmap_size(@p count) bytes.
+/// @return The number of null elements.
+template<typename To, typename Executor, typename From>
+auto narrow_cast_batch_nullable(const Executor& executor, const From* input, std::size_t count, To* output,
+    std::uint8_t* validity) -> std::enable_if_t<detail::parallel::is_executor_v<Executor>, std::size_t>
+{
+    static_assert(is_narrow_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    std::atomic<std::size_t> nulls{ 0 };
+
+    detail::parallel::for_each_chunk(executor, count, detail::parallel::chunk_size<From>(),
+        [&](std::size_t first, std::size_t size)
+        {
+            nulls.fetch_add(narrow_cast_batch_nullable(input + first, size, output + first, validity + first / 8),
+                std::memory_order_relaxed);
+            return true;
+        });
+
+    return nulls.load(std::memory_order_relaxed);
+}
+
+/// @brief Casts an array of floating point values to integers on the workers of @p executor, marking the values that
+/// cannot be cast as null.
+///
+/// Chunks hold whole validity bytes, so the workers never write to the same byte of @p validity.
+///
+/// @tparam To The (integral) type to cast to.
+/// @tparam Executor The executor type (thread_executor or a type with the same members).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param executor Runs the workers.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count casted values.
+/// @param validity Pointer to storage for validity_bitmap_size(@p count) bytes.
+/// @param float_op The operation to perform (uses the default operation if not specified).
+/// @return The number of null elements.
+template<typename To, typename Executor, typename From, typename Op = detail::math::float_op_default>
+auto float_cast_batch_nullable(const Executor& executor, const From* input, std::size_t count, To* output,
+    std::uint8_t* validity, Op float_op = Op{})
+    -> std::enable_if_t<detail::parallel::is_executor_v<Executor>, std::size_t>
+{
+    static_assert(is_float_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    std::atomic<std::size_t> nulls{ 0 };
+
+    detail::parallel::for_each_chunk(executor, count, detail::parallel::chunk_size<From>(),
+        [&](std::size_t first, std::size_t size)
+        {
+            nulls.fetch_add(
+                float_cast_batch_nullable(input + first, size, output + first, validity + first / 8, float_op),
+                std::memory_order_relaxed);
+            return true;
+        });
+
+    return nulls.load(std::memory_order_relaxed);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_PARALLEL_CAST_HPP
@@ -0,0 +1,701 @@
+///@file parse_cast.hpp
+///@author Jackson Harmer
+///@brief Casts from decimal text to integers that parse and range-check in a single pass.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_PARSE_CAST_HPP
+#define BETTER_CASTS_PARSE_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "byte_cast.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#ifdef __SSE4_1__
+#  include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+namespace casts
+{
+/// @brief Error thrown when a parse_cast fails.
+class parse_cast_error final : public cast_error
+{
+public:
+    using cast_error::cast_error;
+};
+
+/// @brief Reason a try_parse_cast failed (mirrors the relevant `std::errc` values of `std::from_chars`).
+enum class parse_errc
+{
+    ok,
+    invalid_argument,
+    result_out_of_range,
+};
+
+/// @brief Result of a non-throwing try_parse_cast.
+///
+/// @tparam T The parsed type.
+template<typename T>
+struct parse_result
+{
+    /// The parsed value (zero unless @ref ec is parse_errc::ok).
+    T value;
+    /// parse_errc::ok on success, otherwise the reason the text could not be cast.
+    parse_errc ec;
+
+    NODISCARD constexpr explicit operator bool() const noexcept { return ec == parse_errc::ok; }
+};
+
+namespace detail
+{
+    namespace parse
+    {
+        /// Index of the lowest bit set in @p bits, which must not be zero.
+        NODISCARD FORCE_INLINE auto lowest_set_bit(unsigned bits) noexcept -> std::size_t
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctz(bits));
+#elif defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanForward(&index, bits);
+            return static_cast<std::size_t>(index);
+#else
+            std::size_t index = 0;
+
+            while ((bits & 1U) == 0U)
+            {
+                bits >>= 1U;
+                ++index;
+            }
+
+            return index;
+#endif
+        }
+
+        /// Accumulator wide enough for every digit that can still produce a representable @p To.
+        template<typename To>
+        using acc_t =
+            std::conditional_t<(sizeof(To) > sizeof(std::uint64_t)), make_unsigned_t<To>, std::uint64_t>;
+
+        /// Significant digits that always fit in the accumulator (10^19 < 2^64, 10^38 < 2^128).
+        template<typename To>
+        INLINE_CONSTEXPR std::size_t max_digits = sizeof(acc_t<To>) > sizeof(std::uint64_t) ? 38 : 19;
+
+        /// Largest magnitude a @p To can hold for the given sign.
+        template<typename To>
+        NODISCARD constexpr auto limit(bool negative) noexcept -> acc_t<To>
+        {
+            using unsigned_t = make_unsigned_t<To>;
+
+            return static_cast<acc_t<To>>(
+                       is_signed<To>::value ? static_cast<unsigned_t>(static_cast<unsigned_t>(~unsigned_t{ 0 }) >> 1U)
+                                            : static_cast<unsigned_t>(~unsigned_t{ 0 }))
+                + (negative ? 1U : 0U);
+        }
+
+        NODISCARD constexpr auto digit_of(char chr) noexcept -> unsigned
+        {
+            return static_cast<unsigned>(static_cast<unsigned char>(chr)) - unsigned{ '0' };
+        }
+
+        /// True if all eight bytes of @p chunk (loaded little endian) are ASCII digits.
+        NODISCARD constexpr auto is_eight_digits(std::uint64_t chunk) noexcept -> bool
+        {
+            // Digits have a high nibble of 3, and adding 6 must not carry out of the low nibble
+            return ((chunk & 0xF0F0'F0F0'F0F0'F0F0U)
+                       | (((chunk + 0x0606'0606'0606'0606U) & 0xF0F0'F0F0'F0F0'F0F0U) >> 4U))
+                == 0x3333'3333'3333'3333U;
+        }
+
+        /// Converts eight ASCII digits (loaded little endian, first digit most significant) with three multiplies.
+        NODISCARD constexpr auto eight_digits(std::uint64_t chunk) noexcept -> std::uint64_t
+        {
+            chunk -= 0x3030'3030'3030'3030U;
+            chunk = (chunk * 10U) + (chunk >> 8U);
+            return (((chunk & 0x0000'00FF'0000'00FFU) * 0x000F'4240'0000'0064U)
+                       + (((chunk >> 16U) & 0x0000'00FF'0000'00FFU) * 0x0000'2710'0000'0001U))
+                >> 32U;
+        }
+
+        template<typename To>
+        NODISCARD constexpr auto apply_sign(acc_t<To> magnitude, bool negative) noexcept -> To
+        {
+            return static_cast<To>(negative ? static_cast<acc_t<To>>(acc_t<To>{ 0 } - magnitude) : magnitude);
+        }
+
+        /// Parses `[first, last)` as an optionally negative decimal integer, validating every character and the range.
+        template<typename To>
+        NODISCARD inline auto parse(const char* first, const char* last, To& value) noexcept -> parse_errc
+        {
+            const bool negative = is_signed<To>::value && first != last && *first == '-';
+            first += negative ? 1 : 0;
+
+            if (first == last)
+            {
+                return parse_errc::invalid_argument;
+            }
+
+            // Leading zeros do not count towards the digits the accumulator can hold
+            while (first != last && *first == '0')
+            {
+                ++first;
+            }
+
+            // The first max_digits digits cannot wrap the accumulator, the rest are multiplied in with overflow checks
+            const auto digits = static_cast<std::size_t>(last - first);
+            const char* const split = digits > max_digits<To> ? first + max_digits<To> : last;
+            acc_t<To> acc = 0;
+
+            for (; split - first >= 8; first += 8)
+            {
+                const auto chunk = bytes::load<std::uint64_t, endian::little>(first);
+                if (!is_eight_digits(chunk))
+                {
+                    return parse_errc::invalid_argument;
+                }
+
+                acc = static_cast<acc_t<To>>(acc * 100'000'000U + eight_digits(chunk));
+            }
+
+            bool overflow = false;
+            for (; first != last; ++first)
+            {
+                const unsigned digit = digit_of(*first);
+                if (digit > 9U)
+                {
+                    return parse_errc::invalid_argument;
+                }
+
+                overflow = overflow || (first >= split && acc > (limit<To>(negative) - digit) / 10U);
+                acc = static_cast<acc_t<To>>(acc * 10U + digit);
+            }
+
+            if (overflow || acc > limit<To>(negative))
+            {
+                return parse_errc::result_out_of_range;
+            }
+
+            value = apply_sign<To>(acc, negative);
+            return parse_errc::ok;
+        }
+
+        /// Parses `[first, last)` assuming it is a valid, in-range decimal integer.
+        template<typename To>
+        NODISCARD inline auto parse_unchecked(const char* first, const char* last) noexcept -> To
+        {
+            const bool negative = is_signed<To>::value && first != last && *first == '-';
+            first += negative ? 1 : 0;
+
+            acc_t<To> acc = 0;
+
+            for (; last - first >= 8; first += 8)
+            {
+                acc = static_cast<acc_t<To>>(
+                    acc * 100'000'000U + eight_digits(bytes::load<std::uint64_t, endian::little>(first)));
+            }
+
+            for (; first != last; ++first)
+            {
+                acc = static_cast<acc_t<To>>(acc * 10U + digit_of(*first));
+            }
+
+            return apply_sign<To>(acc, negative);
+        }
+
+        /// Parses a fixed-width field, which may be left-padded with spaces.
+        template<typename To>
+        NODISCARD inline auto parse_padded(const char* first, const char* last, To& value) noexcept -> parse_errc
+        {
+            while (first != last && *first == ' ')
+            {
+                ++first;
+            }
+
+            return parse(first, last, value);
+        }
+
+        template<typename To>
+        NODISCARD inline auto parse_padded_unchecked(const char* first, const char* last) noexcept -> To
+        {
+            while (first != last && *first == ' ')
+            {
+                ++first;
+            }
+
+            return parse_unchecked<To>(first, last);
+        }
+
+        NORETURN COLD inline void throw_error(parse_errc errc)
+        {
+            if (errc == parse_errc::invalid_argument)
+            {
+                throw_cast_error<parse_cast_error>("parse_cast failed: input is not a decimal integer");
+            }
+
+            throw_cast_error<parse_cast_error>("parse_cast failed: input exceeded the range of the output type");
+        }
+
+        NORETURN COLD inline void throw_batch_error(parse_errc errc, std::size_t idx)
+        {
+            if (errc == parse_errc::invalid_argument)
+            {
+                throw_cast_error<parse_cast_error>(
+                    ("parse_cast failed: field at index " + std::to_string(idx) + " is not a decimal integer").c_str());
+            }
+
+            throw_cast_error<parse_cast_error>(("parse_cast failed: field at index " + std::to_string(idx)
+                + " exceeded the range of the output type")
+                    .c_str());
+        }
+
+        /// Parses one field of a batch with the scalar parser.
+        template<bool Checked, bool Padded, typename To>
+        inline void parse_field(const char* first, const char* last, std::size_t idx, To& value)
+        {
+            if (Checked)
+            {
+                const parse_errc errc = Padded ? parse_padded(first, last, value) : parse(first, last, value);
+                if (UNLIKELY(errc != parse_errc::ok))
+                {
+                    throw_batch_error(errc, idx);
+                }
+            }
+            else
+            {
+                value = Padded ? parse_padded_unchecked<To>(first, last) : parse_unchecked<To>(first, last);
+            }
+        }
+
+#ifdef __SSE4_1__
+        /// Converts the (up to 16) digit values in @p digits, most significant first, padded with leading zeros.
+        NODISCARD inline auto sixteen_digits(__m128i digits) noexcept -> std::uint64_t
+        {
+            const __m128i pairs = _mm_maddubs_epi16(digits, _mm_set1_epi16(0x010A)); // d0 * 10 + d1
+            const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x0001'0064)); // p0 * 100 + p1
+            const __m128i packed = _mm_packus_epi32(quads, quads);
+            const __m128i octs = _mm_madd_epi16(packed, _mm_set1_epi32(0x0001'2710)); // q0 * 10000 + q1
+
+            const auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(octs));
+            const auto low = static_cast<std::uint32_t>(_mm_extract_epi32(octs, 1));
+            return std::uint64_t{ high } * 100'000'000U + low;
+        }
+
+        /// Shuffle that moves the first @p width bytes to the end of the register and zeroes the rest.
+        NODISCARD inline auto right_align(std::size_t width) noexcept -> __m128i
+        {
+            const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+            // Indices that become negative select zero in pshufb
+            return _mm_add_epi8(iota, _mm_set1_epi8(static_cast<char>(static_cast<int>(width) - 16)));
+        }
+
+        /// Parses the @p width (at most 16) byte field at @p src, which may be followed by any 16 - @p width readable
+        /// bytes. Digits may be preceded by spaces if @p Padded. Returns false if the field needs the scalar parser.
+        template<bool Checked, bool Padded, typename To>
+        NODISCARD inline auto parse_simd(const char* src, std::size_t width, bool negative, To& value) noexcept -> bool
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i spaces = Padded ? _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')) : _mm_setzero_si128();
+            const __m128i digits = _mm_andnot_si128(spaces, _mm_sub_epi8(chunk, _mm_set1_epi8('0')));
+
+            const unsigned field = (1U << width) - 1U;
+
+            // A sign inside a padded field is left to the scalar parser, even unchecked
+            if (Padded && is_signed<To>::value
+                && (static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('-')))) & field) != 0U)
+            {
+                return false;
+            }
+
+            if (Checked)
+            {
+                const auto space_mask = static_cast<unsigned>(_mm_movemask_epi8(spaces)) & field;
+                const auto digit_mask = static_cast<unsigned>(_mm_movemask_epi8(
+                                            _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits)))
+                    & field & ~space_mask;
+
+                // Every byte must be a digit or a leading space, with at least one digit
+                if ((digit_mask | space_mask) != field || (space_mask & (space_mask + 1U)) != 0U || digit_mask == 0U)
+                {
+                    return false;
+                }
+            }
+
+            const std::uint64_t magnitude = sixteen_digits(_mm_shuffle_epi8(digits, right_align(width)));
+
+            if (Checked && magnitude > limit<To>(negative))
+            {
+                return false;
+            }
+
+            value = apply_sign<To>(static_cast<acc_t<To>>(magnitude), negative);
+            return true;
+        }
+#endif
+
+        template<bool Checked, typename To>
+        inline void parse_fixed(const char* data, std::size_t width, std::size_t count, To* output)
+        {
+            std::size_t idx = 0;
+
+#ifdef __SSE4_1__
+            if (width > 0 && width <= 16)
+            {
+                // Each 16-byte load must stay within the buffer
+                const std::size_t simd_count = count * width >= 16 ? (count * width - 16) / width + 1 : 0;
+
+                for (; idx < simd_count; ++idx)
+                {
+                    const char* const field = data + idx * width;
+
+                    if (!parse_simd<Checked, true>(field, width, false, output[idx]))
+                    {
+                        // Signs, invalid characters and out-of-range values are sorted out by the scalar parser
+                        parse_field<Checked, true>(field, field + width, idx, output[idx]);
+                    }
+                }
+            }
+#endif
+
+            for (; idx < count; ++idx)
+            {
+                const char* const field = data + idx * width;
+
+                parse_field<Checked, true>(field, field + width, idx, output[idx]);
+            }
+        }
+
+        /// Finds the end of the field starting at @p first.
+        NODISCARD inline auto field_end(const char* first, const char* last, char delimiter) noexcept -> const char*
+        {
+            while (first != last && *first != delimiter)
+            {
+                ++first;
+            }
+
+            return first;
+        }
+
+        template<bool Checked, typename To>
+        inline auto parse_delimited(const char* first, const char* last, char delimiter, To* output,
+            std::size_t capacity) -> std::size_t
+        {
+            std::size_t idx = 0;
+
+            while (first != last)
+            {
+                if (idx == capacity)
+                {
+                    if (Checked)
+                    {
+                        detail::throw_cast_error<parse_cast_error>(
+                            "parse_cast failed: input has more fields than the output can hold");
+                    }
+
+                    break;
+                }
+
+                const bool negative = is_signed<To>::value && *first == '-';
+                const char* const digits = first + (negative ? 1 : 0);
+                const char* end = nullptr;
+
+#ifdef __SSE4_1__
+                if (last - digits >= 16)
+                {
+                    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+                    const auto delimiters =
+                        static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(delimiter))));
+
+                    if (delimiters != 0U)
+                    {
+                        const std::size_t width = lowest_set_bit(delimiters);
+                        end = digits + width;
+
+                        if (width == 0 || !parse_simd<Checked, false>(digits, width, negative, output[idx]))
+                        {
+                            parse_field<Checked, false>(first, end, idx, output[idx]);
+                        }
+                    }
+                }
+#endif
+
+                if (end == nullptr)
+                {
+                    end = field_end(digits, last, delimiter);
+                    parse_field<Checked, false>(first, end, idx, output[idx]);
+                }
+
+                ++idx;
+
+                // Skip the delimiter; a trailing one starts an (invalid) empty field
+                if (end == last)
+                {
+                    break;
+                }
+
+                first = end + 1;
+                if (first == last)
+                {
+                    if (Checked)
+                    {
+                        throw_batch_error(parse_errc::invalid_argument, idx);
+                    }
+
+                    break;
+                }
+            }
+
+            return idx;
+        }
+    } //namespace parse
+} // namespace detail
+
+/// @brief Type trait to determine if text can be cast to a @p To via parse_cast.
+///
+/// In order to be castable, @p To must be an integer type other than bool (128-bit integers included).
+///
+/// @tparam To The type to cast to.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To>
+struct is_parse_castable :
+    std::integral_constant<bool, (detail::is_integer<To>::value && !std::is_same<To, bool>::value)>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_parse_castable.
+template<typename To>
+INLINE_CONSTEXPR bool is_parse_castable_v = is_parse_castable<To>::value;
+
+/// @brief Parses decimal text into a @p To without throwing.
+///
+/// The whole range must be an optional `-` (signed types only) followed by at least one digit; there is no
+/// whitespace skipping, `+` or locale handling. Range checking happens in the same pass, directly for @p To.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @return The parsed value, or the reason the text could not be cast.
+template<typename To>
+NODISCARD inline auto try_parse_cast(const char* first, const char* last) noexcept -> parse_result<To>
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    parse_result<To> result{ To{ 0 }, parse_errc::ok };
+    result.ec = detail::parse::parse(first, last, result.value);
+    return result;
+}
+
+/// @brief Parses decimal text into a @p To without performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @return The parsed value (unspecified if the text is not a valid, in-range decimal integer).
+template<typename To>
+NODISCARD inline auto parse_cast_unchecked(const char* first, const char* last) noexcept -> To
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    return detail::parse::parse_unchecked<To>(first, last);
+}
+
+/// @brief Parses decimal text into a @p To with runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @return The parsed value.
+/// @exception parse_cast_error Thrown if the text is not a decimal integer or exceeds the range of the target type.
+template<typename To>
+NODISCARD inline auto parse_cast_checked(const char* first, const char* last) -> To
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    To value{ 0 };
+    const parse_errc errc = detail::parse::parse(first, last, value);
+    if (UNLIKELY(errc != parse_errc::ok))
+    {
+        detail::parse::throw_error(errc);
+    }
+
+    return value;
+}
+
+/// @brief Parses decimal text into a @p To. Based on configuration this will call parse_cast_checked.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @return The parsed value.
+/// @exception parse_cast_error Thrown if the text is not a decimal integer or exceeds the range of the target type.
+template<typename To>
+NODISCARD inline auto parse_cast(const char* first, const char* last)
+    -> std::enable_if_t<CHECK_CASTS && is_parse_castable_v<To>, To>
+{
+    return parse_cast_checked<To>(first, last);
+}
+
+/// @brief Parses decimal text into a @p To. Based on configuration this will call parse_cast_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @return The parsed value.
+template<typename To>
+NODISCARD inline auto parse_cast(const char* first, const char* last) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_parse_castable_v<To>, To>
+{
+    return parse_cast_unchecked<To>(first, last);
+}
+
+/// @brief Parses @p count fixed-width fields without performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @param data Pointer to the first field; fields are stored back to back, each @p width characters long.
+/// @param width The width of each field. Digits may be left-padded with spaces.
+/// @param count The number of fields to parse.
+/// @param output Pointer to storage for @p count values.
+template<typename To>
+void parse_cast_batch_unchecked(const char* data, std::size_t width, std::size_t count, To* output) noexcept
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    detail::parse::parse_fixed<false>(data, width, count, output);
+}
+
+/// @brief Parses @p count fixed-width fields with runtime checks.
+///
+/// Fields of up to 16 characters are validated and converted 16 bytes at a time with SSE4.1 where available. The
+/// contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The type to cast to.
+/// @param data Pointer to the first field; fields are stored back to back, each @p width characters long.
+/// @param width The width of each field. Digits may be left-padded with spaces.
+/// @param count The number of fields to parse.
+/// @param output Pointer to storage for @p count values.
+/// @exception parse_cast_error Thrown (with the index of the first bad field) if a field is not a decimal integer or
+/// exceeds the range of the target type.
+template<typename To>
+void parse_cast_batch_checked(const char* data, std::size_t width, std::size_t count, To* output)
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    detail::parse::parse_fixed<true>(data, width, count, output);
+}
+
+/// @brief Parses @p count fixed-width fields. Based on configuration this will call parse_cast_batch_checked.
+///
+/// @tparam To The type to cast to.
+/// @param data Pointer to the first field; fields are stored back to back, each @p width characters long.
+/// @param width The width of each field. Digits may be left-padded with spaces.
+/// @param count The number of fields to parse.
+/// @param output Pointer to storage for @p count values.
+/// @exception parse_cast_error Thrown (with the index of the first bad field) if a field is not a decimal integer or
+/// exceeds the range of the target type.
+template<typename To>
+auto parse_cast_batch(const char* data, std::size_t width, std::size_t count, To* output)
+    -> std::enable_if_t<CHECK_CASTS && is_parse_castable_v<To>>
+{
+    parse_cast_batch_checked(data, width, count, output);
+}
+
+/// @brief Parses @p count fixed-width fields. Based on configuration this will call parse_cast_batch_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @param data Pointer to the first field; fields are stored back to back, each @p width characters long.
+/// @param width The width of each field. Digits may be left-padded with spaces.
+/// @param count The number of fields to parse.
+/// @param output Pointer to storage for @p count values.
+template<typename To>
+auto parse_cast_batch(const char* data, std::size_t width, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_parse_castable_v<To>>
+{
+    parse_cast_batch_unchecked(data, width, count, output);
+}
+
+/// @brief Parses the fields of `[first, last)` separated by @p delimiter without performing runtime checks.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @param delimiter The character separating fields.
+/// @param output Pointer to storage for at most @p capacity values.
+/// @param capacity The number of values @p output can hold; parsing stops once it is full.
+/// @return The number of fields parsed.
+template<typename To>
+auto parse_cast_batch_unchecked(const char* first, const char* last, char delimiter, To* output,
+    std::size_t capacity) noexcept -> std::size_t
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    return detail::parse::parse_delimited<false>(first, last, delimiter, output, capacity);
+}
+
+/// @brief Parses the fields of `[first, last)` separated by @p delimiter with runtime checks.
+///
+/// Fields of up to 15 digits are located, validated and converted 16 bytes at a time with SSE4.1 where available.
+/// The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @param delimiter The character separating fields.
+/// @param output Pointer to storage for at most @p capacity values.
+/// @param capacity The number of values @p output can hold.
+/// @return The number of fields parsed.
+/// @exception parse_cast_error Thrown (with the index of the first bad field) if a field is not a decimal integer or
+/// exceeds the range of the target type, or if there are more than @p capacity fields.
+template<typename To>
+auto parse_cast_batch_checked(const char* first, const char* last, char delimiter, To* output,
+    std::size_t capacity) -> std::size_t
+{
+    static_assert(is_parse_castable_v<To>, "Text cannot be parsed as a `To`");
+
+    return detail::parse::parse_delimited<true>(first, last, delimiter, output, capacity);
+}
+
+/// @brief Parses the fields of `[first, last)` separated by @p delimiter. Based on configuration this will call
+/// parse_cast_batch_checked.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @param delimiter The character separating fields.
+/// @param output Pointer to storage for at most @p capacity values.
+/// @param capacity The number of values @p output can hold.
+/// @return The number of fields parsed.
+/// @exception parse_cast_error Thrown (with the index of the first bad field) if a field is not a decimal integer or
+/// exceeds the range of the target type, or if there are more than @p capacity fields.
+template<typename To>
+auto parse_cast_batch(const char* first, const char* last, char delimiter, To* output, std::size_t capacity)
+    -> std::enable_if_t<CHECK_CASTS && is_parse_castable_v<To>, std::size_t>
+{
+    return parse_cast_batch_checked(first, last, delimiter, output, capacity);
+}
+
+/// @brief Parses the fields of `[first, last)` separated by @p delimiter. Based on configuration this will call
+/// parse_cast_batch_unchecked.
+///
+/// @tparam To The type to cast to.
+/// @param first Pointer to the first character.
+/// @param last Pointer one past the last character.
+/// @param delimiter The character separating fields.
+/// @param output Pointer to storage for at most @p capacity values.
+/// @param capacity The number of values @p output can hold; parsing stops once it is full.
+/// @return The number of fields parsed.
+template<typename To>
+auto parse_cast_batch(const char* first, const char* last, char delimiter, To* output, std::size_t capacity) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_parse_castable_v<To>, std::size_t>
+{
+    return parse_cast_batch_unchecked(first, last, delimiter, output, capacity);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_PARSE_CAST_HPP
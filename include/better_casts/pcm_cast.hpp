@@ -0,0 +1,806 @@
+///@file pcm_cast.hpp
+///@author Jackson Harmer
+///@brief Casts between floating point audio samples and integer PCM samples, with saturation and optional dither.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_PCM_CAST_HPP
+#define BETTER_CASTS_PCM_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace casts
+{
+/// @brief A packed 24-bit PCM sample: three bytes, little-endian (the layout of 24-bit WAV data and most audio
+/// interfaces).
+struct pcm24_t
+{
+    std::uint8_t bytes[3];
+};
+
+static_assert(sizeof(pcm24_t) == 3, "pcm24_t must not be padded");
+
+/// @brief Type trait to determine if a type is an integer PCM sample type (std::int16_t, pcm24_t or std::int32_t).
+template<typename T>
+struct is_pcm_sample : std::false_type
+{
+};
+
+template<>
+struct is_pcm_sample<std::int16_t> : std::true_type
+{
+};
+
+template<>
+struct is_pcm_sample<pcm24_t> : std::true_type
+{
+};
+
+template<>
+struct is_pcm_sample<std::int32_t> : std::true_type
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_pcm_sample.
+template<typename T>
+INLINE_CONSTEXPR bool is_pcm_sample_v = is_pcm_sample<T>::value;
+
+/// @brief Type trait to determine if two types are able to be cast via pcm_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - One of @p To or @p From must be a PCM sample type (see is_pcm_sample).
+/// - The other type must be `float` or `double`.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_pcm_castable :
+    std::integral_constant<bool,
+        ((is_pcm_sample_v<To> && (std::is_same<From, float>::value || std::is_same<From, double>::value))
+            || ((std::is_same<To, float>::value || std::is_same<To, double>::value) && is_pcm_sample_v<From>))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_pcm_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_pcm_castable_v = is_pcm_castable<To, From>::value;
+
+namespace detail
+{
+    namespace pcm
+    {
+        struct dither_none
+        {
+        };
+        struct dither_tpdf
+        {
+        };
+
+        template<typename T>
+        struct format;
+
+        template<>
+        struct format<std::int16_t>
+        {
+            using int_type = std::int16_t;
+            static constexpr int bits = 16;
+        };
+
+        template<>
+        struct format<pcm24_t>
+        {
+            using int_type = std::int32_t;
+            static constexpr int bits = 24;
+        };
+
+        template<>
+        struct format<std::int32_t>
+        {
+            using int_type = std::int32_t;
+            static constexpr int bits = 32;
+        };
+
+        /// Scaling and saturation bounds of the samples of @p T, as @p F: [-1, 1) maps onto the whole range of @p T.
+        ///
+        /// `upper` is the largest @p F not above the largest sample, as that sample is not always representable
+        /// (2^31 - 128 for float to std::int32_t).
+        template<typename T, typename F>
+        struct bounds
+        {
+            static constexpr int magnitude_bits = format<T>::bits - 1;
+            static constexpr int lost_bits = magnitude_bits > std::numeric_limits<F>::digits
+                ? magnitude_bits - std::numeric_limits<F>::digits
+                : 0;
+
+            static constexpr F scale = math::pow2<F>(magnitude_bits);
+            static constexpr F inv_scale = math::pow2<F>(-magnitude_bits);
+            static constexpr F lower = -scale;
+            static constexpr F upper = scale - math::pow2<F>(lost_bits);
+        };
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::scale;
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::inv_scale;
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::lower;
+
+        template<typename T, typename F>
+        constexpr F bounds<T, F>::upper;
+
+        // Samples are read and written with memcpy (and unaligned vector loads and stores), so the batch casts stay
+        // valid when the output overlays the input buffer
+        template<typename T>
+        NODISCARD inline auto load(const T* input) noexcept -> T
+        {
+            T val;
+            std::memcpy(&val, input, sizeof(val));
+            return val;
+        }
+
+        template<typename T>
+        inline void store(T* output, T val) noexcept
+        {
+            std::memcpy(output, &val, sizeof(val));
+        }
+
+        inline void store(pcm24_t* output, std::int32_t val) noexcept
+        {
+            const auto bits = static_cast<std::uint32_t>(val);
+            const std::uint8_t bytes[3] = { static_cast<std::uint8_t>(bits), static_cast<std::uint8_t>(bits >> 8U),
+                static_cast<std::uint8_t>(bits >> 16U) };
+
+            std::memcpy(output, bytes, sizeof(bytes));
+        }
+
+        NODISCARD inline auto sample_value(std::int16_t sample) noexcept -> std::int32_t
+        {
+            return sample;
+        }
+
+        NODISCARD inline auto sample_value(std::int32_t sample) noexcept -> std::int32_t
+        {
+            return sample;
+        }
+
+        NODISCARD inline auto sample_value(pcm24_t sample) noexcept -> std::int32_t
+        {
+            const std::uint32_t bits = sample.bytes[0] | (std::uint32_t{ sample.bytes[1] } << 8U)
+                | (std::uint32_t{ sample.bytes[2] } << 16U);
+
+            // Sign-extends the 24-bit value
+            return static_cast<std::int32_t>(bits ^ 0x800000U) - 0x800000;
+        }
+
+        template<typename T>
+        NODISCARD inline auto make_sample(typename format<T>::int_type val) noexcept -> T
+        {
+            T sample{};
+            store(&sample, val);
+            return sample;
+        }
+
+        /// TPDF dither: the difference of two uniform values, triangular over (-1, 1) LSB.
+        template<typename F>
+        NODISCARD inline auto tpdf_noise() -> F
+        {
+            const std::uint64_t bits = math::stochastic_bits();
+            return math::unit_interval<F>(bits & 0xFFFFFFFF00000000ULL) - math::unit_interval<F>(bits << 32U);
+        }
+
+        template<typename F>
+        NODISCARD inline auto dither(F scaled, dither_none /*tag*/) noexcept -> F
+        {
+            return scaled;
+        }
+
+        template<typename F>
+        NODISCARD inline auto dither(F scaled, dither_tpdf /*tag*/) -> F
+        {
+            return scaled + tpdf_noise<F>();
+        }
+
+        /// Scales, dithers and saturates @p val, then rounds it to nearest (ties to even). NaN becomes silence.
+        template<typename T, typename F, typename Dither>
+        NODISCARD inline auto to_int(F val, Dither tag) noexcept -> typename format<T>::int_type
+        {
+            using limits = bounds<T, F>;
+
+            const F scaled = dither(val * limits::scale, tag);
+
+            if (UNLIKELY(math::is_nan(scaled)))
+            {
+                return 0;
+            }
+
+            const F clamped =
+                scaled < limits::lower ? limits::lower : (scaled > limits::upper ? limits::upper : scaled);
+            return math::round_even<typename format<T>::int_type>(clamped);
+        }
+
+        template<typename F, typename T>
+        NODISCARD inline auto to_float(T sample) noexcept -> F
+        {
+            return static_cast<F>(sample_value(sample)) * bounds<T, F>::inv_scale;
+        }
+
+        template<bool Checked, typename T, typename F, typename Dither>
+        inline auto to_pcm_simd(const F* /*input*/, std::size_t /*count*/, T* /*output*/, Dither /*tag*/,
+            bool& /*valid*/) noexcept -> std::size_t
+        {
+            // No vector kernel for this combination, the scalar loop handles every element
+            return 0;
+        }
+
+        // Converts from the end and returns the number of samples left at the start
+        template<typename T, typename F>
+        inline auto to_float_simd(const T* /*input*/, std::size_t count, F* /*output*/) noexcept -> std::size_t
+        {
+            return count;
+        }
+
+#ifdef __AVX2__
+        /// Dither noise for the vector kernels: a xorshift32 generator per lane, seeded from the stochastic rounding
+        /// generator once per batch (so set_stochastic_rng also makes batch dither reproducible).
+        class lane_noise
+        {
+        public:
+            lane_noise() : m_state(seed()) {}
+
+            /// Returns TPDF noise in (-1, 1) for 8 float lanes.
+            auto next_ps() noexcept -> __m256
+            {
+                m_state = _mm256_xor_si256(m_state, _mm256_slli_epi32(m_state, 13));
+                m_state = _mm256_xor_si256(m_state, _mm256_srli_epi32(m_state, 17));
+                m_state = _mm256_xor_si256(m_state, _mm256_slli_epi32(m_state, 5));
+
+                // The two 16-bit halves of each lane are independent uniform values
+                const __m256i low = _mm256_and_si256(m_state, _mm256_set1_epi32(0xFFFF));
+                const __m256i high = _mm256_srli_epi32(m_state, 16);
+                const __m256 diff = _mm256_cvtepi32_ps(_mm256_sub_epi32(low, high));
+
+                return _mm256_mul_ps(diff, _mm256_set1_ps(1.0F / 65536.0F));
+            }
+
+            /// Returns TPDF noise in (-1, 1) for 4 double lanes.
+            auto next_pd() noexcept -> __m256d
+            {
+                return _mm256_cvtps_pd(_mm256_castps256_ps128(next_ps()));
+            }
+
+        private:
+            static auto seed() -> __m256i
+            {
+                alignas(32) std::uint64_t lanes[4];
+
+                for (std::uint64_t& lane : lanes)
+                {
+                    lane = math::stochastic_bits();
+                }
+
+                // xorshift32 never leaves the all-zero state
+                const __m256i state = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+                return _mm256_or_si256(state, _mm256_set1_epi32(1));
+            }
+
+            __m256i m_state;
+        };
+
+        template<typename Dither>
+        struct lane_dither;
+
+        template<>
+        struct lane_dither<dither_none>
+        {
+            NODISCARD auto apply(__m256 scaled) noexcept -> __m256
+            {
+                return scaled;
+            }
+
+            NODISCARD auto apply(__m256d scaled) noexcept -> __m256d
+            {
+                return scaled;
+            }
+        };
+
+        template<>
+        struct lane_dither<dither_tpdf>
+        {
+            lane_noise noise{};
+
+            NODISCARD auto apply(__m256 scaled) noexcept -> __m256
+            {
+                return _mm256_add_ps(scaled, noise.next_ps());
+            }
+
+            NODISCARD auto apply(__m256d scaled) noexcept -> __m256d
+            {
+                return _mm256_add_pd(scaled, noise.next_pd());
+            }
+        };
+
+        inline void store_lanes(std::int16_t* output, __m256i val) noexcept
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), simd::pack_i32_to_i16(val));
+        }
+
+        inline void store_lanes(std::int32_t* output, __m256i val) noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), val);
+        }
+
+        inline void store_lanes(std::int16_t* output, __m128i val) noexcept
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packs_epi32(val, val));
+        }
+
+        inline void store_lanes(std::int32_t* output, __m128i val) noexcept
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), val);
+        }
+
+        /// Stores the low 3 bytes of 4 lanes as 12 packed bytes (without writing past them).
+        inline void store_lanes(pcm24_t* output, __m128i val) noexcept
+        {
+            const __m128i packed =
+                _mm_shuffle_epi8(val, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+            const int tail = _mm_extract_epi32(packed, 2);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output), packed);
+            std::memcpy(reinterpret_cast<std::uint8_t*>(output) + 8, &tail, sizeof(tail));
+        }
+
+        inline void store_lanes(pcm24_t* output, __m256i val) noexcept
+        {
+            store_lanes(output, _mm256_castsi256_si128(val));
+            store_lanes(output + 4, _mm256_extracti128_si256(val, 1));
+        }
+
+        /// Scales, dithers, saturates and rounds (ties to even) 8 floats; NaN lanes become silence.
+        template<typename T, typename Dither>
+        NODISCARD inline auto to_lanes(__m256 val, lane_dither<Dither>& noise) noexcept -> __m256i
+        {
+            using limits = bounds<T, float>;
+
+            const __m256 scaled = noise.apply(_mm256_mul_ps(val, _mm256_set1_ps(limits::scale)));
+            const __m256 ordered = _mm256_and_ps(scaled, _mm256_cmp_ps(scaled, scaled, _CMP_ORD_Q));
+            const __m256 clamped =
+                _mm256_min_ps(_mm256_max_ps(ordered, _mm256_set1_ps(limits::lower)), _mm256_set1_ps(limits::upper));
+
+            return _mm256_cvttps_epi32(simd::round(clamped, math::float_op_round_even{}));
+        }
+
+        template<typename T, typename Dither>
+        NODISCARD inline auto to_lanes(__m256d val, lane_dither<Dither>& noise) noexcept -> __m128i
+        {
+            using limits = bounds<T, double>;
+
+            const __m256d scaled = noise.apply(_mm256_mul_pd(val, _mm256_set1_pd(limits::scale)));
+            const __m256d ordered = _mm256_and_pd(scaled, _mm256_cmp_pd(scaled, scaled, _CMP_ORD_Q));
+            const __m256d clamped =
+                _mm256_min_pd(_mm256_max_pd(ordered, _mm256_set1_pd(limits::lower)), _mm256_set1_pd(limits::upper));
+
+            return _mm256_cvttpd_epi32(simd::round(clamped, math::float_op_round_even{}));
+        }
+
+        template<bool Checked, typename T, typename Dither>
+        inline auto to_pcm_simd(const float* input, std::size_t count, T* output, Dither /*tag*/, bool& valid)
+            -> std::size_t
+        {
+            lane_dither<Dither> noise{};
+            __m256 all_ordered = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            const std::size_t end = count - count % 8;
+
+            // Each block is loaded before it is stored, and a sample is never wider than a float, so the output
+            // never overwrites input that is still to be read
+            for (std::size_t idx = 0; idx < end; idx += 8)
+            {
+                const __m256 val = _mm256_loadu_ps(input + idx);
+
+                if (Checked)
+                {
+                    all_ordered = _mm256_and_ps(all_ordered, _mm256_cmp_ps(val, val, _CMP_ORD_Q));
+                }
+
+                store_lanes(output + idx, to_lanes<T>(val, noise));
+            }
+
+            valid = _mm256_movemask_ps(all_ordered) == 0xFF;
+            return end;
+        }
+
+        template<bool Checked, typename T, typename Dither>
+        inline auto to_pcm_simd(const double* input, std::size_t count, T* output, Dither /*tag*/, bool& valid)
+            -> std::size_t
+        {
+            lane_dither<Dither> noise{};
+            __m256d all_ordered = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+            const std::size_t end = count - count % 4;
+
+            for (std::size_t idx = 0; idx < end; idx += 4)
+            {
+                const __m256d val = _mm256_loadu_pd(input + idx);
+
+                if (Checked)
+                {
+                    all_ordered = _mm256_and_pd(all_ordered, _mm256_cmp_pd(val, val, _CMP_ORD_Q));
+                }
+
+                store_lanes(output + idx, to_lanes<T>(val, noise));
+            }
+
+            valid = _mm256_movemask_pd(all_ordered) == 0xF;
+            return end;
+        }
+
+        NODISCARD inline auto load_lanes(const std::int16_t* input) noexcept -> __m256i
+        {
+            return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+        }
+
+        NODISCARD inline auto load_lanes(const std::int32_t* input) noexcept -> __m256i
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+        }
+
+        /// Loads 8 packed 24-bit samples (24 bytes, without reading past them) as sign-extended 32-bit lanes.
+        NODISCARD inline auto load_lanes(const pcm24_t* input) noexcept -> __m256i
+        {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(input);
+
+            // Each sample goes to the top 3 bytes of its lane, so an arithmetic shift sign-extends it. The second
+            // load starts 4 bytes early to stay within the 24 bytes.
+            const __m128i first = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes)),
+                _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11));
+            const __m128i second = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + 8)),
+                _mm_setr_epi8(-1, 4, 5, 6, -1, 7, 8, 9, -1, 10, 11, 12, -1, 13, 14, 15));
+
+            return _mm256_srai_epi32(_mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1), 8);
+        }
+
+        template<typename T>
+        inline auto to_float_simd(const T* input, std::size_t count, float* output) noexcept -> std::size_t
+        {
+            const __m256 inv_scale = _mm256_set1_ps(bounds<T, float>::inv_scale);
+            std::size_t idx = count;
+
+            // From the end, so that output overlaying the (narrower) input only overwrites samples already converted
+            for (; idx >= 8; idx -= 8)
+            {
+                const __m256 val = _mm256_cvtepi32_ps(load_lanes(input + idx - 8));
+                _mm256_storeu_ps(output + idx - 8, _mm256_mul_ps(val, inv_scale));
+            }
+
+            return idx;
+        }
+#endif
+
+        template<typename T, typename F, typename Dither>
+        inline auto to_pcm_scalar(const F* input, std::size_t first, std::size_t count, T* output, Dither tag) noexcept
+            -> bool
+        {
+            bool valid = true;
+
+            for (std::size_t idx = first; idx < count; ++idx)
+            {
+                const F val = load(input + idx);
+
+                valid = valid && !math::is_nan(val);
+                store(output + idx, to_int<T>(val, tag));
+            }
+
+            return valid;
+        }
+
+        template<bool Checked, typename T, typename F, typename Dither>
+        inline auto to_pcm_batch(const F* input, std::size_t count, T* output, Dither tag) noexcept -> bool
+        {
+            bool valid = true;
+            const std::size_t done = to_pcm_simd<Checked>(input, count, output, tag, valid);
+
+            return to_pcm_scalar(input, done, count, output, tag) && valid;
+        }
+
+        template<typename F, typename T>
+        inline void to_float_batch(const T* input, std::size_t count, F* output) noexcept
+        {
+            // The vector kernel converts the tail, leaving the first samples (also from the end)
+            for (std::size_t idx = to_float_simd(input, count, output); idx > 0; --idx)
+            {
+                store(output + idx - 1, to_float<F>(load(input + idx - 1)));
+            }
+        }
+
+        /// True if the @p count samples written to @p output overlap (and so overwrite) those of @p input.
+        template<typename F, typename T>
+        NODISCARD inline auto overlaps(const F* input, std::size_t count, const T* output) noexcept -> bool
+        {
+            const auto in = reinterpret_cast<std::uintptr_t>(input);
+            const auto out = reinterpret_cast<std::uintptr_t>(output);
+
+            return out < in + count * sizeof(F) && in < out + count * sizeof(T);
+        }
+
+        /// True if any of the @p count samples of @p input is NaN (without branches, so the scan vectorizes).
+        template<typename F>
+        NODISCARD inline auto has_nan(const F* input, std::size_t count) noexcept -> bool
+        {
+            unsigned found = 0;
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                found |= static_cast<unsigned>(math::is_nan(load(input + idx)));
+            }
+
+            return found != 0;
+        }
+
+        template<typename F>
+        NORETURN COLD inline void throw_batch_error(const F* input, std::size_t count)
+        {
+            std::size_t idx = 0;
+
+            while (idx < count && !math::is_nan(load(input + idx)))
+            {
+                ++idx;
+            }
+
+            throw_cast_error<float_cast_error>(
+                ("pcm_cast failed: cannot cast from NaN (input at index " + std::to_string(idx) + ")").c_str());
+        }
+    } //namespace pcm
+} // namespace detail
+
+/// @brief Namespace containing the dither tags accepted by pcm_cast.
+namespace pcm_dither
+{
+    /// @brief Tag for rounding the scaled sample to nearest (ties to even) without dither.
+    INLINE_CONSTEXPR detail::pcm::dither_none none{};
+
+    /// @brief Tag for adding triangular (TPDF) dither of up to 1 LSB before rounding, which decorrelates the
+    /// quantization error from the signal. The noise comes from the stochastic rounding generator (see
+    /// set_stochastic_rng).
+    INLINE_CONSTEXPR detail::pcm::dither_tpdf tpdf{};
+} //namespace pcm_dither
+
+/// @brief Casts a floating point sample to an integer PCM sample without performing runtime checks.
+///
+/// [-1, 1) maps onto the full range of @p To (a scale of 2^15, 2^23 or 2^31). Louder values are clipped to the
+/// nearest full-scale sample, and NaN becomes silence (0).
+///
+/// @tparam To The PCM sample type to cast to (std::int16_t, pcm24_t or std::int32_t).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Dither The dither applied before rounding.
+/// @param from_val The value to cast.
+/// @param dither The dither to apply (none by default).
+/// @return The PCM sample.
+template<typename To, typename From, typename Dither = detail::pcm::dither_none,
+    std::enable_if_t<is_pcm_sample_v<To>, bool> = true>
+NODISCARD inline auto pcm_cast_unchecked(From from_val, Dither dither = Dither{}) noexcept -> To
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::pcm::make_sample<To>(detail::pcm::to_int<To>(from_val, dither));
+}
+
+/// @brief Casts a floating point sample to an integer PCM sample with runtime checks.
+///
+/// Clipping is not an error: louder values saturate to the nearest full-scale sample.
+///
+/// @tparam To The PCM sample type to cast to (std::int16_t, pcm24_t or std::int32_t).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Dither The dither applied before rounding.
+/// @param from_val The value to cast.
+/// @param dither The dither to apply (none by default).
+/// @return The PCM sample.
+/// @exception float_cast_error Thrown if the value is NaN.
+template<typename To, typename From, typename Dither = detail::pcm::dither_none,
+    std::enable_if_t<is_pcm_sample_v<To>, bool> = true>
+NODISCARD inline auto pcm_cast_checked(From from_val, Dither dither = Dither{}) -> To
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(detail::math::is_nan(from_val)))
+    {
+        detail::throw_cast_error<float_cast_error>("pcm_cast failed: cannot cast from NaN");
+    }
+
+    return pcm_cast_unchecked<To>(from_val, dither);
+}
+
+/// @brief Casts a floating point sample to an integer PCM sample. Based on configuration this will call
+/// pcm_cast_checked.
+///
+/// @tparam To The PCM sample type to cast to (std::int16_t, pcm24_t or std::int32_t).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Dither The dither applied before rounding.
+/// @param from_val The value to cast.
+/// @param dither The dither to apply (none by default).
+/// @return The PCM sample.
+/// @exception float_cast_error Thrown if the value is NaN.
+template<typename To, typename From, typename Dither = detail::pcm::dither_none>
+NODISCARD inline auto pcm_cast(From from_val, Dither dither = Dither{})
+    -> std::enable_if_t<CHECK_CASTS && is_pcm_sample_v<To>, To>
+{
+    return pcm_cast_checked<To>(from_val, dither);
+}
+
+/// @brief Casts a floating point sample to an integer PCM sample. Based on configuration this will call
+/// pcm_cast_unchecked.
+///
+/// @tparam To The PCM sample type to cast to (std::int16_t, pcm24_t or std::int32_t).
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Dither The dither applied before rounding.
+/// @param from_val The value to cast.
+/// @param dither The dither to apply (none by default).
+/// @return The PCM sample.
+template<typename To, typename From, typename Dither = detail::pcm::dither_none>
+NODISCARD inline auto pcm_cast(From from_val, Dither dither = Dither{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_pcm_sample_v<To>, To>
+{
+    return pcm_cast_unchecked<To>(from_val, dither);
+}
+
+/// @brief Casts an integer PCM sample to a floating point sample in [-1, 1) (no runtime checks needed).
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam From The PCM sample type to cast from.
+/// @param from_val The sample to cast.
+/// @return The floating point sample.
+template<typename To, typename From>
+NODISCARD inline auto pcm_cast(From from_val) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_pcm_sample_v<From>, To>
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::pcm::to_float<To>(from_val);
+}
+
+/// @brief Casts an array of floating point samples to integer PCM without performing runtime checks.
+///
+/// Interleaved multichannel buffers are converted as they are (pass frames * channels as @p count). Uses AVX2 kernels
+/// where available. @p output may overlay @p input (start at the same address) to convert a buffer in place.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The PCM sample type to cast to.
+/// @tparam Dither The dither applied before rounding.
+/// @param input Pointer to the first of @p count samples to cast.
+/// @param count The number of samples to cast.
+/// @param output Pointer to storage for @p count PCM samples.
+/// @param dither The dither to apply (none by default).
+template<typename From, typename To, typename Dither = detail::pcm::dither_none>
+auto pcm_cast_batch_unchecked(const From* input, std::size_t count, To* output, Dither dither = Dither{}) noexcept
+    -> std::enable_if_t<is_pcm_sample_v<To>>
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    (void)detail::pcm::to_pcm_batch<false>(input, count, output, dither);
+}
+
+/// @brief Casts an array of floating point samples to integer PCM with runtime checks.
+///
+/// Clipping is not an error: louder values saturate. The NaN check is folded into the conversion and reported once at
+/// the end; the contents of @p output are unspecified if an error is thrown. When @p output overlays @p input, the
+/// input is scanned for NaN first instead, so it is left unchanged if an error is thrown.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The PCM sample type to cast to.
+/// @tparam Dither The dither applied before rounding.
+/// @param input Pointer to the first of @p count samples to cast.
+/// @param count The number of samples to cast.
+/// @param output Pointer to storage for @p count PCM samples (may overlay @p input).
+/// @param dither The dither to apply (none by default).
+/// @exception float_cast_error Thrown if any sample is NaN.
+template<typename From, typename To, typename Dither = detail::pcm::dither_none>
+auto pcm_cast_batch_checked(const From* input, std::size_t count, To* output, Dither dither = Dither{})
+    -> std::enable_if_t<is_pcm_sample_v<To>>
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (detail::pcm::overlaps(input, count, output))
+    {
+        // The conversion overwrites the input, so the NaN to report is located before it starts
+        if (UNLIKELY(detail::pcm::has_nan(input, count)))
+        {
+            detail::pcm::throw_batch_error(input, count);
+        }
+
+        (void)detail::pcm::to_pcm_batch<false>(input, count, output, dither);
+    }
+    else if (UNLIKELY(!detail::pcm::to_pcm_batch<true>(input, count, output, dither)))
+    {
+        // The input is intact, so it is only scanned again to find the NaN
+        detail::pcm::throw_batch_error(input, count);
+    }
+}
+
+/// @brief Casts an array of floating point samples to integer PCM. Based on configuration this will call
+/// pcm_cast_batch_checked.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The PCM sample type to cast to.
+/// @tparam Dither The dither applied before rounding.
+/// @param input Pointer to the first of @p count samples to cast.
+/// @param count The number of samples to cast.
+/// @param output Pointer to storage for @p count PCM samples (may overlay @p input).
+/// @param dither The dither to apply (none by default).
+/// @exception float_cast_error Thrown if any sample is NaN.
+template<typename From, typename To, typename Dither = detail::pcm::dither_none>
+auto pcm_cast_batch(const From* input, std::size_t count, To* output, Dither dither = Dither{})
+    -> std::enable_if_t<CHECK_CASTS && is_pcm_sample_v<To>>
+{
+    pcm_cast_batch_checked(input, count, output, dither);
+}
+
+/// @brief Casts an array of floating point samples to integer PCM. Based on configuration this will call
+/// pcm_cast_batch_unchecked.
+///
+/// @tparam From The (floating point) type to cast from.
+/// @tparam To The PCM sample type to cast to.
+/// @tparam Dither The dither applied before rounding.
+/// @param input Pointer to the first of @p count samples to cast.
+/// @param count The number of samples to cast.
+/// @param output Pointer to storage for @p count PCM samples (may overlay @p input).
+/// @param dither The dither to apply (none by default).
+template<typename From, typename To, typename Dither = detail::pcm::dither_none>
+auto pcm_cast_batch(const From* input, std::size_t count, To* output, Dither dither = Dither{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_pcm_sample_v<To>>
+{
+    pcm_cast_batch_unchecked(input, count, output, dither);
+}
+
+/// @brief Casts an array of integer PCM samples to floating point samples in [-1, 1) (no runtime checks needed).
+///
+/// Uses AVX2 kernels for float output where available. @p output may overlay @p input (start at the same address) if
+/// it has room for the @p count wider samples, as the samples are converted from the end.
+///
+/// @tparam From The PCM sample type to cast from.
+/// @tparam To The (floating point) type to cast to.
+/// @param input Pointer to the first of @p count samples to cast.
+/// @param count The number of samples to cast.
+/// @param output Pointer to storage for @p count floating point samples.
+template<typename From, typename To>
+auto pcm_cast_batch(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<std::is_floating_point<To>::value && is_pcm_sample_v<From>>
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::pcm::to_float_batch(input, count, output);
+}
+
+/// @brief Converts a buffer of floating point samples to integer PCM in place (see pcm_cast_batch).
+///
+/// @tparam To The PCM sample type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Dither The dither applied before rounding.
+/// @param buffer Pointer to the first of @p count samples, overwritten by the PCM samples.
+/// @param count The number of samples to cast.
+/// @param dither The dither to apply (none by default).
+/// @return Pointer to the first PCM sample (at the address of @p buffer).
+/// @exception float_cast_error Thrown if any sample is NaN (when checked casts are enabled).
+template<typename To, typename From, typename Dither = detail::pcm::dither_none>
+auto pcm_cast_in_place(From* buffer, std::size_t count, Dither dither = Dither{}) noexcept(!CHECK_CASTS)
+    -> std::enable_if_t<is_pcm_sample_v<To>, To*>
+{
+    static_assert(is_pcm_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    To* output = reinterpret_cast<To*>(buffer);
+    pcm_cast_batch(static_cast<const From*>(buffer), count, output, dither);
+    return output;
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_PCM_CAST_HPP
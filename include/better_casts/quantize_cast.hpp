@@ -0,0 +1,606 @@
+///@file quantize_cast.hpp
+///@author Jackson Harmer
+///@brief Affine quantization casts between floating point values and 8/16-bit integers.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_QUANTIZE_CAST_HPP
+#define BETTER_CASTS_QUANTIZE_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace casts
+{
+/// @brief Affine quantization parameters, where a quantized value `q` represents `(q - zero_point) * scale`.
+///
+/// Matches the per-tensor (or per-channel) parameters used by int8 inference engines: a float scale and an int32
+/// zero point that must lie within the range of the quantized type.
+struct quant_params
+{
+    float scale;
+    std::int32_t zero_point;
+};
+
+/// @brief Type trait to determine if two types are able to be cast via quantize_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - @p To must be an 8 or 16-bit integral type (cannot be a bool).
+/// - @p From must be a floating point type.
+///
+/// @tparam To The (integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_quantize_castable :
+    std::integral_constant<bool,
+        (std::is_integral<To>::value && !std::is_same<To, bool>::value && sizeof(To) <= 2
+            && std::is_floating_point<From>::value)>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_quantize_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_quantize_castable_v = is_quantize_castable<To, From>::value;
+
+namespace detail
+{
+    namespace quant
+    {
+        template<typename To, typename F>
+        struct clamp_bounds
+        {
+            static constexpr F lower = static_cast<F>((std::numeric_limits<To>::min)());
+            static constexpr F upper = static_cast<F>((std::numeric_limits<To>::max)());
+        };
+
+        template<typename To, typename F>
+        constexpr F clamp_bounds<To, F>::lower;
+
+        template<typename To, typename F>
+        constexpr F clamp_bounds<To, F>::upper;
+
+        template<typename To, typename F, typename Op>
+        NODISCARD inline auto quantize(F val, F scale, F zero_point, Op tag) noexcept -> To
+        {
+            // A division rather than a multiply by 1 / scale, which rounds differently at ties (ex. 0.525 / 0.01)
+            const F shifted = simd::round(val / scale, tag) + zero_point;
+
+            // Written so NaN saturates to the lower bound, matching the vector kernels
+            if (!(shifted >= clamp_bounds<To, F>::lower))
+            {
+                return (std::numeric_limits<To>::min)();
+            }
+
+            if (shifted > clamp_bounds<To, F>::upper)
+            {
+                return (std::numeric_limits<To>::max)();
+            }
+
+            return static_cast<To>(shifted);
+        }
+
+        template<typename To>
+        inline void check_params(const quant_params& params)
+        {
+            if (UNLIKELY(!(params.scale > 0.0F) || math::is_inf(params.scale)))
+            {
+                throw_cast_error<float_cast_error>("quantize_cast failed: scale must be positive and finite");
+            }
+
+            if (UNLIKELY(params.zero_point < static_cast<std::int32_t>((std::numeric_limits<To>::min)())
+                    || params.zero_point > static_cast<std::int32_t>((std::numeric_limits<To>::max)())))
+            {
+                throw_cast_error<float_cast_error>(
+                    "quantize_cast failed: zero point exceeded the range of the output type");
+            }
+        }
+
+        template<bool Checked, typename To, typename F, typename Op>
+        inline auto quantize_simd(const F* /*input*/, std::size_t /*count*/, To* /*output*/, F /*scale*/,
+            F /*zero_point*/, Op /*tag*/, bool& /*valid*/) noexcept -> std::size_t
+        {
+            // No vector kernel for this type, the scalar loop handles every element
+            return 0;
+        }
+
+#if defined(__AVX512F__)
+        NODISCARD inline auto narrow_lanes(__m512i val, std::int8_t* /*tag*/) noexcept -> __m128i
+        {
+            return _mm512_cvtsepi32_epi8(val);
+        }
+
+        NODISCARD inline auto narrow_lanes(__m512i val, std::uint8_t* /*tag*/) noexcept -> __m128i
+        {
+            return _mm512_cvtusepi32_epi8(val);
+        }
+
+        template<bool Checked, typename To, typename Op>
+        inline auto quantize_simd_bytes(const float* input, std::size_t count, To* output, float scale,
+            float zero_point, Op tag, bool& valid) noexcept -> std::size_t
+        {
+            const __m512 divisor = _mm512_set1_ps(scale);
+            const __m512 offset = _mm512_set1_ps(zero_point);
+            const __m512 lower = _mm512_set1_ps(clamp_bounds<To, float>::lower);
+            const __m512 upper = _mm512_set1_ps(clamp_bounds<To, float>::upper);
+            __mmask16 all_ordered = 0xFFFF;
+
+            std::size_t idx = 0;
+
+            for (; idx + 16 <= count; idx += 16)
+            {
+                const __m512 val = _mm512_loadu_ps(input + idx);
+
+                if (Checked)
+                {
+                    all_ordered = static_cast<__mmask16>(all_ordered & _mm512_cmp_ps_mask(val, val, _CMP_ORD_Q));
+                }
+
+                // max/min return their second operand for NaN, so NaN lanes clamp to the lower bound
+                const __m512 shifted = _mm512_add_ps(simd::round(_mm512_div_ps(val, divisor), tag), offset);
+                const __m512 clamped = _mm512_min_ps(_mm512_max_ps(shifted, lower), upper);
+                const __m128i narrowed = narrow_lanes(_mm512_cvttps_epi32(clamped), static_cast<To*>(nullptr));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + idx), narrowed);
+            }
+
+            valid = all_ordered == 0xFFFF;
+            return idx;
+        }
+#elif defined(__AVX2__)
+        NODISCARD inline auto pack_words(__m256i low, __m256i high, std::int8_t* /*tag*/) noexcept -> __m256i
+        {
+            return _mm256_packs_epi16(low, high);
+        }
+
+        NODISCARD inline auto pack_words(__m256i low, __m256i high, std::uint8_t* /*tag*/) noexcept -> __m256i
+        {
+            return _mm256_packus_epi16(low, high);
+        }
+
+        template<bool Checked, typename To, typename Op>
+        inline auto quantize_simd_bytes(const float* input, std::size_t count, To* output, float scale,
+            float zero_point, Op tag, bool& valid) noexcept -> std::size_t
+        {
+            const __m256 divisor = _mm256_set1_ps(scale);
+            const __m256 offset = _mm256_set1_ps(zero_point);
+            const __m256 lower = _mm256_set1_ps(clamp_bounds<To, float>::lower);
+            const __m256 upper = _mm256_set1_ps(clamp_bounds<To, float>::upper);
+            const __m256i lane_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+            __m256 all_ordered = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            std::size_t idx = 0;
+
+            for (; idx + 32 <= count; idx += 32)
+            {
+                __m256i quads[4];
+
+                for (int part = 0; part < 4; ++part)
+                {
+                    const __m256 val = _mm256_loadu_ps(input + idx + (8 * static_cast<std::size_t>(part)));
+
+                    if (Checked)
+                    {
+                        all_ordered = _mm256_and_ps(all_ordered, _mm256_cmp_ps(val, val, _CMP_ORD_Q));
+                    }
+
+                    // max/min return their second operand for NaN, so NaN lanes clamp to the lower bound
+                    const __m256 shifted = _mm256_add_ps(simd::round(_mm256_div_ps(val, divisor), tag), offset);
+                    quads[part] = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(shifted, lower), upper));
+                }
+
+                // Packing works within 128-bit lanes, so restore the element order with a final permute
+                const __m256i words_low = _mm256_packs_epi32(quads[0], quads[1]);
+                const __m256i words_high = _mm256_packs_epi32(quads[2], quads[3]);
+                const __m256i bytes = pack_words(words_low, words_high, static_cast<To*>(nullptr));
+
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + idx), _mm256_permutevar8x32_epi32(bytes, lane_order));
+            }
+
+            valid = _mm256_movemask_ps(all_ordered) == 0xFF;
+            return idx;
+        }
+#endif
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+        template<bool Checked, typename Op>
+        inline auto quantize_simd(const float* input, std::size_t count, std::int8_t* output, float scale,
+            float zero_point, Op tag, bool& valid) noexcept -> std::size_t
+        {
+            return quantize_simd_bytes<Checked>(input, count, output, scale, zero_point, tag, valid);
+        }
+
+        template<bool Checked, typename Op>
+        inline auto quantize_simd(const float* input, std::size_t count, std::uint8_t* output, float scale,
+            float zero_point, Op tag, bool& valid) noexcept -> std::size_t
+        {
+            return quantize_simd_bytes<Checked>(input, count, output, scale, zero_point, tag, valid);
+        }
+#endif
+
+        template<typename To, typename F, typename Op>
+        inline auto quantize_scalar(const F* input, std::size_t first, std::size_t count, To* output, F scale,
+            F zero_point, Op tag) noexcept -> bool
+        {
+            bool valid = true;
+
+            for (std::size_t idx = first; idx < count; ++idx)
+            {
+                valid = valid && !math::is_nan(input[idx]);
+                output[idx] = quantize<To>(input[idx], scale, zero_point, tag);
+            }
+
+            return valid;
+        }
+
+        /// @p offset is the index of @p input in the caller's array (non-zero for the chunks of a parallel cast).
+        template<typename F>
+        NORETURN COLD inline void throw_batch_error(const F* input, std::size_t count, std::size_t offset = 0)
+        {
+            std::size_t idx = 0;
+
+            while (idx < count && !math::is_nan(input[idx]))
+            {
+                ++idx;
+            }
+
+            throw_cast_error<float_cast_error>(
+                ("quantize_cast failed: cannot cast from NaN (input at index " + std::to_string(offset + idx) + ")")
+                    .c_str());
+        }
+
+        template<bool Checked, typename To, typename F, typename Op>
+        inline auto quantize_batch(const F* input, std::size_t count, To* output, const quant_params& params,
+            Op tag) noexcept -> bool
+        {
+            const F scale = static_cast<F>(params.scale);
+            const F zero_point = static_cast<F>(params.zero_point);
+
+            bool valid = true;
+            const std::size_t done = quantize_simd<Checked>(input, count, output, scale, zero_point, tag, valid);
+
+            return quantize_scalar(input, done, count, output, scale, zero_point, tag) && valid;
+        }
+    } //namespace quant
+} // namespace detail
+
+/// @brief Quantizes a floating point value without performing runtime checks.
+///
+/// Computes `round(from_val / scale) + zero_point`, saturated to the range of @p To.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param from_val The value to cast.
+/// @param params The quantization parameters.
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @return The quantized value.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+NODISCARD inline auto quantize_cast_unchecked(From from_val, const quant_params& params, Op float_op = Op{}) noexcept
+    -> To
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return detail::quant::quantize<To>(
+        from_val, static_cast<From>(params.scale), static_cast<From>(params.zero_point), float_op);
+}
+
+/// @brief Quantizes a floating point value with runtime checks.
+///
+/// Computes `round(from_val / scale) + zero_point`, saturated to the range of @p To. Values outside of the
+/// representable range saturate (rather than throw), as expected for activations.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param from_val The value to cast.
+/// @param params The quantization parameters.
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @return The quantized value.
+/// @exception float_cast_error Thrown if the value is NaN or the parameters are invalid.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+NODISCARD inline auto quantize_cast_checked(From from_val, const quant_params& params, Op float_op = Op{}) -> To
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::quant::check_params<To>(params);
+
+    if (UNLIKELY(detail::math::is_nan(from_val)))
+    {
+        detail::throw_cast_error<float_cast_error>("quantize_cast failed: cannot cast from NaN");
+    }
+
+    return quantize_cast_unchecked<To>(from_val, params, float_op);
+}
+
+/// @brief Quantizes a floating point value. Based on configuration this will call quantize_cast_checked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param from_val The value to cast.
+/// @param params The quantization parameters.
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @return The quantized value.
+/// @exception float_cast_error Thrown if the value is NaN or the parameters are invalid.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+NODISCARD inline auto quantize_cast(From from_val, const quant_params& params, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS, To>
+{
+    return quantize_cast_checked<To>(from_val, params, float_op);
+}
+
+/// @brief Quantizes a floating point value. Based on configuration this will call quantize_cast_unchecked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param from_val The value to cast.
+/// @param params The quantization parameters.
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @return The quantized value.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+NODISCARD inline auto quantize_cast(From from_val, const quant_params& params, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    return quantize_cast_unchecked<To>(from_val, params, float_op);
+}
+
+/// @brief Converts a quantized value back to a floating point value (no runtime checks needed).
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam From The (integral) type to cast from.
+/// @param from_val The quantized value.
+/// @param params The quantization parameters.
+/// @return The real value `(from_val - zero_point) * scale`.
+template<typename To = float, typename From>
+NODISCARD constexpr auto dequantize_cast(From from_val, const quant_params& params) noexcept -> To
+{
+    static_assert(is_quantize_castable_v<From, To>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return static_cast<To>(static_cast<std::int32_t>(from_val) - params.zero_point) * static_cast<To>(params.scale);
+}
+
+/// @brief Quantizes an array of floating point values without performing runtime checks.
+///
+/// Uses AVX-512 or AVX2 kernels (multiply, round, clamp and pack with saturation) for float to 8-bit casts where
+/// available.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+void quantize_cast_batch_unchecked(
+    const From* input, std::size_t count, To* output, const quant_params& params, Op float_op = Op{}) noexcept
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    (void)detail::quant::quantize_batch<false>(input, count, output, params, float_op);
+}
+
+/// @brief Quantizes an array of floating point values with runtime checks.
+///
+/// The NaN check is folded into the vector kernel, so it costs a compare per vector rather than a branch per
+/// element. The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @exception float_cast_error Thrown if any value is NaN or the parameters are invalid.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+void quantize_cast_batch_checked(
+    const From* input, std::size_t count, To* output, const quant_params& params, Op float_op = Op{})
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::quant::check_params<To>(params);
+
+    if (UNLIKELY(!detail::quant::quantize_batch<true>(input, count, output, params, float_op)))
+    {
+        detail::quant::throw_batch_error(input, count);
+    }
+}
+
+/// @brief Quantizes an array of floating point values. Based on configuration this will call
+/// quantize_cast_batch_checked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @exception float_cast_error Thrown if any value is NaN or the parameters are invalid.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch(
+    const From* input, std::size_t count, To* output, const quant_params& params, Op float_op = Op{})
+    -> std::enable_if_t<CHECK_CASTS && is_quantize_castable_v<To, From>>
+{
+    quantize_cast_batch_checked(input, count, output, params, float_op);
+}
+
+/// @brief Quantizes an array of floating point values. Based on configuration this will call
+/// quantize_cast_batch_unchecked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params The quantization parameters (shared by the whole tensor).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch(
+    const From* input, std::size_t count, To* output, const quant_params& params, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_quantize_castable_v<To, From>>
+{
+    quantize_cast_batch_unchecked(input, count, output, params, float_op);
+}
+
+/// @brief Quantizes a channels-last tensor with per-channel parameters without performing runtime checks.
+///
+/// Element `i` uses `params[i % channels]` (the per-axis layout used for weights), so @p count should be a multiple
+/// of @p channels. Nothing is written if @p channels is zero.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params Pointer to @p channels sets of quantization parameters.
+/// @param channels The number of channels (size of the innermost dimension).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+void quantize_cast_batch_unchecked(const From* input, std::size_t count, To* output, const quant_params* params,
+    std::size_t channels, Op float_op = Op{}) noexcept
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (channels == 0)
+    {
+        return;
+    }
+
+    for (std::size_t idx = 0; idx < count; idx += channels)
+    {
+        // A partial last row (when count is not a multiple of channels) uses the leading parameters
+        const std::size_t row = count - idx < channels ? count - idx : channels;
+
+        for (std::size_t channel = 0; channel < row; ++channel)
+        {
+            output[idx + channel] = quantize_cast_unchecked<To>(input[idx + channel], params[channel], float_op);
+        }
+    }
+}
+
+/// @brief Quantizes a channels-last tensor with per-channel parameters with runtime checks.
+///
+/// Element `i` uses `params[i % channels]` (the per-axis layout used for weights), so @p count must be a multiple
+/// of @p channels. The contents of @p output are unspecified if an error is thrown.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params Pointer to @p channels sets of quantization parameters.
+/// @param channels The number of channels (size of the innermost dimension).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @exception float_cast_error Thrown if any value is NaN, any parameters are invalid, or @p count is not a multiple
+/// of @p channels (or @p channels is zero).
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+void quantize_cast_batch_checked(const From* input, std::size_t count, To* output, const quant_params* params,
+    std::size_t channels, Op float_op = Op{})
+{
+    static_assert(is_quantize_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    if (UNLIKELY(channels == 0 || count % channels != 0))
+    {
+        detail::throw_cast_error<float_cast_error>(
+            "quantize_cast failed: count must be a multiple of a non-zero number of channels");
+    }
+
+    for (std::size_t channel = 0; channel < channels; ++channel)
+    {
+        detail::quant::check_params<To>(params[channel]);
+    }
+
+    bool valid = true;
+
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+        valid = valid && !detail::math::is_nan(input[idx]);
+    }
+
+    if (UNLIKELY(!valid))
+    {
+        detail::quant::throw_batch_error(input, count);
+    }
+
+    quantize_cast_batch_unchecked(input, count, output, params, channels, float_op);
+}
+
+/// @brief Quantizes a channels-last tensor with per-channel parameters. Based on configuration this will call
+/// quantize_cast_batch_checked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params Pointer to @p channels sets of quantization parameters.
+/// @param channels The number of channels (size of the innermost dimension).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+/// @exception float_cast_error Thrown if any value is NaN or any parameters are invalid.
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch(const From* input, std::size_t count, To* output, const quant_params* params,
+    std::size_t channels, Op float_op = Op{}) -> std::enable_if_t<CHECK_CASTS && is_quantize_castable_v<To, From>>
+{
+    quantize_cast_batch_checked(input, count, output, params, channels, float_op);
+}
+
+/// @brief Quantizes a channels-last tensor with per-channel parameters. Based on configuration this will call
+/// quantize_cast_batch_unchecked.
+///
+/// @tparam To The (8 or 16-bit integral) type to cast to.
+/// @tparam From The (floating point) type to cast from.
+/// @tparam Op The float_cast operation used for rounding.
+/// @param input Pointer to the first of @p count values to cast.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count quantized values.
+/// @param params Pointer to @p channels sets of quantization parameters.
+/// @param channels The number of channels (size of the innermost dimension).
+/// @param float_op The operation to perform (rounds to the nearest value by default).
+template<typename To, typename From, typename Op = detail::math::float_op_round>
+auto quantize_cast_batch(const From* input, std::size_t count, To* output, const quant_params* params,
+    std::size_t channels, Op float_op = Op{}) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_quantize_castable_v<To, From>>
+{
+    quantize_cast_batch_unchecked(input, count, output, params, channels, float_op);
+}
+
+/// @brief Converts an array of quantized values back to floating point values (no runtime checks needed).
+///
+/// @tparam To The (floating point) type to cast to.
+/// @tparam From The (integral) type to cast from.
+/// @param input Pointer to the first of @p count quantized values.
+/// @param count The number of values to cast.
+/// @param output Pointer to storage for @p count floating point values.
+/// @param params The quantization parameters (shared by the whole tensor).
+template<typename To, typename From>
+void dequantize_cast_batch(const From* input, std::size_t count, To* output, const quant_params& params) noexcept
+{
+    static_assert(is_quantize_castable_v<From, To>, "`From` does not meet the requirements to be casted to a `To`");
+
+    // Subtract, convert and multiply: simple enough for the compiler to vectorize
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+        output[idx] = dequantize_cast<To>(input[idx], params);
+    }
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_QUANTIZE_CAST_HPP
@@ -0,0 +1,336 @@
+///@file range_cast.hpp
+///@author Jackson Harmer
+///@brief Validates the range of an integer array once, so the casts of its elements need no further checks.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_RANGE_CAST_HPP
+#define BETTER_CASTS_RANGE_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "span_cast.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace casts
+{
+namespace detail
+{
+    namespace range
+    {
+        /// Checks if @p val is representable by @p To, for any combination of signs.
+        template<typename To, typename From>
+        NODISCARD constexpr auto fits(From val) noexcept -> bool
+        {
+            if (val < From{ 0 })
+            {
+                return is_signed<To>::value
+                    && static_cast<std::intmax_t>(val)
+                    >= static_cast<std::intmax_t>((std::numeric_limits<To>::min)());
+            }
+
+            return static_cast<std::uintmax_t>(val) <= static_cast<std::uintmax_t>((std::numeric_limits<To>::max)());
+        }
+
+        /// True if every @p From is representable by @p To, so no scan is needed.
+        template<typename To, typename From>
+        INLINE_CONSTEXPR bool always_fits =
+            fits<To>((std::numeric_limits<From>::min)()) && fits<To>((std::numeric_limits<From>::max)());
+
+        /// Checks that every element of @p data lies within [@p lower, @p upper].
+        ///
+        /// Offsetting by @p lower maps the valid range to [0, upper - lower] in the unsigned type, so a single maximum
+        /// is tracked. The main loop keeps one accumulator per lane of a 64-byte block; its inner loop has a constant
+        /// trip count, which lets the compiler vectorize it even at -O2 (where loops needing a scalar epilogue are
+        /// left alone).
+        template<typename From>
+        NODISCARD inline auto in_range(const From* data, std::size_t size, From lower, From upper) noexcept -> bool
+        {
+            using unsigned_t = make_unsigned_t<From>;
+
+            constexpr std::size_t lanes = 64 / sizeof(From);
+            const auto base = static_cast<unsigned_t>(lower);
+            const auto width = static_cast<unsigned_t>(static_cast<unsigned_t>(upper) - base);
+
+            unsigned_t max_offsets[lanes] = {};
+
+            std::size_t idx = 0;
+            for (; idx + lanes <= size; idx += lanes)
+            {
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    const auto offset = static_cast<unsigned_t>(static_cast<unsigned_t>(data[idx + lane]) - base);
+                    max_offsets[lane] = offset > max_offsets[lane] ? offset : max_offsets[lane];
+                }
+            }
+
+            for (; idx < size; ++idx)
+            {
+                const auto offset = static_cast<unsigned_t>(static_cast<unsigned_t>(data[idx]) - base);
+                max_offsets[0] = offset > max_offsets[0] ? offset : max_offsets[0];
+            }
+
+            unsigned_t max_offset = 0;
+            for (const unsigned_t offset : max_offsets)
+            {
+                max_offset = offset > max_offset ? offset : max_offset;
+            }
+
+            return max_offset <= width;
+        }
+
+        /// Smallest (or largest) @p From that is representable by @p To.
+        template<typename To, typename From>
+        NODISCARD constexpr auto lower_bound() noexcept -> From
+        {
+            return fits<From>((std::numeric_limits<To>::min)()) ? static_cast<From>((std::numeric_limits<To>::min)())
+                                                                : (std::numeric_limits<From>::min)();
+        }
+
+        template<typename To, typename From>
+        NODISCARD constexpr auto upper_bound() noexcept -> From
+        {
+            return fits<From>((std::numeric_limits<To>::max)()) ? static_cast<From>((std::numeric_limits<To>::max)())
+                                                                : (std::numeric_limits<From>::max)();
+        }
+    } //namespace range
+} // namespace detail
+
+/// @brief Read-only view of an array of @p From whose elements have been proven to fit in @p To.
+///
+/// Elements are returned as @p To with a plain static_cast: the range check was done once by range_cast, so indexing
+/// through the view keeps the guarantees of CHECK_CASTS without a check per access. The underlying array must not be
+/// modified while the view is in use.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam From The integral type the elements are stored as.
+template<typename To, typename From>
+class range_view
+{
+public:
+    using value_type = To;
+    using size_type = std::size_t;
+
+    /// @brief Iterator returning the elements as @p To.
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = To;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const To*;
+        using reference = To;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(const From* pos) noexcept : m_pos(pos) {}
+
+        NODISCARD constexpr auto operator*() const noexcept -> To { return static_cast<To>(*m_pos); }
+
+        constexpr auto operator++() noexcept -> iterator&
+        {
+            ++m_pos;
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> iterator
+        {
+            const iterator prev = *this;
+            ++m_pos;
+            return prev;
+        }
+
+        NODISCARD constexpr auto operator==(const iterator& other) const noexcept -> bool
+        {
+            return m_pos == other.m_pos;
+        }
+
+        NODISCARD constexpr auto operator!=(const iterator& other) const noexcept -> bool
+        {
+            return m_pos != other.m_pos;
+        }
+
+    private:
+        const From* m_pos = nullptr;
+    };
+
+    constexpr range_view() noexcept = default;
+
+    NODISCARD constexpr auto data() const noexcept -> const From* { return m_data; }
+    NODISCARD constexpr auto size() const noexcept -> std::size_t { return m_size; }
+    NODISCARD constexpr auto empty() const noexcept -> bool { return m_size == 0; }
+
+    NODISCARD constexpr auto begin() const noexcept -> iterator { return iterator(m_data); }
+    NODISCARD constexpr auto end() const noexcept -> iterator { return iterator(m_data + m_size); }
+
+    NODISCARD constexpr auto operator[](std::size_t idx) const noexcept -> To { return static_cast<To>(m_data[idx]); }
+
+private:
+    // Only range_cast creates non-empty views, after its check (or at the caller's request, for the unchecked one)
+    template<typename Target, typename Source>
+    friend constexpr auto range_cast_unchecked(const Source* data, std::size_t size) noexcept
+        -> range_view<Target, Source>;
+
+    template<typename Target, typename Source>
+    friend auto range_cast_checked(const Source* data, std::size_t size) -> range_view<Target, Source>;
+
+    constexpr range_view(const From* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+    const From* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+/// @brief Type trait to determine if an array of @p From can be validated as a range of @p To via range_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - @p To and @p From must be integral types, at most as large as std::intmax_t. (cannot be bool)
+/// - @p To and @p From must not be enums.
+///
+/// Unlike narrow_cast and sign_cast, the sign and size may both change (ex. `std::size_t` indices to `int32_t`).
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam From The integral type the elements are stored as.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_range_castable :
+    std::integral_constant<bool,
+        (detail::are_both_int<To, From> && !std::is_same<To, bool>::value && !std::is_same<From, bool>::value
+            && sizeof(To) <= sizeof(std::intmax_t) && sizeof(From) <= sizeof(std::intmax_t))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_range_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_range_castable_v = is_range_castable<To, From>::value;
+
+/// @brief Views an array of integers as @p To without performing runtime checks.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam From The integral type the elements are stored as.
+/// @param data Pointer to the first of @p size elements.
+/// @param size The number of elements.
+/// @return A view returning the elements as @p To.
+template<typename To, typename From>
+NODISCARD constexpr auto range_cast_unchecked(const From* data, std::size_t size) noexcept -> range_view<To, From>
+{
+    static_assert(is_range_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    return range_view<To, From>(data, size);
+}
+
+/// @brief Views an array of integers as @p To after checking that every element fits.
+///
+/// The check is a single (vectorized) min/max scan, hoisted out of the loops that later read the elements. It is
+/// skipped entirely if every @p From fits in @p To.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam From The integral type the elements are stored as.
+/// @param data Pointer to the first of @p size elements.
+/// @param size The number of elements.
+/// @return A view returning the elements as @p To.
+/// @exception narrow_cast_error Thrown if any element exceeds the range of @p To.
+template<typename To, typename From>
+NODISCARD inline auto range_cast_checked(const From* data, std::size_t size) -> range_view<To, From>
+{
+    static_assert(is_range_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    const bool valid = detail::range::always_fits<To, From>
+        || detail::range::in_range(
+            data, size, detail::range::lower_bound<To, From>(), detail::range::upper_bound<To, From>());
+
+    if (UNLIKELY(!valid))
+    {
+        detail::throw_cast_error<narrow_cast_error>(
+            "range_cast failed: an element exceeded the range of the output type");
+    }
+
+    return range_view<To, From>(data, size);
+}
+
+/// @brief Views an array of integers as @p To. Based on configuration this will call range_cast_checked.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam From The integral type the elements are stored as.
+/// @param data Pointer to the first of @p size elements.
+/// @param size The number of elements.
+/// @return A view returning the elements as @p To.
+/// @exception narrow_cast_error Thrown if any element exceeds the range of @p To.
+template<typename To, typename From>
+NODISCARD inline auto range_cast(const From* data, std::size_t size)
+    -> std::enable_if_t<CHECK_CASTS, range_view<To, From>>
+{
+    return range_cast_checked<To>(data, size);
+}
+
+/// @brief Views an array of integers as @p To. Based on configuration this will call range_cast_unchecked.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam From The integral type the elements are stored as.
+/// @param data Pointer to the first of @p size elements.
+/// @param size The number of elements.
+/// @return A view returning the elements as @p To.
+template<typename To, typename From>
+NODISCARD constexpr auto range_cast(const From* data, std::size_t size) noexcept
+    -> std::enable_if_t<!CHECK_CASTS, range_view<To, From>>
+{
+    return range_cast_unchecked<To>(data, size);
+}
+
+/// @brief Views a span of integers as @p To without performing runtime checks.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam Element The element type of the span (the integral type the elements are stored as, const or not).
+/// @param elements The elements to view.
+/// @return A view returning the elements as @p To.
+template<typename To, typename Element>
+NODISCARD constexpr auto range_cast_unchecked(span<Element> elements) noexcept
+    -> range_view<To, std::remove_const_t<Element>>
+{
+    return range_cast_unchecked<To>(elements.data(), elements.size());
+}
+
+/// @brief Views a span of integers as @p To after checking that every element fits.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam Element The element type of the span (the integral type the elements are stored as, const or not).
+/// @param elements The elements to view.
+/// @return A view returning the elements as @p To.
+/// @exception narrow_cast_error Thrown if any element exceeds the range of @p To.
+template<typename To, typename Element>
+NODISCARD inline auto range_cast_checked(span<Element> elements) -> range_view<To, std::remove_const_t<Element>>
+{
+    return range_cast_checked<To>(elements.data(), elements.size());
+}
+
+/// @brief Views a span of integers as @p To. Based on configuration this will call range_cast_checked.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam Element The element type of the span (the integral type the elements are stored as, const or not).
+/// @param elements The elements to view.
+/// @return A view returning the elements as @p To.
+/// @exception narrow_cast_error Thrown if any element exceeds the range of @p To.
+template<typename To, typename Element>
+NODISCARD inline auto range_cast(span<Element> elements)
+    -> std::enable_if_t<CHECK_CASTS, range_view<To, std::remove_const_t<Element>>>
+{
+    return range_cast_checked<To>(elements.data(), elements.size());
+}
+
+/// @brief Views a span of integers as @p To. Based on configuration this will call range_cast_unchecked.
+///
+/// @tparam To The integral type the elements are read as.
+/// @tparam Element The element type of the span (the integral type the elements are stored as, const or not).
+/// @param elements The elements to view.
+/// @return A view returning the elements as @p To.
+template<typename To, typename Element>
+NODISCARD constexpr auto range_cast(span<Element> elements) noexcept
+    -> std::enable_if_t<!CHECK_CASTS, range_view<To, std::remove_const_t<Element>>>
+{
+    return range_cast_unchecked<To>(elements.data(), elements.size());
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_RANGE_CAST_HPP
@@ -0,0 +1,255 @@
+///@file span_cast.hpp
+///@author Jackson Harmer
+///@brief Casts from byte buffers to typed, non-owning views with alignment and size checks.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_SPAN_CAST_HPP
+#define BETTER_CASTS_SPAN_CAST_HPP
+
+#include "../better_casts.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace casts
+{
+/// @brief Error thrown when a span_cast fails.
+class span_cast_error final : public cast_error
+{
+public:
+    using cast_error::cast_error;
+};
+
+/// @brief Minimal non-owning view over a contiguous sequence of @p T (a C++14 stand-in for `std::span<T>`).
+///
+/// @tparam T The element type (may be const).
+template<typename T>
+class span
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+    template<std::size_t N>
+    constexpr span(T (&arr)[N]) noexcept : m_data(arr), m_size(N) // NOLINT(google-explicit-constructor)
+    {
+    }
+
+    /// Allows span<T> to convert to span<const T>.
+    template<typename U, std::enable_if_t<std::is_same<const U, T>::value, bool> = true>
+    constexpr span(span<U> other) noexcept : m_data(other.data()), m_size(other.size()) // NOLINT
+    {
+    }
+
+    NODISCARD constexpr auto data() const noexcept -> T* { return m_data; }
+    NODISCARD constexpr auto size() const noexcept -> std::size_t { return m_size; }
+    NODISCARD constexpr auto size_bytes() const noexcept -> std::size_t { return m_size * sizeof(T); }
+    NODISCARD constexpr auto empty() const noexcept -> bool { return m_size == 0; }
+
+    NODISCARD constexpr auto begin() const noexcept -> T* { return m_data; }
+    NODISCARD constexpr auto end() const noexcept -> T* { return m_data + m_size; }
+
+    NODISCARD constexpr auto operator[](std::size_t idx) const noexcept -> T& { return m_data[idx]; }
+
+private:
+    T* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+namespace detail
+{
+    namespace span
+    {
+        template<typename T>
+        struct is_byte : std::integral_constant<bool,
+                             std::is_same<std::remove_cv_t<T>, char>::value
+                                 || std::is_same<std::remove_cv_t<T>, unsigned char>::value
+                                 || std::is_void<T>::value
+#ifdef __cpp_lib_byte
+                                 || std::is_same<std::remove_cv_t<T>, std::byte>::value
+#endif
+                             >
+        {
+        };
+
+        template<typename T>
+        using void_like = std::conditional_t<std::is_const<T>::value, const void, void>;
+
+        template<typename To, typename Byte>
+        NODISCARD constexpr auto view(Byte* data, std::size_t size_bytes) noexcept -> casts::span<To>
+        {
+            void_like<Byte>* raw = data;
+            return casts::span<To>(void_cast<To*>(raw), size_bytes / sizeof(To));
+        }
+    } //namespace span
+} // namespace detail
+
+/// @brief Type trait to determine if a buffer of @p Byte can be viewed as a span of @p To via span_cast.
+///
+/// In order to be castable, the following conditions must be met:
+/// - @p Byte must be char, unsigned char, std::byte or void.
+/// - @p To must be trivially copyable and not a reference.
+/// - @p To must be const if @p Byte is const.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename Byte>
+struct is_span_castable :
+    std::integral_constant<bool,
+        (detail::span::is_byte<Byte>::value && std::is_trivially_copyable<std::remove_cv_t<To>>::value
+            && !std::is_reference<To>::value && !std::is_void<To>::value
+            && (std::is_const<To>::value || !std::is_const<Byte>::value))>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_span_castable.
+template<typename To, typename Byte>
+INLINE_CONSTEXPR bool is_span_castable_v = is_span_castable<To, Byte>::value;
+
+/// @brief Views a byte buffer as a span of @p To without performing runtime checks.
+///
+/// Any trailing bytes that do not form a whole @p To are not part of the span.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param data Pointer to the start of the buffer.
+/// @param size_bytes The size of the buffer in bytes.
+/// @return The typed view over the buffer.
+template<typename To, typename Byte>
+NODISCARD constexpr auto span_cast_unchecked(Byte* data, std::size_t size_bytes) noexcept -> span<To>
+{
+    static_assert(is_span_castable_v<To, Byte>, "A buffer of `Byte` cannot be viewed as a span of `To`");
+
+    return detail::span::view<To>(data, size_bytes);
+}
+
+/// @brief Views a byte buffer as a span of @p To with runtime checks.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param data Pointer to the start of the buffer.
+/// @param size_bytes The size of the buffer in bytes.
+/// @return The typed view over the buffer.
+/// @exception span_cast_error Thrown if the buffer is null but not empty, is not aligned for @p To or its size is
+/// not a multiple of `sizeof(To)`.
+template<typename To, typename Byte>
+NODISCARD inline auto span_cast_checked(Byte* data, std::size_t size_bytes) -> span<To>
+{
+    static_assert(is_span_castable_v<To, Byte>, "A buffer of `Byte` cannot be viewed as a span of `To`");
+
+    if (UNLIKELY(data == nullptr && size_bytes != 0))
+    {
+        detail::throw_cast_error<span_cast_error>("span_cast failed: buffer is null");
+    }
+
+    if (UNLIKELY(reinterpret_cast<std::uintptr_t>(data) % alignof(To) != 0))
+    {
+        detail::throw_cast_error<span_cast_error>("span_cast failed: buffer is not aligned for the output type");
+    }
+
+    if (UNLIKELY(size_bytes % sizeof(To) != 0))
+    {
+        detail::throw_cast_error<span_cast_error>(
+            "span_cast failed: buffer size is not a multiple of the output type's size");
+    }
+
+    return detail::span::view<To>(data, size_bytes);
+}
+
+/// @brief Views a byte buffer as a span of @p To. Based on configuration this will call span_cast_checked.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param data Pointer to the start of the buffer.
+/// @param size_bytes The size of the buffer in bytes.
+/// @return The typed view over the buffer.
+/// @exception span_cast_error Thrown if the buffer is null but not empty, is not aligned for @p To or its size is
+/// not a multiple of `sizeof(To)`.
+template<typename To, typename Byte>
+NODISCARD inline auto span_cast(Byte* data, std::size_t size_bytes)
+    -> std::enable_if_t<CHECK_CASTS && is_span_castable_v<To, Byte>, span<To>>
+{
+    return span_cast_checked<To>(data, size_bytes);
+}
+
+/// @brief Views a byte buffer as a span of @p To. Based on configuration this will call span_cast_unchecked.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param data Pointer to the start of the buffer.
+/// @param size_bytes The size of the buffer in bytes.
+/// @return The typed view over the buffer.
+template<typename To, typename Byte>
+NODISCARD constexpr auto span_cast(Byte* data, std::size_t size_bytes) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_span_castable_v<To, Byte>, span<To>>
+{
+    return span_cast_unchecked<To>(data, size_bytes);
+}
+
+/// @brief Views a span of bytes as a span of @p To without performing runtime checks.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param bytes The buffer to view.
+/// @return The typed view over the buffer.
+template<typename To, typename Byte>
+NODISCARD constexpr auto span_cast_unchecked(span<Byte> bytes) noexcept -> span<To>
+{
+    return span_cast_unchecked<To>(bytes.data(), bytes.size_bytes());
+}
+
+/// @brief Views a span of bytes as a span of @p To with runtime checks.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param bytes The buffer to view.
+/// @return The typed view over the buffer.
+/// @exception span_cast_error Thrown if the buffer is not aligned for @p To or its size is not a multiple of
+/// `sizeof(To)`.
+template<typename To, typename Byte>
+NODISCARD inline auto span_cast_checked(span<Byte> bytes) -> span<To>
+{
+    return span_cast_checked<To>(bytes.data(), bytes.size_bytes());
+}
+
+/// @brief Views a span of bytes as a span of @p To. Based on configuration this will call span_cast_checked.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param bytes The buffer to view.
+/// @return The typed view over the buffer.
+/// @exception span_cast_error Thrown if the buffer is not aligned for @p To or its size is not a multiple of
+/// `sizeof(To)`.
+template<typename To, typename Byte>
+NODISCARD inline auto span_cast(span<Byte> bytes)
+    -> std::enable_if_t<CHECK_CASTS && is_span_castable_v<To, Byte>, span<To>>
+{
+    return span_cast_checked<To>(bytes.data(), bytes.size_bytes());
+}
+
+/// @brief Views a span of bytes as a span of @p To. Based on configuration this will call span_cast_unchecked.
+///
+/// @tparam To The element type of the resulting span.
+/// @tparam Byte The byte type of the buffer.
+/// @param bytes The buffer to view.
+/// @return The typed view over the buffer.
+template<typename To, typename Byte>
+NODISCARD constexpr auto span_cast(span<Byte> bytes) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_span_castable_v<To, Byte>, span<To>>
+{
+    return span_cast_unchecked<To>(bytes.data(), bytes.size_bytes());
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_SPAN_CAST_HPP
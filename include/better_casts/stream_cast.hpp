@@ -0,0 +1,364 @@
+///@file stream_cast.hpp
+///@author Jackson Harmer
+///@brief Push-based converter casting a stream of values delivered in chunks of arbitrary size.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_STREAM_CAST_HPP
+#define BETTER_CASTS_STREAM_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/family.hpp"
+#include "nullable_cast.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace casts
+{
+/// @brief Cast families a stream_converter can apply (used as its @p Family template argument).
+namespace stream_family
+{
+    /// @brief Integers to a smaller integer of the same sign (see narrow_cast).
+    struct narrow_cast
+    {
+    };
+
+    /// @brief Integers to an integer of the other sign (see sign_cast).
+    struct sign_cast
+    {
+    };
+
+    /// @brief Floating point values to integers, rounded by the float_cast operation (see float_cast).
+    struct float_cast
+    {
+    };
+} //namespace stream_family
+
+/// @brief What a stream_converter does with values that cannot be cast (used as its @p Policy template argument).
+namespace stream_policy
+{
+    /// @brief Throw the error of the cast family, reporting the offset of the value in the stream.
+    struct fail
+    {
+    };
+
+    /// @brief Store zero.
+    struct zero
+    {
+    };
+
+    /// @brief Store the closest value of the output type (zero for NaN).
+    struct saturate
+    {
+    };
+} //namespace stream_policy
+
+/// @brief Default number of elements in each of the two output buffers of a stream_converter.
+INLINE_CONSTEXPR std::size_t stream_buffer_capacity = 16384;
+
+namespace detail
+{
+    namespace stream
+    {
+        /// Elements carried across chunk boundaries: a multiple of every vector kernel width and of the 8 lanes of a
+        /// validity byte, so the kernels only see whole blocks until the stream ends.
+        constexpr std::size_t block = 64;
+
+        template<typename To, typename From, typename Family>
+        struct family_traits;
+
+        template<typename To, typename From>
+        struct family_traits<To, From, stream_family::narrow_cast>
+        {
+            static_assert(is_narrow_castable_v<To, From> && is_integer<From>::value,
+                "`From` does not meet the requirements to be casted to a `To`");
+
+            using error = narrow_cast_error;
+            static constexpr const char* name = "narrow_cast";
+
+            template<typename Op>
+            static auto convert(const From* input, std::size_t count, To* output, std::uint8_t* validity,
+                Op /*tag*/) noexcept -> std::size_t
+            {
+                return nullable::cast_to_bitmap(input, count, output, validity, math::float_op_truncate{},
+                    [](From val, To& result) { return nullable::narrow(val, result); });
+            }
+        };
+
+        template<typename To, typename From>
+        struct family_traits<To, From, stream_family::sign_cast>
+        {
+            static_assert(is_sign_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+            using error = sign_cast_error;
+            static constexpr const char* name = "sign_cast";
+
+            template<typename Op>
+            static auto convert(const From* input, std::size_t count, To* output, std::uint8_t* validity,
+                Op /*tag*/) noexcept -> std::size_t
+            {
+                return count
+                    - nullable::to_bitmap(input, 0, count, output, validity,
+                        [](From val, To& result)
+                        {
+                            const bool valid =
+                                family::try_convert(val, result, family::kind_tag<family::kind::sign>{});
+                            result = valid ? result : To{ 0 };
+                            return valid;
+                        });
+            }
+        };
+
+        template<typename To, typename From>
+        struct family_traits<To, From, stream_family::float_cast>
+        {
+            static_assert(
+                is_float_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+            using error = float_cast_error;
+            static constexpr const char* name = "float_cast";
+
+            template<typename Op>
+            static auto convert(const From* input, std::size_t count, To* output, std::uint8_t* validity,
+                Op tag) noexcept -> std::size_t
+            {
+                return nullable::cast_to_bitmap(input, count, output, validity, tag,
+                    [tag](From val, To& result) { return nullable::round(val, tag, result); });
+            }
+        };
+
+        template<typename To, typename From, typename Family>
+        NORETURN COLD inline void throw_stream_error(std::uint64_t element)
+        {
+            using traits = family_traits<To, From, Family>;
+
+            throw_cast_error<typename traits::error>((std::string(traits::name) + " failed: input at stream element "
+                + std::to_string(element) + " (byte offset " + std::to_string(element * sizeof(From))
+                + ") could not be represented by the output type")
+                    .c_str());
+        }
+
+        /// Replaces the null elements of a converted span, @p first being the stream offset of @p input.
+        template<typename To, typename From, typename Family>
+        inline void apply_policy(const From* /*input*/, std::size_t count, To* /*output*/,
+            const std::uint8_t* validity, std::uint64_t first, stream_policy::fail /*tag*/)
+        {
+            std::size_t idx = 0;
+
+            while (idx < count && is_valid(validity, idx))
+            {
+                ++idx;
+            }
+
+            throw_stream_error<To, From, Family>(first + idx);
+        }
+
+        template<typename To, typename From, typename Family>
+        inline void apply_policy(const From* /*input*/, std::size_t /*count*/, To* /*output*/,
+            const std::uint8_t* /*validity*/, std::uint64_t /*first*/, stream_policy::zero /*tag*/) noexcept
+        {
+            // Null elements are already stored as zero
+        }
+
+        template<typename To, typename From, typename Family>
+        inline void apply_policy(const From* input, std::size_t count, To* output, const std::uint8_t* validity,
+            std::uint64_t /*first*/, stream_policy::saturate /*tag*/) noexcept
+        {
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                // NaN is neither below nor above zero, and stays zero
+                if (!is_valid(validity, idx) && (input[idx] < From{ 0 } || input[idx] > From{ 0 }))
+                {
+                    output[idx] =
+                        input[idx] < From{ 0 } ? (std::numeric_limits<To>::min)() : (std::numeric_limits<To>::max)();
+                }
+            }
+        }
+    } //namespace stream
+} // namespace detail
+
+/// @brief Casts a stream of @p From values that arrives in chunks of arbitrary size (ex. from a socket or a
+/// decompressor), handing the casted values to a sink in large buffers.
+///
+/// Chunks are raw bytes, so a chunk may end in the middle of a value; partial values and the tail that does not fill
+/// a whole SIMD block are carried over to the next chunk, and everything else is converted in place by the batch
+/// kernels of nullable_cast.hpp. Values that cannot be cast are handled by @p Policy; errors report the offset of the
+/// value from the start of the stream.
+///
+/// Output is double-buffered: the sink receives one of two buffers, and the converter fills the other one before it
+/// reuses the first. A sink that starts an asynchronous write may therefore let it run until its next invocation, so
+/// conversion overlaps with the I/O.
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @tparam Family The cast family (a type from casts::stream_family).
+/// @tparam Policy The handling of values that cannot be cast (a type from casts::stream_policy).
+/// @tparam Op The float_cast operation used for rounding (only used by stream_family::float_cast).
+template<typename To, typename From, typename Family, typename Policy = stream_policy::fail,
+    typename Op = detail::math::float_op_default>
+class stream_converter
+{
+    using traits = detail::stream::family_traits<To, From, Family>;
+
+public:
+    using sink_type = std::function<void(const To*, std::size_t)>;
+
+    /// @param sink Called with each full output buffer (and the last, partial one).
+    /// @param float_op The operation to perform (uses the default operation if not specified).
+    /// @param capacity The number of elements in each output buffer (rounded up to a whole block).
+    explicit stream_converter(sink_type sink, Op float_op = Op{}, std::size_t capacity = stream_buffer_capacity) :
+        m_sink(std::move(sink)), m_op(float_op), m_capacity(round_capacity(capacity)),
+        m_buffers{ std::vector<To>(m_capacity), std::vector<To>(m_capacity) },
+        m_validity(validity_bitmap_size(m_capacity))
+    {
+    }
+
+    /// @brief Converts the values completed by the next @p size bytes of the stream.
+    /// @exception cast_error The error of the cast family, if a value cannot be cast and @p Policy is
+    /// stream_policy::fail (or thrown by the sink). The converter must not be used afterwards.
+    void push(const void* data, std::size_t size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+
+        const auto* bytes = static_cast<const unsigned char*>(data);
+
+        if (m_staged_bytes != 0)
+        {
+            const std::size_t taken = (std::min)(size, sizeof(m_staged) - m_staged_bytes);
+
+            std::memcpy(m_staged + m_staged_bytes, bytes, taken);
+            m_staged_bytes += taken;
+            bytes += taken;
+            size -= taken;
+
+            if (m_staged_bytes < sizeof(m_staged))
+            {
+                return;
+            }
+
+            convert(staged(), detail::stream::block);
+            m_staged_bytes = 0;
+        }
+
+        if (reinterpret_cast<std::uintptr_t>(bytes) % alignof(From) == 0)
+        {
+            const std::size_t whole = size / sizeof(m_staged) * sizeof(m_staged);
+
+            convert(reinterpret_cast<const From*>(bytes), whole / sizeof(From));
+            bytes += whole;
+            size -= whole;
+        }
+        else
+        {
+            // Misaligned chunks are converted through the staging block
+            for (; size >= sizeof(m_staged); bytes += sizeof(m_staged), size -= sizeof(m_staged))
+            {
+                std::memcpy(m_staged, bytes, sizeof(m_staged));
+                convert(staged(), detail::stream::block);
+            }
+        }
+
+        std::memcpy(m_staged, bytes, size);
+        m_staged_bytes = size;
+    }
+
+    /// @brief Converts the next @p count values of the stream.
+    void push(const From* values, std::size_t count) { push(static_cast<const void*>(values), count * sizeof(From)); }
+
+    /// @brief Hands the values converted so far to the sink (values carried over to the next chunk are kept).
+    void flush()
+    {
+        if (m_filled != 0)
+        {
+            m_sink(m_buffers[m_current].data(), m_filled);
+            m_current ^= 1U;
+            m_filled = 0;
+        }
+    }
+
+    /// @brief Converts the carried-over values and flushes, ending the stream.
+    /// @exception cast_error Thrown if the stream ends in the middle of a value, or as for push().
+    void finish()
+    {
+        if (m_staged_bytes % sizeof(From) != 0)
+        {
+            detail::throw_cast_error<cast_error>(("stream ended inside the value at byte offset "
+                + std::to_string(m_converted * sizeof(From) + m_staged_bytes / sizeof(From) * sizeof(From)))
+                    .c_str());
+        }
+
+        convert(staged(), m_staged_bytes / sizeof(From));
+        m_staged_bytes = 0;
+        flush();
+    }
+
+    /// @brief The number of values converted so far (the stream offset of the next value, in elements).
+    NODISCARD auto converted() const noexcept -> std::uint64_t { return m_converted; }
+
+    /// @brief The number of values replaced by @p Policy so far.
+    NODISCARD auto replaced() const noexcept -> std::uint64_t { return m_replaced; }
+
+private:
+    static constexpr auto round_capacity(std::size_t capacity) noexcept -> std::size_t
+    {
+        return capacity <= detail::stream::block
+            ? detail::stream::block
+            : (capacity + detail::stream::block - 1) / detail::stream::block * detail::stream::block;
+    }
+
+    auto staged() const noexcept -> const From* { return reinterpret_cast<const From*>(m_staged); }
+
+    void convert(const From* input, std::size_t count)
+    {
+        while (count != 0)
+        {
+            if (m_filled == m_capacity)
+            {
+                flush();
+            }
+
+            const std::size_t size = (std::min)(count, m_capacity - m_filled);
+            To* output = m_buffers[m_current].data() + m_filled;
+
+            const std::size_t nulls = traits::convert(input, size, output, m_validity.data(), m_op);
+            if (nulls != 0)
+            {
+                detail::stream::apply_policy<To, From, Family>(
+                    input, size, output, m_validity.data(), m_converted, Policy{});
+                m_replaced += nulls;
+            }
+
+            m_filled += size;
+            m_converted += size;
+            input += size;
+            count -= size;
+        }
+    }
+
+    sink_type m_sink;
+    Op m_op;
+    std::size_t m_capacity;
+    std::vector<To> m_buffers[2];
+    std::vector<std::uint8_t> m_validity;
+    unsigned m_current = 0;
+    std::size_t m_filled = 0;
+    alignas(From) unsigned char m_staged[detail::stream::block * sizeof(From)] = {};
+    std::size_t m_staged_bytes = 0;
+    std::uint64_t m_converted = 0;
+    std::uint64_t m_replaced = 0;
+};
+} // namespace casts
+
+#endif // BETTER_CASTS_STREAM_CAST_HPP
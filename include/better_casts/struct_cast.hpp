@@ -0,0 +1,712 @@
+///@file struct_cast.hpp
+///@author Jackson Harmer
+///@brief Field-wise casts between records (ex. wide in-memory records and packed wire records), one record or a batch.
+///@version 0.1.0
+///
+
+#ifndef BETTER_CASTS_STRUCT_CAST_HPP
+#define BETTER_CASTS_STRUCT_CAST_HPP
+
+#include "../better_casts.hpp"
+#include "detail/family.hpp"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_structured_bindings) && __cpp_structured_bindings >= 201606L
+/// Defined when aggregates can be used as records without a struct_fields specialization (C++17 and later).
+#  define HAS_AGGREGATE_RECORDS 1
+#endif
+
+namespace casts
+{
+/// @brief Declares the fields of the record @p T for struct_cast, in order.
+///
+/// Specializations provide a `static constexpr auto members() noexcept` returning a `std::tuple` of pointers to the
+/// data members of @p T (ex. `std::make_tuple(&wide::id, &wide::value)`). This is required before C++17, and for
+/// records that are not aggregates (ex. classes with constructors). A specialization takes priority over the
+/// automatic reflection of aggregates, so it can also reorder or skip fields.
+///
+/// @tparam T The record type.
+template<typename T>
+struct struct_fields
+{
+};
+
+namespace detail
+{
+    namespace record
+    {
+        template<typename T, typename = void>
+        struct has_field_map : std::false_type
+        {
+        };
+
+        template<typename T>
+        struct has_field_map<T, decltype(static_cast<void>(struct_fields<T>::members()))> : std::true_type
+        {
+        };
+
+        template<std::size_t Count>
+        using size_tag = std::integral_constant<std::size_t, Count>;
+
+        template<typename T, typename Members, std::size_t... Idx>
+        NODISCARD constexpr auto tie_members(
+            T& obj, const Members& members, std::index_sequence<Idx...> /*idx*/) noexcept
+        {
+            return std::tie((obj.*std::get<Idx>(members))...);
+        }
+
+        template<typename T, std::enable_if_t<has_field_map<std::remove_const_t<T>>::value, bool> = true>
+        NODISCARD constexpr auto fields(T& obj) noexcept
+        {
+            constexpr auto members = struct_fields<std::remove_const_t<T>>::members();
+
+            return tie_members(obj, members, std::make_index_sequence<std::tuple_size<decltype(members)>::value>{});
+        }
+
+#ifdef HAS_AGGREGATE_RECORDS
+        /// Converts to any field type, so the number of fields of an aggregate is the largest number of these it can
+        /// be brace initialized from.
+        struct any_field
+        {
+            template<typename T>
+            constexpr operator T() const noexcept; // NOLINT(google-explicit-constructor)
+        };
+
+        template<typename T, typename Seq, typename = void>
+        struct is_brace_constructible : std::false_type
+        {
+        };
+
+        template<typename T, std::size_t... Idx>
+        struct is_brace_constructible<T, std::index_sequence<Idx...>,
+            decltype(static_cast<void>(T{ (static_cast<void>(Idx), any_field{})... }))> : std::true_type
+        {
+        };
+
+        /// The largest number of fields supported by the automatic reflection of aggregates.
+        INLINE_CONSTEXPR std::size_t max_aggregate_fields = 16;
+
+        template<typename T, std::size_t Count = max_aggregate_fields>
+        struct aggregate_size :
+            std::conditional_t<is_brace_constructible<T, std::make_index_sequence<Count>>::value, size_tag<Count>,
+                aggregate_size<T, Count - 1>>
+        {
+        };
+
+        template<typename T>
+        struct aggregate_size<T, 0> : size_tag<0>
+        {
+        };
+
+        template<typename T>
+        INLINE_CONSTEXPR bool is_aggregate_record = std::is_aggregate_v<T> && std::is_class_v<T>
+            && !std::is_union_v<T> && !has_field_map<T>::value;
+
+        // Structured bindings need the number of names up front, so there is one overload per field count
+
+#  define BETTER_CASTS_TIE_AGGREGATE(Count, ...)                                                                       \
+      template<typename T>                                                                                             \
+      NODISCARD constexpr auto tie_aggregate(T& obj, size_tag<Count> /*count*/) noexcept                               \
+      {                                                                                                                \
+          auto& [__VA_ARGS__] = obj;                                                                                   \
+          return std::tie(__VA_ARGS__);                                                                                \
+      }
+
+        BETTER_CASTS_TIE_AGGREGATE(1, f0)
+        BETTER_CASTS_TIE_AGGREGATE(2, f0, f1)
+        BETTER_CASTS_TIE_AGGREGATE(3, f0, f1, f2)
+        BETTER_CASTS_TIE_AGGREGATE(4, f0, f1, f2, f3)
+        BETTER_CASTS_TIE_AGGREGATE(5, f0, f1, f2, f3, f4)
+        BETTER_CASTS_TIE_AGGREGATE(6, f0, f1, f2, f3, f4, f5)
+        BETTER_CASTS_TIE_AGGREGATE(7, f0, f1, f2, f3, f4, f5, f6)
+        BETTER_CASTS_TIE_AGGREGATE(8, f0, f1, f2, f3, f4, f5, f6, f7)
+        BETTER_CASTS_TIE_AGGREGATE(9, f0, f1, f2, f3, f4, f5, f6, f7, f8)
+        BETTER_CASTS_TIE_AGGREGATE(10, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9)
+        BETTER_CASTS_TIE_AGGREGATE(11, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10)
+        BETTER_CASTS_TIE_AGGREGATE(12, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11)
+        BETTER_CASTS_TIE_AGGREGATE(13, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12)
+        BETTER_CASTS_TIE_AGGREGATE(14, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13)
+        BETTER_CASTS_TIE_AGGREGATE(15, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14)
+        BETTER_CASTS_TIE_AGGREGATE(16, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15)
+
+#  undef BETTER_CASTS_TIE_AGGREGATE
+
+        template<typename T, std::enable_if_t<is_aggregate_record<std::remove_const_t<T>>, bool> = true>
+        NODISCARD constexpr auto fields(T& obj) noexcept
+        {
+            return tie_aggregate(obj, aggregate_size<std::remove_const_t<T>>{});
+        }
+#endif
+
+        /// Checks if @p T is a record: a type with a struct_fields specialization, or (from C++17) an aggregate class.
+        template<typename T>
+        struct is_record :
+            std::integral_constant<bool,
+                has_field_map<std::remove_const_t<T>>::value
+#ifdef HAS_AGGREGATE_RECORDS
+                    || is_aggregate_record<std::remove_const_t<T>>
+#endif
+                >
+        {
+        };
+
+        /// A reference to field @p Idx of the record @p obj.
+        template<std::size_t Idx, typename T>
+        NODISCARD constexpr auto field(T& obj) noexcept -> decltype(std::get<Idx>(fields(obj)))
+        {
+            return std::get<Idx>(fields(obj));
+        }
+
+        template<typename T>
+        struct field_count : std::tuple_size<decltype(fields(std::declval<T&>()))>
+        {
+        };
+
+        template<typename T, std::size_t Idx>
+        using field_t = std::remove_reference_t<decltype(field<Idx>(std::declval<T&>()))>;
+
+        /// Fields that are records on both sides are converted field by field in turn.
+        template<typename To, typename From>
+        using both_records = std::integral_constant<bool, is_record<To>::value && is_record<From>::value>;
+
+        template<bool... Values>
+        using all_of = std::is_same<std::integer_sequence<bool, true, Values...>,
+            std::integer_sequence<bool, Values..., true>>;
+
+        template<typename To, typename From>
+        struct is_castable;
+
+        template<typename To, typename From, typename Seq>
+        struct fields_castable;
+
+        template<typename To, typename From, std::size_t... Idx>
+        struct fields_castable<To, From, std::index_sequence<Idx...>> :
+            all_of<is_castable<field_t<To, Idx>, field_t<From, Idx>>::value...>
+        {
+        };
+
+        template<typename To, typename From, bool Records = both_records<To, From>::value>
+        struct is_castable_impl : family::is_convertible<To, From>
+        {
+        };
+
+        // Fields are only compared when the counts match, as there is no field to pair with the extra ones
+        template<typename To, typename From>
+        struct is_castable_impl<To, From, true> :
+            std::conditional_t<field_count<To>::value == field_count<From>::value,
+                fields_castable<To, From, std::make_index_sequence<field_count<From>::value>>, std::false_type>
+        {
+        };
+
+        template<typename To, typename From>
+        struct is_castable : is_castable_impl<std::remove_const_t<To>, std::remove_const_t<From>>
+        {
+        };
+
+        // The overloads for records are declared up front, as the field loops of nested records call them
+
+        template<bool Checked, typename To, typename From>
+        constexpr void assign(To& to_val, const From& from_val, std::true_type /*records*/) noexcept(!Checked);
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_assign(To& to_val, const From& from_val, std::true_type /*records*/) -> bool;
+
+        template<typename To, typename From>
+        void check_field(To& to_val, const From& from_val, std::size_t index, const std::string& name,
+            std::true_type /*records*/);
+
+        template<bool Checked, typename To, typename From>
+        constexpr void assign(To& to_val, const From& from_val, std::false_type /*records*/) noexcept(!Checked)
+        {
+            to_val = family::convert<Checked, To>(from_val);
+        }
+
+        template<bool Checked, typename To, typename From, std::size_t... Idx>
+        constexpr void assign_fields(To& to_val, const From& from_val, std::index_sequence<Idx...> /*idx*/) noexcept(
+            !Checked)
+        {
+            // Expanded into an array, as C++14 has no fold expressions
+            const int expand[] = { 0,
+                (assign<Checked>(field<Idx>(to_val), field<Idx>(from_val),
+                     both_records<field_t<To, Idx>, field_t<From, Idx>>{}),
+                    0)... };
+            static_cast<void>(expand);
+        }
+
+        template<bool Checked, typename To, typename From>
+        constexpr void assign(To& to_val, const From& from_val, std::true_type /*records*/) noexcept(!Checked)
+        {
+            assign_fields<Checked>(to_val, from_val, std::make_index_sequence<field_count<From>::value>{});
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_assign(To& to_val, const From& from_val, std::false_type /*records*/) -> bool
+        {
+            return family::try_convert(from_val, to_val);
+        }
+
+        template<typename To, typename From, std::size_t... Idx>
+        NODISCARD FORCE_INLINE auto try_assign_fields(
+            To& to_val, const From& from_val, std::index_sequence<Idx...> /*idx*/) -> bool
+        {
+            bool valid = true;
+            const int expand[] = { 0,
+                (valid &= try_assign(field<Idx>(to_val), field<Idx>(from_val),
+                     both_records<field_t<To, Idx>, field_t<From, Idx>>{}),
+                    0)... };
+            static_cast<void>(expand);
+
+            return valid;
+        }
+
+        template<typename To, typename From>
+        NODISCARD FORCE_INLINE auto try_assign(To& to_val, const From& from_val, std::true_type /*records*/) -> bool
+        {
+            return try_assign_fields(to_val, from_val, std::make_index_sequence<field_count<From>::value>{});
+        }
+
+        template<typename To, typename From>
+        using field_error_t = std::conditional_t<family::kind_of<To, From> == family::kind::narrow, narrow_cast_error,
+            std::conditional_t<family::kind_of<To, From> == family::kind::sign, sign_cast_error,
+                std::conditional_t<family::kind_of<To, From> == family::kind::floating, float_cast_error,
+                    enum_cast_error>>>;
+
+        // The error of a batch is found by converting the records again, one field at a time, which names the first
+        // failing field (ex. "1.0" for the first field of the second field) and throws the error of its cast family.
+
+        template<typename To, typename From>
+        void check_field(To& to_val, const From& from_val, std::size_t index, const std::string& name,
+            std::false_type /*records*/)
+        {
+            if (!family::try_convert(from_val, to_val))
+            {
+                const std::string message = "struct_cast failed: field " + name + " of the record at index "
+                    + std::to_string(index) + " does not fit the output type";
+                throw_cast_error<field_error_t<To, From>>(message.c_str());
+            }
+        }
+
+        template<typename To, typename From, std::size_t... Idx>
+        void check_fields(To& to_val, const From& from_val, std::size_t index, const std::string& name,
+            std::index_sequence<Idx...> /*idx*/)
+        {
+            const std::string prefix = name.empty() ? name : name + ".";
+            const int expand[] = { 0,
+                (check_field(field<Idx>(to_val), field<Idx>(from_val), index, prefix + std::to_string(Idx),
+                     both_records<field_t<To, Idx>, field_t<From, Idx>>{}),
+                    0)... };
+            static_cast<void>(expand);
+        }
+
+        template<typename To, typename From>
+        void check_field(To& to_val, const From& from_val, std::size_t index, const std::string& name,
+            std::true_type /*records*/)
+        {
+            check_fields(to_val, from_val, index, name, std::make_index_sequence<field_count<From>::value>{});
+        }
+
+        template<typename From, typename To>
+        NORETURN COLD inline void throw_batch_error(const From* input, std::size_t count, To* output)
+        {
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                check_field(output[idx], input[idx], idx, std::string{}, std::true_type{});
+            }
+
+            // Only reached if a stochastically rounded field failed the first time but not the second
+            throw_cast_error<float_cast_error>("struct_cast failed: a field does not fit the output type");
+        }
+
+        template<typename From, typename... Columns, std::size_t... Idx>
+        NORETURN COLD inline void throw_columns_error(
+            const From* input, std::size_t count, std::index_sequence<Idx...> /*idx*/, Columns*... columns)
+        {
+            for (std::size_t row = 0; row < count; ++row)
+            {
+                const int expand[] = { 0,
+                    (check_field(columns[row], field<Idx>(input[row]), row, std::to_string(Idx),
+                         both_records<Columns, field_t<const From, Idx>>{}),
+                        0)... };
+                static_cast<void>(expand);
+            }
+
+            throw_cast_error<float_cast_error>("struct_cast failed: a field does not fit the output type");
+        }
+
+        // The batch casts convert one field of a block of records at a time: each loop is a strided load and a store
+        // with a single conversion, which compilers can vectorize, and the block is still in the L1 cache for the
+        // next field. The output of a field is either a column (Out is the column type) or the same field of the
+        // output records (Out is the output record type).
+
+        /// Records per block, so that a block of input fits comfortably in the L1 cache.
+        template<typename From>
+        INLINE_CONSTEXPR std::size_t block_rows = sizeof(From) < 8192 ? 8192 / sizeof(From) : 1;
+
+        template<std::size_t Idx, typename Out>
+        NODISCARD FORCE_INLINE constexpr auto target(Out& out, std::false_type /*field_of_record*/) noexcept -> Out&
+        {
+            return out;
+        }
+
+        template<std::size_t Idx, typename Out>
+        NODISCARD FORCE_INLINE constexpr auto target(Out& out, std::true_type /*field_of_record*/) noexcept
+            -> field_t<Out, Idx>&
+        {
+            return field<Idx>(out);
+        }
+
+        template<std::size_t Idx, bool FieldOfRecord, typename From, typename Out>
+        NODISCARD inline auto convert_field(const From* input, std::size_t count, Out* output) -> bool
+        {
+            using out_t = std::remove_reference_t<decltype(
+                target<Idx>(*output, std::integral_constant<bool, FieldOfRecord>{}))>;
+
+            // Accumulated as an integer, as compilers do not vectorize a reduction into a bool
+            unsigned valid = 1;
+
+            for (std::size_t row = 0; row < count; ++row)
+            {
+                valid &= static_cast<unsigned>(
+                    try_assign(target<Idx>(output[row], std::integral_constant<bool, FieldOfRecord>{}),
+                        field<Idx>(input[row]), both_records<out_t, field_t<const From, Idx>>{}));
+            }
+
+            return valid != 0;
+        }
+
+        template<std::size_t Idx, bool FieldOfRecord, typename From, typename Out>
+        inline void convert_field_unchecked(const From* input, std::size_t count, Out* output) noexcept
+        {
+            using out_t = std::remove_reference_t<decltype(
+                target<Idx>(*output, std::integral_constant<bool, FieldOfRecord>{}))>;
+
+            for (std::size_t row = 0; row < count; ++row)
+            {
+                assign<false>(target<Idx>(output[row], std::integral_constant<bool, FieldOfRecord>{}),
+                    field<Idx>(input[row]), both_records<out_t, field_t<const From, Idx>>{});
+            }
+        }
+
+        /// Converts the fields of the records into the @p outputs (the output records, or one column per field).
+        template<bool FieldOfRecord, typename From, typename... Outs, std::size_t... Idx>
+        NODISCARD inline auto convert_fields(
+            const From* input, std::size_t count, std::index_sequence<Idx...> /*idx*/, Outs*... outputs) -> bool
+        {
+            unsigned valid = 1;
+
+            for (std::size_t first = 0; first < count; first += block_rows<From>)
+            {
+                const std::size_t rows = count - first < block_rows<From> ? count - first : block_rows<From>;
+                const int expand[] = { 0,
+                    (valid &= static_cast<unsigned>(
+                         convert_field<Idx, FieldOfRecord>(input + first, rows, outputs + first)),
+                        0)... };
+                static_cast<void>(expand);
+            }
+
+            return valid != 0;
+        }
+
+        template<bool FieldOfRecord, typename From, typename... Outs, std::size_t... Idx>
+        inline void convert_fields_unchecked(
+            const From* input, std::size_t count, std::index_sequence<Idx...> /*idx*/, Outs*... outputs) noexcept
+        {
+            for (std::size_t first = 0; first < count; first += block_rows<From>)
+            {
+                const std::size_t rows = count - first < block_rows<From> ? count - first : block_rows<From>;
+                const int expand[] = { 0,
+                    (convert_field_unchecked<Idx, FieldOfRecord>(input + first, rows, outputs + first), 0)... };
+                static_cast<void>(expand);
+            }
+        }
+
+        template<std::size_t Idx, typename T>
+        NODISCARD constexpr auto same_for(T val) noexcept -> T
+        {
+            return val;
+        }
+
+        /// Converts the records into the @p output records, passing @p output once per field.
+        template<typename From, typename To, std::size_t... Idx>
+        NODISCARD inline auto convert_records(
+            const From* input, std::size_t count, To* output, std::index_sequence<Idx...> idx) -> bool
+        {
+            return convert_fields<true>(input, count, idx, same_for<Idx>(output)...);
+        }
+
+        template<typename From, typename To, std::size_t... Idx>
+        inline void convert_records_unchecked(
+            const From* input, std::size_t count, To* output, std::index_sequence<Idx...> idx) noexcept
+        {
+            convert_fields_unchecked<true>(input, count, idx, same_for<Idx>(output)...);
+        }
+
+        template<typename From, typename Columns, typename Seq>
+        struct columns_castable;
+
+        template<typename From, typename... Columns, std::size_t... Idx>
+        struct columns_castable<From, std::tuple<Columns...>, std::index_sequence<Idx...>> :
+            all_of<is_castable<Columns, field_t<const From, Idx>>::value...>
+        {
+        };
+
+        template<typename From, typename... Columns>
+        struct is_columns_castable_impl :
+            std::conditional_t<field_count<From>::value == sizeof...(Columns),
+                columns_castable<From, std::tuple<Columns...>, std::index_sequence_for<Columns...>>, std::false_type>
+        {
+        };
+
+        /// Checks if the fields of the record @p From can be casted to the @p Columns, in order.
+        template<typename From, typename... Columns>
+        struct is_columns_castable :
+            std::conditional_t<is_record<From>::value, is_columns_castable_impl<From, Columns...>, std::false_type>
+        {
+        };
+    } //namespace record
+} // namespace detail
+
+/// @brief Checks if a record @p From can be casted to a record @p To by struct_cast.
+///
+/// In order to be castable, both types must be records (see struct_fields) with the same number of fields, and each
+/// field of @p From must be castable to the matching field of @p To by enum_cast, narrow_cast, sign_cast or
+/// float_cast (or be a widening or identical type, ex. int16_t to int64_t or float to double, or a nested record that
+/// is castable in turn).
+///
+/// @tparam To The type to cast to.
+/// @tparam From The type to cast from.
+/// @note Typically, this is only used internally, but it may be useful for static generic code.
+template<typename To, typename From>
+struct is_struct_castable :
+    std::integral_constant<bool,
+        detail::record::both_records<To, From>::value && detail::record::is_castable<To, From>::value>
+{
+};
+
+/// @brief Helper variable for retrieving the value from is_struct_castable.
+template<typename To, typename From>
+INLINE_CONSTEXPR bool is_struct_castable_v = is_struct_castable<To, From>::value;
+
+/// @brief Casts a record to another record field by field, without performing runtime checks.
+///
+/// Each field is casted with the unchecked cast of its family (ex. narrow_cast_unchecked for int64 to int16).
+///
+/// @tparam To The (default constructible) record type to cast to.
+/// @tparam From The record type to cast from.
+/// @param from_val The record to cast.
+/// @return The casted record.
+template<typename To, typename From>
+NODISCARD constexpr auto struct_cast_unchecked(const From& from_val) noexcept -> To
+{
+    static_assert(is_struct_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    To result{};
+    detail::record::assign<false>(result, from_val, std::true_type{});
+    return result;
+}
+
+/// @brief Casts a record to another record field by field, with runtime checks.
+///
+/// Each field is casted with the checked cast of its family (ex. narrow_cast_checked for int64 to int16), so a
+/// failure throws the error of that family.
+///
+/// @tparam To The (default constructible) record type to cast to.
+/// @tparam From The record type to cast from.
+/// @param from_val The record to cast.
+/// @return The casted record.
+/// @exception cast_error Thrown (as the error of the field's cast family) if any field does not fit.
+template<typename To, typename From>
+NODISCARD constexpr auto struct_cast_checked(const From& from_val) -> To
+{
+    static_assert(is_struct_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    To result{};
+    detail::record::assign<true>(result, from_val, std::true_type{});
+    return result;
+}
+
+/// @brief Casts a record to another record field by field. Based on configuration this will call struct_cast_checked.
+///
+/// @tparam To The (default constructible) record type to cast to.
+/// @tparam From The record type to cast from.
+/// @param from_val The record to cast.
+/// @return The casted record.
+/// @exception cast_error Thrown (as the error of the field's cast family) if any field does not fit.
+template<typename To, typename From>
+NODISCARD constexpr auto struct_cast(const From& from_val) -> std::enable_if_t<CHECK_CASTS, To>
+{
+    return struct_cast_checked<To>(from_val);
+}
+
+/// @brief Casts a record to another record field by field. Based on configuration this will call
+/// struct_cast_unchecked.
+///
+/// @tparam To The (default constructible) record type to cast to.
+/// @tparam From The record type to cast from.
+/// @param from_val The record to cast.
+/// @return The casted record.
+template<typename To, typename From>
+NODISCARD constexpr auto struct_cast(const From& from_val) noexcept -> std::enable_if_t<!CHECK_CASTS, To>
+{
+    return struct_cast_unchecked<To>(from_val);
+}
+
+/// @brief Casts an array of records to an array of records (AoS to AoS) field by field, without performing runtime
+/// checks.
+///
+/// Each field is converted by its own loop over a block of records, which the compiler can vectorize.
+///
+/// @tparam From The record type to cast from.
+/// @tparam To The record type to cast to.
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param output Pointer to storage for @p count records.
+template<typename From, typename To>
+void struct_cast_batch_unchecked(const From* input, std::size_t count, To* output) noexcept
+{
+    static_assert(is_struct_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::record::convert_records_unchecked(
+        input, count, output, std::make_index_sequence<detail::record::field_count<From>::value>{});
+}
+
+/// @brief Casts an array of records to an array of records (AoS to AoS) field by field, with runtime checks.
+///
+/// Validity is accumulated without branches while the fields are converted, so the loops vectorize like the
+/// unchecked ones, and the input is only scanned again to report the first failing field.
+///
+/// @tparam From The record type to cast from.
+/// @tparam To The record type to cast to.
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param output Pointer to storage for @p count records.
+/// @exception cast_error Thrown (as the error of the field's cast family) if any field does not fit, naming the field
+/// and the index of the record.
+template<typename From, typename To>
+void struct_cast_batch_checked(const From* input, std::size_t count, To* output)
+{
+    static_assert(is_struct_castable_v<To, From>, "`From` does not meet the requirements to be casted to a `To`");
+
+    const bool valid = detail::record::convert_records(
+        input, count, output, std::make_index_sequence<detail::record::field_count<From>::value>{});
+
+    if (UNLIKELY(!valid))
+    {
+        detail::record::throw_batch_error(input, count, output);
+    }
+}
+
+/// @brief Casts an array of records to an array of records (AoS to AoS) field by field. Based on configuration this
+/// will call struct_cast_batch_checked.
+///
+/// @tparam From The record type to cast from.
+/// @tparam To The record type to cast to.
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param output Pointer to storage for @p count records.
+/// @exception cast_error Thrown (as the error of the field's cast family) if any field does not fit.
+template<typename From, typename To>
+auto struct_cast_batch(const From* input, std::size_t count, To* output)
+    -> std::enable_if_t<CHECK_CASTS && is_struct_castable_v<To, From>>
+{
+    struct_cast_batch_checked(input, count, output);
+}
+
+/// @brief Casts an array of records to an array of records (AoS to AoS) field by field. Based on configuration this
+/// will call struct_cast_batch_unchecked.
+///
+/// @tparam From The record type to cast from.
+/// @tparam To The record type to cast to.
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param output Pointer to storage for @p count records.
+template<typename From, typename To>
+auto struct_cast_batch(const From* input, std::size_t count, To* output) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && is_struct_castable_v<To, From>>
+{
+    struct_cast_batch_unchecked(input, count, output);
+}
+
+/// @brief Casts an array of records to one array per field (AoS to SoA), without performing runtime checks.
+///
+/// Each column is converted by its own loop, which the compiler can vectorize.
+///
+/// @tparam From The record type to cast from.
+/// @tparam Columns The element types of the columns, one per field of @p From (in order).
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param columns Pointers to storage for @p count elements each, one per field of @p From (in order).
+template<typename From, typename... Columns>
+void struct_cast_batch_soa_unchecked(const From* input, std::size_t count, Columns*... columns) noexcept
+{
+    static_assert(detail::record::is_columns_castable<From, Columns...>::value,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    detail::record::convert_fields_unchecked<false>(input, count, std::index_sequence_for<Columns...>{}, columns...);
+}
+
+/// @brief Casts an array of records to one array per field (AoS to SoA), with runtime checks.
+///
+/// Each column is converted by its own loop, which accumulates validity without branches so the compiler can
+/// vectorize it, and the input is only scanned again to report the first failing field.
+///
+/// @tparam From The record type to cast from.
+/// @tparam Columns The element types of the columns, one per field of @p From (in order).
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param columns Pointers to storage for @p count elements each, one per field of @p From (in order).
+/// @exception cast_error Thrown (as the error of the field's cast family) if any field does not fit, naming the field
+/// and the index of the record.
+template<typename From, typename... Columns>
+void struct_cast_batch_soa_checked(const From* input, std::size_t count, Columns*... columns)
+{
+    static_assert(detail::record::is_columns_castable<From, Columns...>::value,
+        "`From` does not meet the requirements to be casted to a `To`");
+
+    const bool valid =
+        detail::record::convert_fields<false>(input, count, std::index_sequence_for<Columns...>{}, columns...);
+
+    if (UNLIKELY(!valid))
+    {
+        detail::record::throw_columns_error(input, count, std::index_sequence_for<Columns...>{}, columns...);
+    }
+}
+
+/// @brief Casts an array of records to one array per field (AoS to SoA). Based on configuration this will call
+/// struct_cast_batch_soa_checked.
+///
+/// @tparam From The record type to cast from.
+/// @tparam Columns The element types of the columns, one per field of @p From (in order).
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param columns Pointers to storage for @p count elements each, one per field of @p From (in order).
+/// @exception cast_error Thrown (as the error of the field's cast family) if any field does not fit.
+template<typename From, typename... Columns>
+auto struct_cast_batch_soa(const From* input, std::size_t count, Columns*... columns)
+    -> std::enable_if_t<CHECK_CASTS && detail::record::is_columns_castable<From, Columns...>::value>
+{
+    struct_cast_batch_soa_checked(input, count, columns...);
+}
+
+/// @brief Casts an array of records to one array per field (AoS to SoA). Based on configuration this will call
+/// struct_cast_batch_soa_unchecked.
+///
+/// @tparam From The record type to cast from.
+/// @tparam Columns The element types of the columns, one per field of @p From (in order).
+/// @param input Pointer to the first of @p count records to cast.
+/// @param count The number of records to cast.
+/// @param columns Pointers to storage for @p count elements each, one per field of @p From (in order).
+template<typename From, typename... Columns>
+auto struct_cast_batch_soa(const From* input, std::size_t count, Columns*... columns) noexcept
+    -> std::enable_if_t<!CHECK_CASTS && detail::record::is_columns_castable<From, Columns...>::value>
+{
+    struct_cast_batch_soa_unchecked(input, count, columns...);
+}
+} // namespace casts
+
+#endif // BETTER_CASTS_STRUCT_CAST_HPP
@@ -0,0 +1,161 @@
+#include "better_casts/byte_cast.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        enum class message_type : std::uint8_t
+        {
+            ping = 1,
+            pong = 2,
+        };
+
+        // Unaligned on purpose: the interesting fields start at offset 1
+        const unsigned char packet[] = { 0xFF, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x02 };
+
+        /// Trivially copyable, but not default constructible.
+        struct word_pair
+        {
+            constexpr word_pair(std::uint16_t lo, std::uint16_t hi) noexcept : low(lo), high(hi) {}
+
+            std::uint16_t low;
+            std::uint16_t high;
+        };
+    } // namespace
+
+    static_assert(is_byte_loadable_v<std::uint16_t>, "Must be able to load integers");
+    static_assert(!is_byte_loadable_v<bool>, "Must not be able to load bool, as most byte values are not a bool");
+
+    TEST_SUITE("bit_cast")
+    {
+        TEST_CASE("Object representation is preserved")
+        {
+            CHECK_EQ(bit_cast<std::uint32_t>(1.0F), 0x3F80'0000U);
+            CHECK_EQ(bit_cast<double>(std::uint64_t{ 0x4000'0000'0000'0000 }), 2.0);
+            CHECK_EQ(bit_cast<std::int8_t>(std::uint8_t{ 0xFF }), std::int8_t{ -1 });
+        }
+
+        TEST_CASE("The target type does not need a default constructor")
+        {
+            const word_pair pair = bit_cast<word_pair>(bit_cast<std::uint32_t>(word_pair{ 0x1234, 0x5678 }));
+
+            CHECK_EQ(pair.low, 0x1234);
+            CHECK_EQ(pair.high, 0x5678);
+        }
+    }
+
+    TEST_SUITE("load_cast")
+    {
+        TEST_CASE("Values can be loaded in either byte order")
+        {
+            const auto result0 = load_cast<std::uint16_t, endian::big>(packet + 1);
+            CHECK_EQ(result0, 0x1234);
+
+            const auto result1 = load_cast<std::uint16_t, endian::little>(packet + 1);
+            CHECK_EQ(result1, 0x3412);
+
+            const auto result2 = load_cast<std::uint32_t, endian::big>(packet + 1);
+            CHECK_EQ(result2, 0x1234'5678U);
+
+            const auto result3 = load_cast<std::uint64_t, endian::big>(packet + 1);
+            CHECK_EQ(result3, 0x1234'5678'9ABC'DEF0ULL);
+
+            const auto result4 = load_cast<std::uint64_t, endian::little>(packet + 1);
+            CHECK_EQ(result4, 0xF0DE'BC9A'7856'3412ULL);
+
+            CHECK_EQ(load_cast<std::int8_t>(packet), std::int8_t{ -1 });
+        }
+
+        TEST_CASE("Floating point values can be loaded")
+        {
+            const unsigned char bytes[] = { 0x40, 0x49, 0x0F, 0xDB };
+
+            const auto result = load_cast<float, endian::big>(bytes);
+            CHECK_EQ(result, bit_cast<float>(0x4049'0FDBU));
+        }
+
+        TEST_CASE("Wire values are checked by the matching cast family")
+        {
+            // Narrow: 0x0000'0002 fits, 0x1234'5678 does not
+            const unsigned char small[] = { 0x00, 0x00, 0x00, 0x02 };
+            const auto result0 = load_cast_checked<std::uint8_t, std::uint32_t, endian::big>(small);
+            CHECK_EQ(result0, std::uint8_t{ 2 });
+            REQUIRE_THROWS_AS((std::ignore = load_cast_checked<std::uint16_t, std::uint32_t, endian::big>(packet + 1)),
+                narrow_cast_error);
+
+            // Sign: 0xFF is negative when loaded as int8
+            REQUIRE_THROWS_AS((std::ignore = load_cast_checked<std::uint8_t, std::int8_t>(packet)), sign_cast_error);
+            const auto result1 = load_cast_checked<std::int32_t, std::uint16_t, endian::big>(packet + 1);
+            CHECK_EQ(result1, 0x1234);
+
+            // Enum
+            const auto result2 = load_cast_checked<message_type, std::uint8_t>(packet + 9);
+            CHECK_EQ(result2, message_type::pong);
+
+            // Widening needs no check
+            const auto result3 = load_cast_checked<std::int64_t, std::int8_t>(packet);
+            CHECK_EQ(result3, std::int64_t{ -1 });
+        }
+
+#ifdef __cpp_lib_byte
+        TEST_CASE("std::byte buffers are supported")
+        {
+            const std::byte bytes[] = { std::byte{ 0x01 }, std::byte{ 0x02 } };
+
+            const auto result = load_cast<std::uint16_t, endian::big>(bytes);
+            CHECK_EQ(result, 0x0102);
+        }
+#endif
+    }
+
+    TEST_SUITE("store_cast")
+    {
+        TEST_CASE("Values can be stored in either byte order")
+        {
+            unsigned char buffer[9] = {};
+
+            store_cast<endian::big>(buffer + 1, std::uint32_t{ 0x1234'5678 });
+            CHECK_EQ(buffer[1], 0x12);
+            CHECK_EQ(buffer[4], 0x78);
+
+            store_cast<endian::little>(buffer + 1, std::uint64_t{ 0x0102'0304'0506'0708 });
+            CHECK_EQ(buffer[1], 0x08);
+            CHECK_EQ(buffer[8], 0x01);
+
+            const auto result = load_cast<std::uint64_t, endian::little>(buffer + 1);
+            CHECK_EQ(result, 0x0102'0304'0506'0708ULL);
+        }
+
+        TEST_CASE("Values are checked before they are stored")
+        {
+            unsigned char buffer[4] = { 0xAA, 0xAA, 0xAA, 0xAA };
+
+            store_cast_checked<std::uint16_t, endian::big>(buffer, 0x1234U);
+            CHECK_EQ(buffer[0], 0x12);
+            CHECK_EQ(buffer[1], 0x34);
+
+            REQUIRE_THROWS_AS(
+                (store_cast_checked<std::uint16_t, endian::big>(buffer + 2, 0x10000U)), narrow_cast_error);
+            CHECK_EQ(buffer[2], 0xAA);
+
+            REQUIRE_THROWS_AS(store_cast_checked<std::uint8_t>(buffer, std::int8_t{ -1 }), sign_cast_error);
+            CHECK_EQ(buffer[0], 0x12);
+        }
+    }
+} //namespace tests
+} //namespace casts
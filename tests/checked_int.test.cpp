@@ -0,0 +1,150 @@
+#include "better_casts/checked_int.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        constexpr auto constexpr_sum() -> checked_int<std::int16_t>
+        {
+            checked_int<std::int16_t> sum = 30000;
+            sum += 30000;
+            sum -= 20000;
+            sum -= 20000;
+            return sum;
+        }
+    } // namespace
+
+    TEST_SUITE("checked_int")
+    {
+        TEST_CASE("Arithmetic matches plain integers while in range")
+        {
+            checked_int<std::int32_t> val = 7;
+            val = val * 6 - 2;
+            val += 10;
+            val = -val;
+
+            CHECK_FALSE(val.overflowed());
+            CHECK_EQ(val.wide_value(), -50);
+            CHECK_EQ(narrow_cast_checked<std::int32_t>(val), -50);
+            CHECK_EQ(narrow_cast<std::int8_t>(val), std::int8_t{ -50 });
+        }
+
+        TEST_CASE("Intermediate values only need to fit the final cast")
+        {
+            checked_int<std::int32_t> sum;
+
+            for (int idx = 0; idx < 4; ++idx)
+            {
+                sum += (std::numeric_limits<std::int32_t>::max)();
+            }
+
+            sum -= checked_int<std::int32_t>{ (std::numeric_limits<std::int32_t>::max)() } * 3;
+
+            CHECK_FALSE(sum.overflowed());
+            CHECK_EQ(narrow_cast_checked<std::int32_t>(sum), (std::numeric_limits<std::int32_t>::max)());
+        }
+
+        TEST_CASE("Results outside of the output type are reported by the cast")
+        {
+            const checked_int<std::int32_t> big = checked_int<std::int32_t>{ 100000 } * 100000;
+            const checked_int<std::int32_t> small = -big;
+
+            CHECK_FALSE(big.overflowed());
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<std::int32_t>(big), narrow_cast_error);
+            CHECK_EQ(failure_message([&] { (void)narrow_cast_checked<std::int32_t>(small); }),
+                "narrow_cast failed: input exceeded min value for output type");
+            CHECK_EQ(narrow_cast_unchecked<std::int64_t>(checked_int<std::int64_t>{ 5 }), 5);
+        }
+
+        TEST_CASE("Overflow of the computation is sticky")
+        {
+            checked_int<std::int64_t> product = (std::numeric_limits<std::int64_t>::max)() / 2;
+            product *= 3;
+            CHECK(product.overflowed());
+
+            product -= product;
+            product += 1;
+            CHECK(product.overflowed());
+
+            CHECK_EQ(failure_message([&] { (void)narrow_cast_checked<std::int64_t>(product); }),
+                "narrow_cast failed: arithmetic overflowed before the cast");
+
+            // The flag carries through operations with another value
+            const checked_int<std::int64_t> combined = checked_int<std::int64_t>{ 2 } + product;
+            CHECK(combined.overflowed());
+            CHECK((checked_int<std::int64_t>{ (std::numeric_limits<std::int64_t>::min)() } * -1).overflowed());
+        }
+
+        TEST_CASE("Unsigned values going below zero overflow")
+        {
+            checked_int<std::uint32_t> val = 3U;
+            val -= 5U;
+
+            CHECK(val.overflowed());
+            CHECK((-checked_int<std::uint64_t>{ 1U }).overflowed());
+            CHECK_FALSE((-checked_int<std::uint64_t>{}).overflowed());
+        }
+
+        TEST_CASE("sign_cast extracts the value as a different sign")
+        {
+            const checked_int<std::int32_t> positive = checked_int<std::int32_t>{ 60000 } * 60000;
+            const checked_int<std::int32_t> negative = checked_int<std::int32_t>{ 2 } - 3;
+
+            CHECK_EQ(sign_cast_checked<std::uint32_t>(positive), 3600000000U);
+            CHECK_EQ(sign_cast<std::uint64_t>(positive), 3600000000U);
+            CHECK_EQ(failure_message([&] { (void)sign_cast_checked<std::uint32_t>(negative); }),
+                "sign_cast failed: cannot cast a negative number to unsigned");
+            CHECK_EQ(failure_message([&] { (void)sign_cast_checked<std::uint32_t>(positive * 2); }),
+                "sign_cast failed: input exceeded max value for output type");
+
+            const checked_int<std::uint16_t> word = checked_int<std::uint16_t>{ 40000 } - 1;
+            CHECK_EQ(sign_cast_checked<std::int32_t>(word), 39999);
+            CHECK_EQ(failure_message([&] { (void)sign_cast_checked<std::int16_t>(word); }),
+                "sign_cast failed: input exceeded max value for output type");
+        }
+
+        TEST_CASE("Reductions are validated once at the end")
+        {
+            const std::vector<std::int32_t> values(1000, 3000000);
+            checked_int<std::int32_t> sum;
+            checked_int<std::int32_t> sum_of_squares;
+
+            for (const std::int32_t val : values)
+            {
+                sum += val;
+                sum_of_squares += checked_int<std::int32_t>{ val } * val;
+            }
+
+            CHECK_EQ(narrow_cast_unchecked<std::int32_t>(sum), static_cast<std::int32_t>(3000000000LL));
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<std::int32_t>(sum), narrow_cast_error);
+            CHECK_FALSE(sum_of_squares.overflowed());
+            CHECK_EQ(sum_of_squares.wide_value(), 9000000000000000LL);
+        }
+
+        TEST_CASE("checked_int is usable in constant expressions")
+        {
+            static_assert(!constexpr_sum().overflowed(), "checked_int must be constexpr");
+            static_assert(narrow_cast_checked<std::int16_t>(constexpr_sum()) == 20000, "checked_int must be constexpr");
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,227 @@
+#include "better_casts/chrono_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ratio>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        using ms32 = std::chrono::duration<std::int32_t, std::milli>;
+        using deci8 = std::chrono::duration<std::int8_t, std::deci>;
+        using sys_ms32 = std::chrono::time_point<std::chrono::system_clock, ms32>;
+        using sys_ns = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+        using steady_ns = std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>;
+
+        /// Reference conversion through an exact (non-overflowing for these inputs) multiply.
+        template<typename Op>
+        auto reference(std::int64_t val, std::int64_t num, std::int64_t den, Op tag) -> std::int64_t
+        {
+            return detail::chrono::div_round<std::int64_t>(val * num, den, tag);
+        }
+
+        template<typename Ratio, typename Op>
+        void check_exhaustive(Op tag)
+        {
+            using to_t = std::chrono::duration<std::int8_t, std::ratio<1>>;
+            using from_t = std::chrono::duration<std::int16_t, Ratio>;
+            using bounds = detail::chrono::input_bounds<std::int8_t, std::int16_t, Ratio, Op>;
+
+            for (std::int32_t val = (std::numeric_limits<std::int16_t>::min)();
+                 val <= (std::numeric_limits<std::int16_t>::max)(); ++val)
+            {
+                const std::int64_t expected = reference(val, Ratio::num, Ratio::den, tag);
+                const bool fits = expected >= -128 && expected <= 127;
+                const from_t from_val{ static_cast<std::int16_t>(val) };
+
+                REQUIRE_EQ(fits, val >= bounds::lower && val <= bounds::upper);
+
+                if (fits)
+                {
+                    REQUIRE_EQ(duration_narrow_cast_checked<to_t>(from_val, tag).count(), expected);
+                }
+                else
+                {
+                    REQUIRE_THROWS_AS(
+                        std::ignore = duration_narrow_cast_checked<to_t>(from_val, tag), narrow_cast_error);
+                }
+            }
+        }
+    } // namespace
+
+    static_assert(is_duration_narrow_castable_v<ms32, std::chrono::nanoseconds>, "Must be able to cast durations");
+    static_assert(is_duration_narrow_castable_v<std::chrono::nanoseconds, ms32>, "Must be able to scale up");
+    static_assert(is_duration_narrow_castable_v<sys_ms32, sys_ns>, "Must be able to cast time points");
+    static_assert(!is_duration_narrow_castable_v<steady_ns, sys_ns>, "Must not be able to change clocks");
+    static_assert(!is_duration_narrow_castable_v<ms32, sys_ns>, "Must not be able to mix durations and time points");
+    static_assert(!is_duration_narrow_castable_v<std::chrono::duration<double>, std::chrono::seconds>,
+        "Must not be able to cast to floating point representations");
+    static_assert(!is_duration_narrow_castable_v<std::chrono::duration<std::uint32_t>, std::chrono::seconds>,
+        "Must not be able to change sign");
+    static_assert(!is_duration_narrow_castable_v<std::chrono::seconds, std::int64_t>, "Must only cast chrono types");
+
+    static_assert(duration_narrow_cast_checked<ms32>(std::chrono::seconds{ 3 }) == ms32{ 3000 },
+        "Must be usable in constant expressions");
+
+    TEST_SUITE("duration_narrow_cast")
+    {
+        TEST_CASE("Partial ticks are rounded as requested")
+        {
+            const std::chrono::nanoseconds pos{ 1'500'000 };
+            const std::chrono::nanoseconds neg{ -1'500'000 };
+
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(pos).count(), 1);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(pos, float_cast_op::truncate).count(), 1);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(pos, float_cast_op::floor).count(), 1);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(pos, float_cast_op::ceiling).count(), 2);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(pos, float_cast_op::round).count(), 2);
+
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(neg).count(), -1);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(neg, float_cast_op::floor).count(), -2);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(neg, float_cast_op::ceiling).count(), -1);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(neg, float_cast_op::round).count(), -2);
+
+            const std::chrono::nanoseconds below_half{ 1'499'999 };
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(below_half, float_cast_op::round).count(), 1);
+        }
+
+        TEST_CASE("Scaling up is range checked")
+        {
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(std::chrono::seconds{ 2'147'483 }).count(), 2'147'483'000);
+            CHECK_EQ(duration_narrow_cast_checked<ms32>(std::chrono::seconds{ -2'147'483 }).count(), -2'147'483'000);
+
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<ms32>(std::chrono::seconds{ 2'147'484 }),
+                narrow_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<ms32>(std::chrono::seconds{ -2'147'484 }),
+                narrow_cast_error);
+
+            // std::chrono::duration_cast silently overflows here
+            const std::chrono::seconds huge{ (std::numeric_limits<std::int64_t>::max)() / 1000 + 1 };
+            REQUIRE_THROWS_AS(
+                std::ignore = duration_narrow_cast_checked<std::chrono::milliseconds>(huge), narrow_cast_error);
+        }
+
+        TEST_CASE("Scaling down is range checked after rounding")
+        {
+            CHECK_EQ(duration_narrow_cast_checked<deci8>(std::chrono::milliseconds{ 12'749 }, float_cast_op::round)
+                         .count(),
+                127);
+            CHECK_EQ(duration_narrow_cast_checked<deci8>(std::chrono::milliseconds{ 12'799 }).count(), 127);
+            CHECK_EQ(duration_narrow_cast_checked<deci8>(std::chrono::milliseconds{ -12'899 }).count(), -128);
+
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<deci8>(
+                                  std::chrono::milliseconds{ 12'750 }, float_cast_op::round),
+                narrow_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<deci8>(
+                                  std::chrono::milliseconds{ 12'701 }, float_cast_op::ceiling),
+                narrow_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<deci8>(
+                                  std::chrono::milliseconds{ -12'801 }, float_cast_op::floor),
+                narrow_cast_error);
+        }
+
+        TEST_CASE("Unsigned representations can be cast")
+        {
+            using unsigned_ns = std::chrono::duration<std::uint64_t, std::nano>;
+            using unsigned_ms = std::chrono::duration<std::uint32_t, std::milli>;
+
+            const unsigned_ns below_max{ 4'294'967'295'499'999ULL };
+            const auto result = duration_narrow_cast_checked<unsigned_ms>(below_max, float_cast_op::round);
+            CHECK_EQ(result.count(), 4'294'967'295U);
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<unsigned_ms>(
+                                  unsigned_ns{ 4'294'967'295'500'000ULL }, float_cast_op::round),
+                narrow_cast_error);
+        }
+
+        TEST_CASE("Extreme tick counts do not overflow")
+        {
+            const std::chrono::nanoseconds max_ns{ (std::numeric_limits<std::int64_t>::max)() };
+            const std::chrono::nanoseconds min_ns{ (std::numeric_limits<std::int64_t>::min)() };
+
+            CHECK_EQ(duration_narrow_cast_checked<std::chrono::milliseconds>(max_ns).count(), 9'223'372'036'854LL);
+            CHECK_EQ(
+                duration_narrow_cast_checked<std::chrono::milliseconds>(max_ns, float_cast_op::ceiling).count(),
+                9'223'372'036'855LL);
+            CHECK_EQ(duration_narrow_cast_checked<std::chrono::milliseconds>(min_ns, float_cast_op::floor).count(),
+                -9'223'372'036'855LL);
+            CHECK_EQ(duration_narrow_cast_checked<std::chrono::nanoseconds>(max_ns), max_ns);
+            CHECK_EQ(duration_narrow_cast_unchecked<std::chrono::microseconds>(min_ns).count(),
+                duration_narrow_cast_checked<std::chrono::microseconds>(min_ns).count());
+        }
+
+        TEST_CASE("Exhaustive 16 to 8-bit conversions match an exact reference")
+        {
+            check_exhaustive<std::ratio<1, 1000>>(float_cast_op::round);
+            check_exhaustive<std::ratio<1, 7>>(float_cast_op::floor);
+            check_exhaustive<std::ratio<3, 7>>(float_cast_op::ceiling);
+            check_exhaustive<std::ratio<125, 128>>(float_cast_op::round);
+            check_exhaustive<std::ratio<5>>(float_cast_op::truncate);
+        }
+
+        TEST_CASE("Time points keep their clock")
+        {
+            const sys_ns stamp{ std::chrono::nanoseconds{ 1'700'000'000'123'456'789LL } };
+
+            const auto result = duration_narrow_cast_checked<
+                std::chrono::time_point<std::chrono::system_clock, std::chrono::duration<std::int32_t>>>(stamp);
+            CHECK_EQ(result.time_since_epoch().count(), 1'700'000'000);
+
+            REQUIRE_THROWS_AS(std::ignore = duration_narrow_cast_checked<sys_ms32>(stamp), narrow_cast_error);
+        }
+    }
+
+    TEST_SUITE("duration_narrow_cast_batch")
+    {
+        TEST_CASE("Timestamp columns can be cast")
+        {
+            std::vector<std::chrono::nanoseconds> input;
+            for (std::int64_t idx = 0; idx < 100; ++idx)
+            {
+                input.emplace_back((idx % 2 == 0 ? -1 : 1) * idx * 21'474'836'471LL);
+            }
+
+            std::vector<ms32> output(input.size());
+            duration_narrow_cast_batch_checked(input.data(), input.size(), output.data(), float_cast_op::round);
+
+            std::vector<ms32> unchecked(input.size());
+            duration_narrow_cast_batch_unchecked(input.data(), input.size(), unchecked.data(), float_cast_op::round);
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                CHECK_EQ(output[idx], duration_narrow_cast_checked<ms32>(input[idx], float_cast_op::round));
+                CHECK_EQ(unchecked[idx], output[idx]);
+            }
+        }
+
+        TEST_CASE("Bad elements report their index")
+        {
+            std::vector<std::chrono::nanoseconds> input(10, std::chrono::nanoseconds{ 5 });
+            input[7] = std::chrono::nanoseconds{ 2'147'483'648'000'000LL };
+            std::vector<ms32> output(input.size());
+
+            const std::string message = failure_message(
+                [&] { duration_narrow_cast_batch_checked(input.data(), input.size(), output.data()); });
+            CHECK_NE(std::strstr(message.c_str(), "duration_narrow_cast failed: input at index 7"), nullptr);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,129 @@
+// Runs the better_casts_convert tool (its path is given by CONVERT_TOOL) on small column files.
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        /// A file name in the temporary directory, removed when the object goes out of scope.
+        class temp_file
+        {
+        public:
+            explicit temp_file(const char* suffix) :
+                m_path(std::string(P_tmpdir) + "/better_casts_convert_" + std::to_string(::getpid()) + suffix)
+            {
+            }
+
+            temp_file(const temp_file&) = delete;
+            auto operator=(const temp_file&) -> temp_file& = delete;
+
+            ~temp_file() { std::remove(m_path.c_str()); }
+
+            auto path() const -> const std::string& { return m_path; }
+
+        private:
+            std::string m_path;
+        };
+
+        template<typename T>
+        void write_column(const temp_file& file, const std::vector<T>& values)
+        {
+            std::ofstream out(file.path(), std::ios::binary);
+            out.write(reinterpret_cast<const char*>(values.data()),
+                static_cast<std::streamsize>(values.size() * sizeof(T)));
+        }
+
+        template<typename T>
+        auto read_column(const temp_file& file) -> std::vector<T>
+        {
+            std::ifstream in(file.path(), std::ios::binary);
+            const std::vector<char> bytes{ std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+            std::vector<T> values(bytes.size() / sizeof(T));
+
+            std::copy_n(bytes.data(), values.size() * sizeof(T), reinterpret_cast<char*>(values.data()));
+            return values;
+        }
+
+        /// Runs the tool and returns its exit status.
+        auto run_tool(const std::string& args) -> int
+        {
+            return std::system((std::string(CONVERT_TOOL) + " --quiet " + args + " 2>/dev/null").c_str());
+        }
+    } // namespace
+
+    TEST_SUITE("better_casts_convert")
+    {
+        TEST_CASE("Negative doubles are narrowed to float")
+        {
+            const temp_file input(".f64");
+            const temp_file output(".f32");
+            const std::vector<double> values{ -1.5, -2.25, 3.0, -1e30, std::numeric_limits<double>::lowest() / 1e300 };
+
+            write_column(input, values);
+            REQUIRE_EQ(run_tool("f64 f32 " + input.path() + " " + output.path()), 0);
+
+            const std::vector<float> result = read_column<float>(output);
+            REQUIRE_EQ(result.size(), values.size());
+
+            for (std::size_t idx = 0; idx < values.size(); ++idx)
+            {
+                CHECK_EQ(result[idx], static_cast<float>(values[idx]));
+            }
+        }
+
+        TEST_CASE("Doubles beyond the range of float fail or saturate")
+        {
+            const temp_file input(".f64");
+            const temp_file output(".f32");
+
+            write_column(input, std::vector<double>{ 1.0, -1e300 });
+            CHECK_NE(run_tool("f64 f32 " + input.path() + " " + output.path()), 0);
+
+            REQUIRE_EQ(run_tool("--on-error saturate f64 f32 " + input.path() + " " + output.path()), 0);
+
+            const std::vector<float> result = read_column<float>(output);
+            REQUIRE_EQ(result.size(), 2);
+            CHECK_EQ(result[0], 1.0F);
+            CHECK_EQ(result[1], std::numeric_limits<float>::lowest());
+        }
+
+        TEST_CASE("Integers that do not fit are saturated per element")
+        {
+            const temp_file input(".i64");
+            const temp_file output(".u8");
+
+            write_column(input, std::vector<std::int64_t>{ 7, -3, 255, 256, 0 });
+            CHECK_NE(run_tool("i64 u8 " + input.path() + " " + output.path()), 0);
+
+            REQUIRE_EQ(run_tool("--on-error saturate i64 u8 " + input.path() + " " + output.path()), 0);
+
+            const std::vector<std::uint8_t> result = read_column<std::uint8_t>(output);
+            const std::vector<std::uint8_t> expected{ 7, 0, 255, 255, 0 };
+            CHECK_EQ(result, expected);
+        }
+    }
+} //namespace tests
+} //namespace casts
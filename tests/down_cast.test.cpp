@@ -0,0 +1,260 @@
+#include "better_casts.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        struct base
+        {
+            base() = default;
+            base(const base&) = default;
+            base(base&&) = default;
+            auto operator=(const base&) -> base& = default;
+            auto operator=(base&&) -> base& = default;
+            virtual ~base() = default;
+
+            int base_val = 1;
+        };
+
+        struct derived : base
+        {
+            int derived_val = 2;
+        };
+
+        struct more_derived final : derived
+        {
+            int more_derived_val = 3;
+        };
+
+        struct sibling final : base
+        {
+        };
+
+        struct other
+        {
+            other() = default;
+            other(const other&) = default;
+            other(other&&) = default;
+            auto operator=(const other&) -> other& = default;
+            auto operator=(other&&) -> other& = default;
+            virtual ~other() = default;
+
+            int other_val = 4;
+        };
+
+        // `derived` lives at a non-zero offset, so a cached offset must be applied correctly
+        struct multi final : other, derived
+        {
+        };
+
+        struct virtual_derived final : virtual base
+        {
+        };
+
+        struct node
+        {
+            node() = default;
+            node(const node&) = default;
+            node(node&&) = default;
+            auto operator=(const node&) -> node& = default;
+            auto operator=(node&&) -> node& = default;
+            virtual ~node() = default;
+
+            NODISCARD virtual auto dynamic_type_tag() const noexcept -> const type_tag&
+            {
+                return type_tag_of<node>();
+            }
+        };
+
+        struct expression : node
+        {
+            using down_cast_parent = node;
+
+            NODISCARD auto dynamic_type_tag() const noexcept -> const type_tag& override
+            {
+                return type_tag_of<expression>();
+            }
+        };
+
+        struct literal final : expression
+        {
+            using down_cast_parent = expression;
+
+            NODISCARD auto dynamic_type_tag() const noexcept -> const type_tag& override
+            {
+                return type_tag_of<literal>();
+            }
+
+            int value = 7;
+        };
+
+        struct statement final : node
+        {
+            using down_cast_parent = node;
+
+            NODISCARD auto dynamic_type_tag() const noexcept -> const type_tag& override
+            {
+                return type_tag_of<statement>();
+            }
+        };
+    } // namespace
+
+    static_assert(is_down_castable_v<derived*, base*>, "Must be able to cast B* to D*");
+    static_assert(is_down_castable_v<const derived&, const base&>, "Must be able to cast const B& to const D&");
+    static_assert(!is_down_castable_v<derived*, const base*>, "Must not be able to drop const");
+    static_assert(!is_down_castable_v<base*, derived*>, "Must not be able to down_cast to a base");
+    static_assert(!is_down_castable_v<derived*, base&>, "Must not be able to mix pointers and references");
+    static_assert(!is_down_castable_v<multi*, sibling*>, "Must not be able to cast to an unrelated type");
+    static_assert(!is_down_castable_v<virtual_derived*, base*>, "Must not be able to cast from a virtual base");
+    static_assert(is_down_castable_v<std::shared_ptr<derived>, std::shared_ptr<base>>,
+        "Must be able to cast shared_ptr<B> to shared_ptr<D>");
+    static_assert(is_down_castable_v<std::unique_ptr<derived>, std::unique_ptr<base>>,
+        "Must be able to cast unique_ptr<B> to unique_ptr<D>");
+    static_assert(!is_down_castable_v<std::unique_ptr<derived>, std::unique_ptr<base>&>,
+        "Must not be able to copy a unique_ptr");
+
+    TEST_SUITE("down_cast")
+    {
+#ifdef HAS_RTTI
+        TEST_CASE("Pointers to the target type can be cast")
+        {
+            more_derived obj;
+            base* const ptr = &obj;
+
+            // Twice, so the second cast is served from the offset cache
+            for (int i = 0; i < 2; ++i)
+            {
+                auto* const result0 = down_cast_checked<derived*>(ptr);
+                CHECK_EQ(result0, &obj);
+                CHECK_EQ(result0->derived_val, 2);
+
+                auto* const result1 = down_cast_checked<more_derived*>(ptr);
+                CHECK_EQ(result1, &obj);
+            }
+
+            const base& ref = obj;
+            const auto& result2 = down_cast_checked<const more_derived&>(ref);
+            CHECK_EQ(result2.more_derived_val, 3);
+
+            CHECK_EQ(down_cast_unchecked<derived*>(ptr), &obj);
+            CHECK_EQ(down_cast<derived*>(ptr), &obj);
+        }
+
+        TEST_CASE("Subobjects at an offset are adjusted")
+        {
+            multi obj;
+            other* const other_ptr = &obj;
+            base* const base_ptr = &obj;
+
+            for (int i = 0; i < 2; ++i)
+            {
+                auto* const result0 = down_cast_checked<multi*>(other_ptr);
+                CHECK_EQ(result0, &obj);
+
+                auto* const result1 = down_cast_checked<derived*>(base_ptr);
+                CHECK_EQ(result1, static_cast<derived*>(&obj));
+                CHECK_EQ(result1->derived_val, 2);
+            }
+        }
+
+        TEST_CASE("Null pointers are passed through")
+        {
+            base* const ptr = nullptr;
+
+            CHECK_EQ(down_cast_checked<derived*>(ptr), nullptr);
+        }
+
+        TEST_CASE("Objects of another type are rejected")
+        {
+            sibling sib;
+            derived der;
+            base* const ptr0 = &sib;
+            base* const ptr1 = &der;
+            base& ref = sib;
+
+            // The cache from the previous cases must not leak a stale offset to other dynamic types
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<derived*>(ptr0), down_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<more_derived*>(ptr1), down_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<derived&>(ref), down_cast_error);
+        }
+
+        TEST_CASE("shared_ptrs can be cast")
+        {
+            std::shared_ptr<base> ptr = std::make_shared<more_derived>();
+            const auto* const raw = ptr.get();
+
+            const auto result0 = down_cast_checked<std::shared_ptr<derived>>(ptr);
+            CHECK_EQ(result0.get(), raw);
+            CHECK_EQ(ptr.use_count(), 2);
+
+            const auto result1 = down_cast_unchecked<std::shared_ptr<more_derived>>(std::move(ptr));
+            CHECK_EQ(result1.get(), raw);
+            CHECK_EQ(result1.use_count(), 2);
+            CHECK_EQ(ptr, nullptr); // NOLINT(bugprone-use-after-move)
+
+            const auto result2 = down_cast_checked<std::shared_ptr<derived>>(std::shared_ptr<base>{});
+            CHECK_EQ(result2, nullptr);
+        }
+
+        TEST_CASE("unique_ptrs can be cast")
+        {
+            std::unique_ptr<base> ptr = std::make_unique<more_derived>();
+            const auto* const raw = ptr.get();
+
+            const auto result = down_cast_checked<std::unique_ptr<more_derived>>(std::move(ptr));
+            CHECK_EQ(result.get(), raw);
+            CHECK_EQ(ptr, nullptr); // NOLINT(bugprone-use-after-move)
+        }
+
+        TEST_CASE("Smart pointers keep their ownership when the cast fails")
+        {
+            std::shared_ptr<base> shared = std::make_shared<sibling>();
+            std::unique_ptr<base> unique = std::make_unique<sibling>();
+
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<std::shared_ptr<derived>>(std::move(shared)),
+                down_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<std::unique_ptr<derived>>(std::move(unique)),
+                down_cast_error);
+            CHECK_NE(shared, nullptr); // NOLINT(bugprone-use-after-move)
+            CHECK_NE(unique, nullptr); // NOLINT(bugprone-use-after-move)
+        }
+#endif
+
+        TEST_CASE("Type tag hierarchies are used when provided")
+        {
+            literal lit;
+            statement stmt;
+            node* const lit_ptr = &lit;
+            node* const stmt_ptr = &stmt;
+            const node& lit_ref = lit;
+
+            CHECK_EQ(type_tag_of<literal>().parent, &type_tag_of<expression>());
+            CHECK_EQ(type_tag_of<node>().parent, nullptr);
+
+            auto* const result0 = down_cast_checked<expression*>(lit_ptr);
+            CHECK_EQ(result0, &lit);
+
+            const auto& result1 = down_cast_checked<const literal&>(lit_ref);
+            CHECK_EQ(result1.value, 7);
+
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<expression*>(stmt_ptr), down_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = down_cast_checked<statement&>(*lit_ptr), down_cast_error);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,93 @@
+#ifndef BETTER_CASTS_TESTS_FAILURE_MESSAGE_HPP
+#define BETTER_CASTS_TESTS_FAILURE_MESSAGE_HPP
+
+#include "better_casts.hpp"
+
+#include <string>
+
+#ifndef HAS_EXCEPTIONS
+#  include <cstddef>
+#  include <cstring>
+#  include <sys/types.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
+namespace casts
+{
+namespace tests
+{
+#ifndef HAS_EXCEPTIONS
+    namespace failure
+    {
+        inline auto message_fd() noexcept -> int&
+        {
+            static int fd = -1;
+            return fd;
+        }
+
+        /// Failure handler of the child process: sends the message to the parent and exits.
+        inline void send_message(const char* message)
+        {
+            const ssize_t written = write(message_fd(), message, std::strlen(message));
+            _exit(written < 0 ? 2 : 1);
+        }
+    } //namespace failure
+#endif
+
+    /// Runs @p cast and returns the message of the cast failure it reports, or an empty string if it succeeds.
+    ///
+    /// Without exceptions the failure handler cannot return to the caller, so @p cast runs in a child process whose
+    /// handler sends the message back through a pipe.
+    template<typename Cast>
+    auto failure_message(Cast cast) -> std::string
+    {
+#ifdef HAS_EXCEPTIONS
+        try
+        {
+            cast();
+        }
+        catch (const cast_error& err)
+        {
+            return err.what();
+        }
+
+        return "";
+#else
+        int fds[2] = { -1, -1 };
+        if (pipe(fds) != 0)
+        {
+            return "pipe() failed";
+        }
+
+        const pid_t child = fork();
+        if (child == 0)
+        {
+            close(fds[0]);
+            failure::message_fd() = fds[1];
+            set_cast_failure_handler(&failure::send_message);
+            cast();
+            _exit(0);
+        }
+
+        close(fds[1]);
+
+        std::string message;
+        char buffer[256];
+        ssize_t size = 0;
+        while ((size = read(fds[0], buffer, sizeof(buffer))) > 0)
+        {
+            message.append(buffer, static_cast<std::size_t>(size));
+        }
+
+        close(fds[0]);
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        return message;
+#endif
+    }
+} //namespace tests
+} //namespace casts
+
+#endif // BETTER_CASTS_TESTS_FAILURE_MESSAGE_HPP
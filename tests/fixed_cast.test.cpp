@@ -0,0 +1,175 @@
+#include "better_casts/fixed_cast.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    TEST_SUITE("fixed_cast_checked")
+    {
+        TEST_CASE("Float can be cast to Q15")
+        {
+            CHECK_EQ(fixed_cast_checked<q15>(0.5F), std::int16_t{ 16384 });
+            CHECK_EQ(fixed_cast_checked<q15>(-1.0F), std::int16_t{ -32768 });
+            CHECK_EQ(fixed_cast_checked<q15>(0.25, float_cast_op::round), std::int16_t{ 8192 });
+        }
+
+        TEST_CASE("Rounding tags are applied to the scaled value")
+        {
+            // 0.1 * 2^15 = 3276.8
+            CHECK_EQ(fixed_cast_checked<q15>(0.1, float_cast_op::truncate), std::int16_t{ 3276 });
+            CHECK_EQ(fixed_cast_checked<q15>(0.1, float_cast_op::floor), std::int16_t{ 3276 });
+            CHECK_EQ(fixed_cast_checked<q15>(0.1, float_cast_op::ceiling), std::int16_t{ 3277 });
+            CHECK_EQ(fixed_cast_checked<q15>(0.1, float_cast_op::round), std::int16_t{ 3277 });
+            CHECK_EQ(fixed_cast_checked<q15>(-0.1, float_cast_op::floor), std::int16_t{ -3277 });
+        }
+
+        TEST_CASE("Decimal format can be cast")
+        {
+            using price_t = decimal_format<std::int64_t, 4>;
+
+            CHECK_EQ(fixed_cast_checked<price_t>(123.4567, float_cast_op::round), std::int64_t{ 1234567 });
+            CHECK_EQ(fixed_cast_checked<price_t>(-0.0001, float_cast_op::round), std::int64_t{ -1 });
+        }
+
+        TEST_CASE("Cannot cast a value outside of the format's range")
+        {
+            REQUIRE_THROWS_AS(std::ignore = fixed_cast_checked<q15>(1.0F), float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = fixed_cast_checked<q15>(-1.5F), float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = fixed_cast_checked<q31>(2.0), float_cast_error);
+        }
+
+        TEST_CASE("Cannot cast NaN or Infinity")
+        {
+            REQUIRE_THROWS_AS(
+                std::ignore = fixed_cast_checked<q15>(std::numeric_limits<float>::quiet_NaN()), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = fixed_cast_checked<q31>(std::numeric_limits<double>::infinity()), float_cast_error);
+        }
+
+        TEST_CASE("Raw value can be cast back to a float")
+        {
+            using cents_t = decimal_format<std::int32_t, 2>;
+
+            const auto result0 = fixed_cast<float, q15>(std::int16_t{ 16384 });
+            CHECK_EQ(result0, 0.5F);
+
+            const auto result1 = fixed_cast<double, q31>(std::int32_t{ -1073741824 });
+            CHECK_EQ(result1, -0.5);
+
+            const auto result2 = fixed_cast<double, cents_t>(std::int32_t{ 1250 });
+            CHECK_EQ(result2, 12.5);
+        }
+    }
+
+    TEST_SUITE("fixed_cast_batch")
+    {
+        TEST_CASE_TEMPLATE("Batch matches the scalar cast", T, float, double)
+        {
+            std::vector<T> input;
+
+            for (int i = -100; i < 100; ++i)
+            {
+                input.push_back(static_cast<T>(i) / static_cast<T>(101.5));
+            }
+
+            std::vector<std::int16_t> output16(input.size());
+            std::vector<std::int32_t> output32(input.size());
+
+            fixed_cast_batch_checked<q15>(input.data(), input.size(), output16.data(), float_cast_op::round);
+            fixed_cast_batch_checked<q31>(input.data(), input.size(), output32.data(), float_cast_op::floor);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output16[i], fixed_cast_checked<q15>(input[i], float_cast_op::round));
+                CHECK_EQ(output32[i], fixed_cast_checked<q31>(input[i], float_cast_op::floor));
+            }
+        }
+
+        TEST_CASE_TEMPLATE("Batch applies the tie-aware and stochastic rounding tags", T, float, double)
+        {
+            // Multiples of 2^-16 scale to exact ties in Q15
+            std::vector<T> input;
+
+            for (int i = -300; i < 300; ++i)
+            {
+                input.push_back(static_cast<T>(i) / static_cast<T>(65536));
+            }
+
+            std::vector<std::int16_t> output(input.size());
+
+            fixed_cast_batch_checked<q15>(input.data(), input.size(), output.data(), float_cast_op::round_even);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], fixed_cast_checked<q15>(input[i], float_cast_op::round_even));
+            }
+
+            fixed_cast_batch_checked<q15>(input.data(), input.size(), output.data(), float_cast_op::round_half_down);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], fixed_cast_checked<q15>(input[i], float_cast_op::round_half_down));
+            }
+
+            // With a constant generator, every lane draws the same threshold as the scalar cast
+            set_stochastic_rng([]() -> std::uint64_t { return std::uint64_t{ 1 } << 63U; });
+            fixed_cast_batch_checked<q15>(input.data(), input.size(), output.data(), float_cast_op::stochastic);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], fixed_cast_checked<q15>(input[i], float_cast_op::stochastic));
+            }
+
+            set_stochastic_rng(nullptr);
+        }
+
+        TEST_CASE("Batch reports out of range values")
+        {
+            std::vector<float> input(37, 0.25F);
+            std::vector<std::int16_t> output(input.size());
+
+            input[29] = 1.0F;
+            REQUIRE_THROWS_AS(
+                fixed_cast_batch_checked<q15>(input.data(), input.size(), output.data()), float_cast_error);
+
+            input[29] = std::numeric_limits<float>::quiet_NaN();
+            REQUIRE_THROWS_AS(
+                fixed_cast_batch_checked<q15>(input.data(), input.size(), output.data()), float_cast_error);
+
+            input[29] = 0.25F;
+            input[3] = -2.0F;
+            REQUIRE_THROWS_AS(
+                fixed_cast_batch_checked<q15>(input.data(), input.size(), output.data()), float_cast_error);
+        }
+
+        TEST_CASE("Batch can cast raw values back to floats")
+        {
+            const std::vector<std::int16_t> input{ -32768, -16384, 0, 8192, 32767 };
+            std::vector<double> output(input.size());
+
+            fixed_cast_batch<double, q15>(input.data(), input.size(), output.data());
+
+            CHECK_EQ(output[0], -1.0);
+            CHECK_EQ(output[1], -0.5);
+            CHECK_EQ(output[2], 0.0);
+            CHECK_EQ(output[3], 0.25);
+            CHECK_EQ(output[4], 32767.0 / 32768.0);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -9,13 +9,170 @@
 #  pragma clang diagnostic pop
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 namespace casts
 {
 namespace tests
 {
+    namespace
+    {
+#ifdef EXHAUSTIVE_FLOAT_TESTS
+        /// Every float bit pattern is checked.
+        constexpr std::uint32_t pattern_stride = 1;
+#else
+        /// A prime stride, so the checked patterns cover every exponent with varied fraction bits.
+        constexpr std::uint32_t pattern_stride = 1021;
+#endif
+
+        /// Checks the cast of @p val against the <cmath> rounding of it (@p expected), if the result fits in @p To.
+        template<typename To, typename F, typename Op>
+        auto rounds_to(F val, F expected, Op tag) -> bool
+        {
+            return !detail::math::fits_int<To>(expected)
+                || float_cast_unchecked<To>(val, tag) == static_cast<To>(expected);
+        }
+
+        /// Rounds to nearest, ties towards zero (there is no <cmath> equivalent): from half the precision of @p F up,
+        /// every value is already an integer, and below it `val -/+ 0.5` is exact.
+        template<typename F>
+        auto round_half_down_reference(F val) -> F
+        {
+            const F half = detail::math::float_const<F>::HALF;
+
+            if (!(std::fabs(val) < detail::math::pow2<F>(std::numeric_limits<F>::digits - 1)))
+            {
+                return val;
+            }
+
+            return val > F{ 0 } ? std::ceil(val - half) : std::floor(val + half);
+        }
+
+        template<typename To, typename F>
+        auto rounds_like_cmath(F val) -> bool
+        {
+            // std::nearbyint rounds ties to even in the default rounding mode
+            return rounds_to<To>(val, std::trunc(val), float_cast_op::truncate)
+                && rounds_to<To>(val, std::floor(val), float_cast_op::floor)
+                && rounds_to<To>(val, std::ceil(val), float_cast_op::ceiling)
+                && rounds_to<To>(val, std::round(val), float_cast_op::round)
+                && rounds_to<To>(val, std::nearbyint(val), float_cast_op::round_even)
+                && rounds_to<To>(val, round_half_down_reference(val), float_cast_op::round_half_down);
+        }
+
+        auto lowest_bits() -> std::uint64_t
+        {
+            return 0;
+        }
+
+        auto highest_bits() -> std::uint64_t
+        {
+            return ~std::uint64_t{ 0 };
+        }
+
+        /// Checks the deterministic operations on every `pattern_stride`-th float bit pattern, split across the
+        /// hardware threads. Returns the number of mismatching patterns, and stores the lowest one in @p first_bad
+        /// (zero if there are none).
+        auto check_float_patterns(std::uint32_t& first_bad) -> std::uint64_t
+        {
+            const unsigned threads = (std::max)(1U, std::thread::hardware_concurrency());
+            std::atomic<std::uint64_t> mismatches{ 0 };
+            std::atomic<std::uint32_t> first{ (std::numeric_limits<std::uint32_t>::max)() };
+            std::vector<std::thread> workers;
+
+            for (unsigned thread = 0; thread < threads; ++thread)
+            {
+                workers.emplace_back(
+                    [&, thread]
+                    {
+                        std::uint64_t local = 0;
+
+                        for (std::uint64_t bits = std::uint64_t{ thread } * pattern_stride; bits <= 0xFFFFFFFFU;
+                             bits += std::uint64_t{ threads } * pattern_stride)
+                        {
+                            const auto pattern = static_cast<std::uint32_t>(bits);
+                            float val = 0.0F;
+                            std::memcpy(&val, &pattern, sizeof(val));
+
+                            if (detail::math::is_nan(val) || detail::math::is_inf(val))
+                            {
+                                continue;
+                            }
+
+                            const bool matches = rounds_like_cmath<std::int8_t>(val)
+                                && rounds_like_cmath<std::int32_t>(val) && rounds_like_cmath<std::uint32_t>(val)
+                                && rounds_like_cmath<std::int64_t>(val) && rounds_like_cmath<std::uint64_t>(val);
+
+                            // Patterns are visited in increasing order, so only the first of each thread can be lowest
+                            if (!matches && local++ == 0)
+                            {
+                                std::uint32_t lowest = first.load();
+
+                                while (pattern < lowest && !first.compare_exchange_weak(lowest, pattern))
+                                {
+                                }
+                            }
+                        }
+
+                        mismatches += local;
+                    });
+            }
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+
+            first_bad = mismatches == 0 ? 0 : first.load();
+            return mismatches;
+        }
+
+        /// Checks the deterministic operations on @p F values around every power of two that an integer can hold.
+        template<typename F>
+        void check_every_magnitude()
+        {
+            for (int exp = -2; exp <= 128; ++exp)
+            {
+                const F base = detail::math::pow2<F>(exp);
+
+                if (detail::math::is_inf(base))
+                {
+                    break;
+                }
+
+                const F half = detail::math::float_const<F>::HALF;
+                const F inf = std::numeric_limits<F>::infinity();
+                const F values[] = { base, std::nextafter(base, F{ 0 }), std::nextafter(base, inf), base + half,
+                    std::nextafter(base + half, F{ 0 }), std::nextafter(base + half, inf), base - half,
+                    std::nextafter(base - half, F{ 0 }), std::nextafter(base - half, inf) };
+
+                for (const F magnitude : values)
+                {
+                    for (const F val : { magnitude, -magnitude })
+                    {
+                        CHECK(rounds_like_cmath<std::int32_t>(val));
+                        CHECK(rounds_like_cmath<std::int64_t>(val));
+                        CHECK(rounds_like_cmath<std::uint64_t>(val));
+#ifdef __SIZEOF_INT128__
+                        __extension__ using int128_t = __int128;
+                        __extension__ using uint128_t = unsigned __int128;
+                        CHECK(rounds_like_cmath<int128_t>(val));
+                        CHECK(rounds_like_cmath<uint128_t>(val));
+#endif
+                    }
+                }
+            }
+        }
+    } // namespace
+
     TEST_SUITE("float_cast_checked")
     {
         TEST_CASE("Cannot cast NaN")
@@ -212,6 +369,171 @@ namespace tests
             const auto result5 = float_cast_checked<int>(test_val5, float_cast_op::truncate);
             CHECK_EQ(result5, expected5);
         }
+
+        TEST_CASE_TEMPLATE("Round half to even float to an int", T, float, double, long double)
+        {
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(0.5), float_cast_op::round_even), 0);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(1.5), float_cast_op::round_even), 2);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(2.5), float_cast_op::round_even), 2);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(2.5001), float_cast_op::round_even), 3);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-0.5), float_cast_op::round_even), 0);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-1.5), float_cast_op::round_even), -2);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-2.5), float_cast_op::round_even), -2);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-2.4999), float_cast_op::round_even), -2);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-9.9999), float_cast_op::round_even), -10);
+        }
+
+        TEST_CASE_TEMPLATE("Round half down float to an int", T, float, double, long double)
+        {
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(0.5), float_cast_op::round_half_down), 0);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(1.5), float_cast_op::round_half_down), 1);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(2.5), float_cast_op::round_half_down), 2);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(2.5001), float_cast_op::round_half_down), 3);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-1.5), float_cast_op::round_half_down), -1);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(-2.5001), float_cast_op::round_half_down), -3);
+            CHECK_EQ(float_cast_checked<int>(static_cast<T>(3.14), float_cast_op::round_half_down), 3);
+        }
+
+        TEST_CASE("Range checks account for how ties are rounded")
+        {
+            // 127.5 rounds to the even 128, but -128.5 rounds to the even -128
+            REQUIRE_THROWS_AS(
+                std::ignore = float_cast_checked<std::int8_t>(127.5, float_cast_op::round_even), float_cast_error);
+            CHECK_EQ(float_cast_checked<std::int8_t>(-128.5, float_cast_op::round_even), std::int8_t{ -128 });
+            REQUIRE_THROWS_AS(
+                std::ignore = float_cast_checked<std::int8_t>(-128.51, float_cast_op::round_even), float_cast_error);
+            CHECK_EQ(float_cast_checked<std::uint8_t>(-0.5F, float_cast_op::round_even), std::uint8_t{ 0 });
+
+            CHECK_EQ(float_cast_checked<std::int8_t>(127.5, float_cast_op::round_half_down), std::int8_t{ 127 });
+            CHECK_EQ(float_cast_checked<std::int8_t>(-128.5, float_cast_op::round_half_down), std::int8_t{ -128 });
+            REQUIRE_THROWS_AS(std::ignore = float_cast_checked<std::int8_t>(127.51, float_cast_op::round_half_down),
+                float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = float_cast_checked<std::int8_t>(-128.51, float_cast_op::round_half_down),
+                float_cast_error);
+        }
+
+        TEST_CASE("Stochastic rounding picks a neighbour with the probability of the discarded fraction")
+        {
+            // A zero threshold rounds every fraction away from zero, the largest one rounds towards zero
+            REQUIRE_EQ(set_stochastic_rng(&lowest_bits), nullptr);
+            CHECK_EQ(float_cast_checked<int>(2.25, float_cast_op::stochastic), 3);
+            CHECK_EQ(float_cast_checked<int>(-2.25F, float_cast_op::stochastic), -3);
+            CHECK_EQ(float_cast_checked<int>(2.0, float_cast_op::stochastic), 2);
+
+            CHECK_EQ(set_stochastic_rng(&highest_bits), &lowest_bits);
+            CHECK_EQ(float_cast_checked<int>(2.75, float_cast_op::stochastic), 2);
+            CHECK_EQ(float_cast_checked<int>(-2.75F, float_cast_op::stochastic), -2);
+
+            CHECK_EQ(set_stochastic_rng(nullptr), &highest_bits);
+
+            constexpr int samples = 100000;
+            long long sum = 0;
+            bool neighbours_only = true;
+
+            for (int i = 0; i < samples; ++i)
+            {
+                const int result = float_cast_checked<int>(-2.25, float_cast_op::stochastic);
+                neighbours_only = neighbours_only && (result == -2 || result == -3);
+                sum += result;
+            }
+
+            // The standard deviation of the mean is about 0.0014
+            CHECK(neighbours_only);
+            CHECK(std::fabs(static_cast<double>(sum) / samples + 2.25) < 0.01);
+        }
+
+        TEST_CASE("Stochastic range checks do not depend on the draw")
+        {
+            CHECK_EQ(float_cast_checked<std::int8_t>(127.0, float_cast_op::stochastic), std::int8_t{ 127 });
+            REQUIRE_THROWS_AS(
+                std::ignore = float_cast_checked<std::int8_t>(127.01, float_cast_op::stochastic), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = float_cast_checked<std::int8_t>(-128.01, float_cast_op::stochastic), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = float_cast_checked<std::uint8_t>(-0.01F, float_cast_op::stochastic), float_cast_error);
+        }
+
+        TEST_CASE("Range checks are exact at the limits of the output type")
+        {
+            static constexpr float test_val0 = -2147483648.0F;
+            CHECK_EQ(float_cast_checked<int>(test_val0, float_cast_op::truncate), (std::numeric_limits<int>::min)());
+            CHECK_EQ(float_cast_checked<int>(test_val0, float_cast_op::ceiling), (std::numeric_limits<int>::min)());
+            CHECK_EQ(float_cast_checked<int>(test_val0, float_cast_op::round), (std::numeric_limits<int>::min)());
+
+            static constexpr float test_val1 = 2147483648.0F;
+            REQUIRE_THROWS_AS(std::ignore = float_cast_checked<int>(test_val1, float_cast_op::floor), float_cast_error);
+
+            static constexpr double test_val2 = -2147483648.5;
+            CHECK_EQ(float_cast_checked<int>(test_val2, float_cast_op::truncate), (std::numeric_limits<int>::min)());
+            REQUIRE_THROWS_AS(std::ignore = float_cast_checked<int>(test_val2, float_cast_op::round), float_cast_error);
+        }
+
+        TEST_CASE("Large values are rounded without overflowing")
+        {
+            static constexpr double test_val = 1e19;
+            static constexpr std::uint64_t expected = 10000000000000000000ULL;
+
+            CHECK_EQ(float_cast_checked<std::uint64_t>(test_val, float_cast_op::round), expected);
+            CHECK_EQ(float_cast_checked<std::uint64_t>(test_val, float_cast_op::floor), expected);
+            CHECK_EQ(float_cast_checked<std::uint64_t>(test_val, float_cast_op::ceiling), expected);
+        }
+
+#ifdef __SIZEOF_INT128__
+        TEST_CASE("Float can be cast to 128-bit integers")
+        {
+            __extension__ using int128_t = __int128;
+            __extension__ using uint128_t = unsigned __int128;
+
+            static constexpr double test_val0 = -1e30;
+            CHECK(float_cast_checked<int128_t>(test_val0, float_cast_op::round) == static_cast<int128_t>(test_val0));
+
+            // Every finite float fits in an unsigned 128-bit integer
+            static constexpr float test_val1 = std::numeric_limits<float>::max();
+            CHECK(float_cast_checked<uint128_t>(test_val1) == static_cast<uint128_t>(test_val1));
+
+            static constexpr float test_val2 = -detail::math::pow2<float>(127);
+            CHECK(float_cast_checked<int128_t>(test_val2) == (std::numeric_limits<int128_t>::min)());
+
+            static constexpr double test_val3 = detail::math::pow2<double>(128);
+            REQUIRE_THROWS_AS(std::ignore = float_cast_checked<uint128_t>(test_val3), float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = float_cast_checked<int128_t>(test_val3 / 2), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = float_cast_checked<uint128_t>(-0.5, float_cast_op::floor), float_cast_error);
+        }
+#endif
+    }
+
+    TEST_SUITE("float_cast")
+    {
+        TEST_CASE("Dispatch is noexcept only when it selects the unchecked cast")
+        {
+            CHECK_EQ(noexcept(float_cast<std::int32_t>(1.5)), !CHECK_CASTS);
+            CHECK_EQ(noexcept(float_cast<std::int32_t>(1.5, float_cast_op::round)), !CHECK_CASTS);
+        }
+
+        TEST_CASE("Deterministic rounding is usable in constant expressions")
+        {
+            static_assert(float_cast<int>(2.5, float_cast_op::round_even) == 2, "ties round to even");
+            static_assert(float_cast<int>(-2.5, float_cast_op::round_half_down) == -2, "ties round towards zero");
+            CHECK_EQ(float_cast<int>(3.5F, float_cast_op::round_even), 4);
+        }
+    }
+
+    TEST_SUITE("float_cast_unchecked")
+    {
+        TEST_CASE("Every float rounds like <cmath>")
+        {
+            std::uint32_t first_bad = 0;
+            const std::uint64_t mismatches = check_float_patterns(first_bad);
+
+            CHECK_EQ(mismatches, 0U);
+            CHECK_EQ(first_bad, 0U);
+        }
+
+        TEST_CASE_TEMPLATE("Rounding is exact at every magnitude", T, float, double, long double)
+        {
+            check_every_magnitude<T>();
+        }
     }
 } //namespace tests
 } //namespace casts
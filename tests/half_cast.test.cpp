@@ -0,0 +1,288 @@
+#include "better_casts/half_cast.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    TEST_SUITE("half_cast_checked")
+    {
+        TEST_CASE("Float can be cast to float16")
+        {
+            CHECK_EQ(half_cast_checked<float16_t>(1.0F).bits, 0x3C00);
+            CHECK_EQ(half_cast_checked<float16_t>(-2.0F).bits, 0xC000);
+            CHECK_EQ(half_cast_checked<float16_t>(0.1F).bits, 0x2E66);
+            CHECK_EQ(half_cast_checked<float16_t>(65504.0F).bits, 0x7BFF);
+            CHECK_EQ(half_cast_checked<float16_t>(-0.0F).bits, 0x8000);
+        }
+
+        TEST_CASE("Float16 rounds to nearest even by default")
+        {
+            // 1 + 1.5 ulp
+            CHECK_EQ(half_cast_checked<float16_t>(1.00146484375F).bits, 0x3C02);
+            CHECK_EQ(half_cast_checked<float16_t>(1.00146484375F, half_cast_op::truncate).bits, 0x3C01);
+
+            // Subnormals: 2^-25 is a tie between zero and the smallest subnormal
+            CHECK_EQ(half_cast_checked<float16_t>(std::ldexp(1.0F, -24)).bits, 0x0001);
+            CHECK_EQ(half_cast_checked<float16_t>(std::ldexp(1.0F, -25)).bits, 0x0000);
+            CHECK_EQ(half_cast_checked<float16_t>(std::ldexp(1.5F, -25)).bits, 0x0001);
+            CHECK_EQ(half_cast_checked<float16_t>(std::ldexp(1.5F, -25), half_cast_op::truncate).bits, 0x0000);
+        }
+
+        TEST_CASE("Double is rounded once")
+        {
+            // Rounding through float first would land on a tie and round down to 1.0
+            const double val = 1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40);
+            CHECK_EQ(half_cast_checked<float16_t>(val).bits, 0x3C01);
+        }
+
+        TEST_CASE("Float can be cast to bfloat16")
+        {
+            CHECK_EQ(half_cast_checked<bfloat16_t>(1.0F).bits, 0x3F80);
+            CHECK_EQ(half_cast_checked<bfloat16_t>(1.005859375F).bits, 0x3F81);
+            CHECK_EQ(half_cast_checked<bfloat16_t>(1.005859375F, half_cast_op::truncate).bits, 0x3F80);
+
+            // Ties go to the even neighbour
+            CHECK_EQ(half_cast_checked<bfloat16_t>(1.00390625F).bits, 0x3F80);
+            CHECK_EQ(half_cast_checked<bfloat16_t>(1.01171875F).bits, 0x3F82);
+
+            CHECK_EQ(half_cast_checked<bfloat16_t>(std::numeric_limits<float>::max(), half_cast_op::truncate).bits,
+                0x7F7F);
+        }
+
+        TEST_CASE("Integers can be cast to half types")
+        {
+            CHECK_EQ(half_cast_checked<float16_t>(-1).bits, 0xBC00);
+            CHECK_EQ(half_cast_checked<float16_t>(std::uint8_t{ 200 }).bits, 0x5A40);
+            CHECK_EQ(half_cast_checked<float16_t>(2049).bits, 0x6800);
+            CHECK_EQ(half_cast_checked<float16_t>(2051).bits, 0x6802);
+            CHECK_EQ(half_cast_checked<float16_t>(65504).bits, 0x7BFF);
+            CHECK_EQ(half_cast_checked<bfloat16_t>((std::numeric_limits<std::int64_t>::min)()).bits, 0xDF00);
+        }
+
+#ifdef __SIZEOF_INT128__
+        TEST_CASE("128-bit integers can be cast to and from half types")
+        {
+            __extension__ using int128_t = __int128;
+
+            const int128_t big = int128_t{ 1 } << 100;
+
+            // The low bit lies below the 64 bits kept for rounding, but still breaks the tie
+            CHECK_EQ(half_cast_checked<bfloat16_t>(big).bits, 0x7180);
+            CHECK_EQ(half_cast_checked<bfloat16_t>(big + (int128_t{ 1 } << 92)).bits, 0x7180);
+            CHECK_EQ(half_cast_checked<bfloat16_t>(big + (int128_t{ 1 } << 92) + 1).bits, 0x7181);
+
+            CHECK(half_cast_checked<int128_t>(bfloat16_t{ 0x7180 }) == big);
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<float16_t>(big), float_cast_error);
+        }
+#endif
+
+        TEST_CASE("Half types can be cast to floating point")
+        {
+            CHECK_EQ(half_cast_checked<float>(float16_t{ 0x3C00 }), 1.0F);
+            CHECK_EQ(half_cast_checked<double>(float16_t{ 0xC000 }), -2.0);
+            CHECK_EQ(half_cast_checked<float>(float16_t{ 0x0001 }), std::ldexp(1.0F, -24));
+            CHECK_EQ(half_cast_checked<float>(bfloat16_t{ 0x3F80 }), 1.0F);
+            CHECK(std::isinf(half_cast_checked<float>(float16_t{ 0x7C00 })));
+            CHECK(std::isnan(half_cast_checked<float>(float16_t{ 0x7E00 })));
+        }
+
+        TEST_CASE("Half types can be cast to integers")
+        {
+            const float16_t one_and_half{ 0x3E00 };
+
+            CHECK_EQ(half_cast_checked<int>(one_and_half, float_cast_op::round), 2);
+            CHECK_EQ(half_cast_checked<int>(one_and_half, float_cast_op::truncate), 1);
+            CHECK_EQ(half_cast_checked<std::int16_t>(bfloat16_t{ 0xC2C8 }), std::int16_t{ -100 });
+
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<int>(float16_t{ 0x7C00 }), float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<std::int8_t>(float16_t{ 0x5A40 }), float_cast_error);
+        }
+
+        TEST_CASE("Half types can be cast to each other")
+        {
+            CHECK_EQ(half_cast_checked<bfloat16_t>(float16_t{ 0x3C00 }).bits, 0x3F80);
+            CHECK_EQ(half_cast_checked<float16_t>(bfloat16_t{ 0x4049 }).bits, 0x4248);
+
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<float16_t>(half_cast_checked<bfloat16_t>(1e10F)),
+                float_cast_error);
+        }
+
+        TEST_CASE("Cannot cast a value outside of the half range")
+        {
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<float16_t>(65520.0F), float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<float16_t>(-1e6), float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = half_cast_checked<float16_t>(70000), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = half_cast_checked<bfloat16_t>(std::numeric_limits<float>::max()), float_cast_error);
+
+            // Truncation only overflows once the value reaches the next power of two
+            CHECK_EQ(half_cast_checked<float16_t>(65535.0F, half_cast_op::truncate).bits, 0x7BFF);
+            REQUIRE_THROWS_AS(
+                std::ignore = half_cast_checked<float16_t>(65536.0F, half_cast_op::truncate), float_cast_error);
+        }
+
+        TEST_CASE("Cannot cast NaN or Infinity")
+        {
+            REQUIRE_THROWS_AS(
+                std::ignore = half_cast_checked<float16_t>(std::numeric_limits<float>::quiet_NaN()), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = half_cast_checked<bfloat16_t>(std::numeric_limits<double>::infinity()), float_cast_error);
+        }
+
+        TEST_CASE("Every half value survives a round trip through float")
+        {
+            for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+            {
+                const float16_t half{ static_cast<std::uint16_t>(bits) };
+                const bfloat16_t bhalf{ static_cast<std::uint16_t>(bits) };
+
+                const bool half_nan = (bits & 0x7C00U) == 0x7C00U && (bits & 0x03FFU) != 0;
+                const bool bhalf_nan = (bits & 0x7F80U) == 0x7F80U && (bits & 0x007FU) != 0;
+
+                if (!half_nan)
+                {
+                    REQUIRE_EQ(half_cast_unchecked<float16_t>(half_cast_unchecked<float>(half)).bits, half.bits);
+                }
+
+                if (!bhalf_nan)
+                {
+                    REQUIRE_EQ(half_cast_unchecked<bfloat16_t>(half_cast_unchecked<float>(bhalf)).bits, bhalf.bits);
+                }
+            }
+        }
+    }
+
+    TEST_SUITE("half_cast_unchecked")
+    {
+        TEST_CASE("Out of range values saturate according to the rounding mode")
+        {
+            CHECK_EQ(half_cast_unchecked<float16_t>(1e6F).bits, 0x7C00);
+            CHECK_EQ(half_cast_unchecked<float16_t>(-1e6F, half_cast_op::truncate).bits, 0xFBFF);
+            CHECK_EQ(half_cast_unchecked<float16_t>(std::numeric_limits<float>::infinity()).bits, 0x7C00);
+        }
+
+        TEST_CASE("NaN stays NaN")
+        {
+            const auto half = half_cast_unchecked<float16_t>(std::numeric_limits<float>::quiet_NaN());
+            const auto bhalf = half_cast_unchecked<bfloat16_t>(std::numeric_limits<double>::quiet_NaN());
+
+            CHECK_EQ(half.bits & 0x7E00, 0x7E00);
+            CHECK_EQ(bhalf.bits & 0x7FC0, 0x7FC0);
+        }
+    }
+
+    TEST_SUITE("half_cast_batch")
+    {
+        std::vector<float> batch_input()
+        {
+            std::vector<float> input;
+
+            for (int i = -500; i < 500; ++i)
+            {
+                input.push_back(static_cast<float>(i) * 61.37F + static_cast<float>(i % 7) * 0.001F);
+            }
+
+            input.push_back(65519.0F);
+            input.push_back(-0.0F);
+            return input;
+        }
+
+        TEST_CASE_TEMPLATE("Batch matches the scalar cast", T, float16_t, bfloat16_t)
+        {
+            const std::vector<float> input = batch_input();
+            std::vector<T> nearest(input.size());
+            std::vector<T> truncated(input.size());
+
+            half_cast_batch_checked(input.data(), input.size(), nearest.data());
+            half_cast_batch_checked(input.data(), input.size(), truncated.data(), half_cast_op::truncate);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                REQUIRE_EQ(nearest[i].bits, half_cast_checked<T>(input[i]).bits);
+                REQUIRE_EQ(truncated[i].bits, half_cast_checked<T>(input[i], half_cast_op::truncate).bits);
+            }
+
+            std::vector<float> widened(input.size());
+            half_cast_batch(nearest.data(), nearest.size(), widened.data());
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                REQUIRE_EQ(widened[i], half_cast_checked<float>(nearest[i]));
+            }
+        }
+
+        TEST_CASE("Batch keeps subnormal bfloat16 values")
+        {
+            const float subnormal = std::numeric_limits<float>::denorm_min() * 65536.0F;
+            std::vector<float> input(40, 1.0F);
+            input[3] = subnormal * 3.0F;
+            input[20] = -subnormal * 1.75F;
+            input[21] = std::numeric_limits<float>::min() - subnormal * 0.5F;
+
+            std::vector<bfloat16_t> output(input.size());
+            half_cast_batch_checked(input.data(), input.size(), output.data());
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                REQUIRE_EQ(output[i].bits, half_cast_checked<bfloat16_t>(input[i]).bits);
+            }
+
+            CHECK_EQ(output[3].bits, 0x0003);
+            CHECK_EQ(output[20].bits, 0x8002);
+            CHECK_EQ(output[21].bits, 0x0080);
+        }
+
+        TEST_CASE("Unchecked batch preserves NaN and Infinity")
+        {
+            std::vector<float> input(21, 1.0F);
+            input[2] = std::numeric_limits<float>::quiet_NaN();
+            input[5] = -std::numeric_limits<float>::infinity();
+            input[17] = 1e9F;
+
+            std::vector<float16_t> output(input.size());
+            half_cast_batch_unchecked(input.data(), input.size(), output.data());
+
+            CHECK_EQ(output[0].bits, 0x3C00);
+            CHECK_EQ(output[2].bits & 0x7E00, 0x7E00);
+            CHECK_EQ(output[5].bits, 0xFC00);
+            CHECK_EQ(output[17].bits, 0x7C00);
+        }
+
+        TEST_CASE("Batch reports invalid values")
+        {
+            std::vector<float> input(37, 0.25F);
+            std::vector<float16_t> output(input.size());
+            std::vector<bfloat16_t> boutput(input.size());
+
+            input[3] = 70000.0F;
+            REQUIRE_THROWS_AS(half_cast_batch_checked(input.data(), input.size(), output.data()), float_cast_error);
+            REQUIRE_NOTHROW(half_cast_batch_checked(input.data(), input.size(), boutput.data()));
+
+            input[3] = 0.25F;
+            input[35] = std::numeric_limits<float>::quiet_NaN();
+            REQUIRE_THROWS_AS(half_cast_batch_checked(input.data(), input.size(), output.data()), float_cast_error);
+            REQUIRE_THROWS_AS(half_cast_batch_checked(input.data(), input.size(), boutput.data()), float_cast_error);
+
+            input[35] = 0.25F;
+            input[20] = std::numeric_limits<float>::infinity();
+            REQUIRE_THROWS_AS(half_cast_batch_checked(input.data(), input.size(), boutput.data()), float_cast_error);
+        }
+    }
+} //namespace tests
+} //namespace casts
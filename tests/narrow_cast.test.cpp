@@ -10,6 +10,7 @@
 #endif
 
 #include <cstdint>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 
@@ -62,6 +63,47 @@ namespace tests
             const auto result = narrow_cast_checked<char>(test_val);
             CHECK_EQ(expected, result);
         }
+
+#ifdef __SIZEOF_INT128__
+        TEST_CASE("128-bit integers can be narrowed")
+        {
+            __extension__ using int128_t = __int128;
+            __extension__ using uint128_t = unsigned __int128;
+
+            static constexpr int128_t test_val0 = -42;
+            CHECK_EQ(narrow_cast_checked<std::int64_t>(test_val0), std::int64_t{ -42 });
+
+            static constexpr int128_t test_val1 = int128_t{ 1 } << 63;
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<std::int64_t>(test_val1), narrow_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<std::int64_t>(-test_val1 - 1), narrow_cast_error);
+
+            static constexpr uint128_t test_val2 = uint128_t{ 1 } << 64;
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<std::uint64_t>(test_val2), narrow_cast_error);
+            CHECK_EQ(narrow_cast_checked<std::uint64_t>(test_val2 - 1), (std::numeric_limits<std::uint64_t>::max)());
+        }
+#endif
+
+        TEST_CASE("Floating point values can be narrowed")
+        {
+            // The lower bound of a floating point type is lowest(), not min()
+            CHECK_EQ(narrow_cast_checked<float>(-2.0), -2.0F);
+            CHECK_EQ(narrow_cast_checked<float>(0.0), 0.0F);
+
+            static constexpr double test_val = 1e39;
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<float>(test_val), narrow_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = narrow_cast_checked<float>(-test_val), narrow_cast_error);
+        }
+    }
+
+    TEST_SUITE("narrow_cast")
+    {
+        TEST_CASE("Dispatch is noexcept only when the selected cast cannot fail")
+        {
+            CHECK_EQ(noexcept(narrow_cast<std::int32_t>(std::int64_t{ 1 })), !CHECK_CASTS);
+            CHECK(noexcept(narrow_cast<std::int64_t>(std::int64_t{ 1 })));
+            CHECK_EQ(noexcept(sign_cast<std::uint32_t>(1)), !CHECK_CASTS);
+            CHECK(noexcept(sign_cast<std::int64_t>(1U)));
+        }
     }
 } //namespace tests
 } //namespace casts
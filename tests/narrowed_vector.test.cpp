@@ -0,0 +1,171 @@
+#include "better_casts/narrowed_vector.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        template<typename T>
+        auto contents(const narrowed_vector<T>& vec) -> std::vector<T>
+        {
+            std::vector<T> result(vec.size());
+            vec.copy_to(0, vec.size(), result.data());
+            return result;
+        }
+    } // namespace
+
+    TEST_SUITE("narrowed_vector")
+    {
+        TEST_CASE("Values are stored at the smallest width they fit in")
+        {
+            narrowed_vector<std::int64_t> vec{ 1, -2, 127, -128 };
+            CHECK_EQ(vec.width(), 1);
+
+            vec.push_back(128);
+            CHECK_EQ(vec.width(), 2);
+
+            vec.push_back(std::numeric_limits<std::int32_t>::lowest());
+            CHECK_EQ(vec.width(), 4);
+
+            vec.push_back(std::int64_t{ 1 } << 40);
+            CHECK_EQ(vec.width(), 8);
+
+            // Widening keeps every element
+            const std::vector<std::int64_t> expected{
+                1, -2, 127, -128, 128, std::numeric_limits<std::int32_t>::lowest(), std::int64_t{ 1 } << 40
+            };
+            CHECK_EQ(contents(vec), expected);
+        }
+
+        TEST_CASE("Unsigned values use the whole range of each width")
+        {
+            narrowed_vector<std::uint32_t> vec{ 0, 255 };
+            CHECK_EQ(vec.width(), 1);
+
+            vec.push_back(65535);
+            CHECK_EQ(vec.width(), 2);
+
+            vec.push_back(65536);
+            CHECK_EQ(vec.width(), 4);
+            CHECK_EQ(vec[3], 65536U);
+        }
+
+        TEST_CASE("The width never exceeds the element type")
+        {
+            narrowed_vector<std::int16_t> vec{ (std::numeric_limits<std::int16_t>::min)() };
+
+            CHECK_EQ(vec.width(), sizeof(std::int16_t));
+            CHECK_EQ(vec[0], (std::numeric_limits<std::int16_t>::min)());
+        }
+
+        TEST_CASE("Bulk append matches push_back")
+        {
+            std::vector<std::int64_t> values;
+
+            for (std::int64_t idx = 0; idx < 10000; ++idx)
+            {
+                // Every block but the last fits in 16 bits
+                values.push_back(idx < 9000 ? (idx % 2 == 0 ? idx : -idx) : idx * 1000);
+            }
+
+            narrowed_vector<std::int64_t> bulk;
+            bulk.append(values.data(), 5000);
+            CHECK_EQ(bulk.width(), 2);
+
+            bulk.append(values.data() + 5000, values.size() - 5000);
+            CHECK_EQ(bulk.width(), 4);
+
+            narrowed_vector<std::int64_t> single;
+
+            for (const std::int64_t val : values)
+            {
+                single.push_back(val);
+            }
+
+            CHECK_EQ(single.width(), bulk.width());
+            CHECK_EQ(contents(bulk), values);
+            CHECK_EQ(contents(single), values);
+        }
+
+        TEST_CASE("Setting a value widens the storage if needed")
+        {
+            narrowed_vector<std::int64_t> vec{ 1, 2, 3 };
+
+            vec.set(1, -1000);
+            CHECK_EQ(vec.width(), 2);
+            const std::vector<std::int64_t> expected{ 1, -1000, 3 };
+            CHECK_EQ(contents(vec), expected);
+
+            vec.set(1, 4);
+            CHECK_EQ(vec.width(), 2);
+        }
+
+        TEST_CASE("shrink_to_fit narrows to the current values")
+        {
+            narrowed_vector<std::uint64_t> vec{ 1, 2, (std::numeric_limits<std::uint64_t>::max)() };
+            CHECK_EQ(vec.width(), 8);
+
+            vec.pop_back();
+            CHECK_EQ(vec.width(), 8);
+
+            vec.shrink_to_fit();
+            CHECK_EQ(vec.width(), 1);
+            CHECK_EQ(vec.storage_bytes(), vec.capacity());
+            const std::vector<std::uint64_t> expected{ 1, 2 };
+            CHECK_EQ(contents(vec), expected);
+
+            vec.clear();
+            CHECK(vec.empty());
+            CHECK_EQ(vec.storage_bytes(), 0);
+        }
+
+        TEST_CASE("visit exposes the stored elements")
+        {
+            const narrowed_vector<std::int64_t> vec{ 300, -5, 7 };
+            std::int64_t sum = 0;
+            std::size_t width = 0;
+
+            vec.visit(
+                [&](const auto* data, std::size_t size)
+                {
+                    width = sizeof(*data);
+
+                    for (std::size_t idx = 0; idx < size; ++idx)
+                    {
+                        sum += data[idx];
+                    }
+                });
+
+            CHECK_EQ(width, 2);
+            CHECK_EQ(sum, 302);
+        }
+
+        TEST_CASE("Ranges are copied out at the element type")
+        {
+            const narrowed_vector<std::int32_t> vec{ 5, -6, 70000, 8 };
+            std::int32_t output[2] = {};
+
+            vec.copy_to(1, 2, output);
+
+            CHECK_EQ(output[0], -6);
+            CHECK_EQ(output[1], 70000);
+            CHECK_EQ(vec.back(), 8);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,145 @@
+#include "better_casts.hpp"
+#include "better_casts/nullable_cast.hpp"
+#include "better_casts/parse_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+// Only built with exceptions disabled (see unit_tests_no_exceptions in tests/CMakeLists.txt)
+#ifndef HAS_EXCEPTIONS
+#  include <csignal>
+#  include <cstddef>
+#  include <cstdint>
+#  include <limits>
+#  include <string>
+#  include <sys/types.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#  include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        void exit_handler(const char* /*message*/)
+        {
+            _exit(1);
+        }
+
+        void returning_handler(const char* /*message*/) {}
+
+        /// Runs a failing cast in a child process with @p handler installed, and returns what it wrote to stderr.
+        /// @p signal receives the signal that terminated the child (0 if it exited).
+        template<typename Cast>
+        auto stderr_of_failure(cast_failure_handler handler, Cast cast, int& signal) -> std::string
+        {
+            int fds[2] = { -1, -1 };
+            REQUIRE_EQ(pipe(fds), 0);
+
+            const pid_t child = fork();
+            if (child == 0)
+            {
+                dup2(fds[1], STDERR_FILENO);
+                close(fds[0]);
+                close(fds[1]);
+                set_cast_failure_handler(handler);
+                cast();
+                _exit(0);
+            }
+
+            close(fds[1]);
+
+            std::string output;
+            char buffer[256];
+            ssize_t size = 0;
+            while ((size = read(fds[0], buffer, sizeof(buffer))) > 0)
+            {
+                output.append(buffer, static_cast<std::size_t>(size));
+            }
+
+            close(fds[0]);
+
+            int status = 0;
+            waitpid(child, &status, 0);
+            signal = WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+            return output;
+        }
+    } // namespace
+
+    TEST_SUITE("exceptions disabled")
+    {
+        TEST_CASE("Checked casts report failures to the failure handler")
+        {
+            CHECK_EQ(failure_message([] { (void)narrow_cast_checked<std::int8_t>(300); }),
+                "narrow_cast failed: input exceeded max value for output type");
+            CHECK_EQ(failure_message([] { (void)sign_cast_checked<unsigned>(-1); }),
+                "sign_cast failed: cannot cast a negative number to unsigned");
+            CHECK_EQ(failure_message([] { (void)float_cast_checked<int>(std::numeric_limits<double>::quiet_NaN()); }),
+                "float_cast failed: cannot cast from NaN");
+            CHECK_EQ(failure_message(
+                         []
+                         {
+                             const char text[] = "256";
+                             (void)parse_cast_checked<std::uint8_t>(text, text + 3);
+                         }),
+                "parse_cast failed: input exceeded the range of the output type");
+        }
+
+        TEST_CASE("Successful casts do not call the failure handler")
+        {
+            CHECK_EQ(failure_message([] { (void)narrow_cast_checked<std::int8_t>(100); }), "");
+            CHECK_EQ(failure_message([] { (void)float_cast_checked<int>(2.5); }), "");
+        }
+
+        TEST_CASE("Without a handler, the message is written to stderr and the program aborts")
+        {
+            int signal = 0;
+            const std::string output =
+                stderr_of_failure(nullptr, [] { (void)narrow_cast_checked<std::int8_t>(-300); }, signal);
+
+            CHECK_EQ(signal, SIGABRT);
+            CHECK_EQ(output, "narrow_cast failed: input exceeded min value for output type\n");
+        }
+
+        TEST_CASE("A handler that returns still aborts the program")
+        {
+            int signal = 0;
+            const std::string output =
+                stderr_of_failure(&returning_handler, [] { (void)sign_cast_checked<unsigned>(-1); }, signal);
+
+            CHECK_EQ(signal, SIGABRT);
+            CHECK_EQ(output, "sign_cast failed: cannot cast a negative number to unsigned\n");
+        }
+
+        TEST_CASE("Setting a handler returns the previous one")
+        {
+            CHECK_EQ(set_cast_failure_handler(&exit_handler), nullptr);
+            CHECK_EQ(set_cast_failure_handler(nullptr), &exit_handler);
+        }
+
+        TEST_CASE("The non-throwing APIs report failures as values")
+        {
+            const char text[] = "1x";
+            const parse_result<int> parsed = try_parse_cast<int>(text, text + 2);
+            CHECK_EQ(parsed.ec, parse_errc::invalid_argument);
+
+            const std::vector<double> input = { 1.5, std::numeric_limits<double>::infinity(), -3.0 };
+            std::vector<std::int32_t> output(input.size());
+            std::vector<std::uint8_t> validity(validity_bitmap_size(input.size()));
+
+            CHECK_EQ(float_cast_batch_nullable(input.data(), input.size(), output.data(), validity.data()), 1U);
+            CHECK_EQ(validity[0], 0b101U);
+        }
+    }
+} //namespace tests
+} //namespace casts
+#endif
@@ -0,0 +1,251 @@
+#include "better_casts/norm_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        /// Test values: a ramp past both ends of the snorm range, so both kinds clamp on either side.
+        template<typename F>
+        auto ramp(std::size_t count) -> std::vector<F>
+        {
+            std::vector<F> values(count);
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                values[idx] = static_cast<F>(-1.2 + 2.4 * static_cast<double>(idx) / static_cast<double>(count));
+            }
+
+            return values;
+        }
+
+        /// Checks a batch cast to normalized integers against the scalar cast, for a float and a double ramp.
+        template<typename T, typename Batch, typename Scalar>
+        void check_batch(Batch batch, Scalar scalar)
+        {
+            // Odd sizes leave a scalar tail after the vector blocks
+            const std::vector<float> floats = ramp<float>(1003);
+            const std::vector<double> doubles = ramp<double>(517);
+            std::vector<T> from_floats(floats.size());
+            std::vector<T> from_doubles(doubles.size());
+
+            batch(floats.data(), floats.size(), from_floats.data());
+            batch(doubles.data(), doubles.size(), from_doubles.data());
+
+            for (std::size_t idx = 0; idx < floats.size(); ++idx)
+            {
+                CHECK_EQ(from_floats[idx], scalar(floats[idx]));
+            }
+
+            for (std::size_t idx = 0; idx < doubles.size(); ++idx)
+            {
+                CHECK_EQ(from_doubles[idx], scalar(doubles[idx]));
+            }
+        }
+    } // namespace
+
+    TEST_SUITE("unorm_cast")
+    {
+        TEST_CASE("Values in [0, 1] are scaled and rounded to nearest")
+        {
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(0.0F), std::uint8_t{ 0 });
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(1.0F), std::uint8_t{ 255 });
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(0.5F), std::uint8_t{ 128 });
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(0.25), std::uint8_t{ 64 });
+            CHECK_EQ(unorm_cast_checked<std::uint16_t>(0.5), std::uint16_t{ 32768 });
+            CHECK_EQ(unorm_cast_checked<std::uint16_t>(1.0F), std::uint16_t{ 65535 });
+
+            // 2.5 / 255 scales to exactly 2.5 in double, which is a tie
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(2.5 / 255.0), std::uint8_t{ 2 });
+        }
+
+        TEST_CASE("Values outside of [0, 1] are clamped")
+        {
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(-0.5F), std::uint8_t{ 0 });
+            CHECK_EQ(unorm_cast_checked<std::uint8_t>(7.0F), std::uint8_t{ 255 });
+            CHECK_EQ(
+                unorm_cast_checked<std::uint16_t>(std::numeric_limits<double>::infinity()), std::uint16_t{ 65535 });
+            CHECK_EQ(unorm_cast_checked<std::uint16_t>(-std::numeric_limits<float>::infinity()), std::uint16_t{ 0 });
+        }
+
+        TEST_CASE("NaN is an error when checked and 0 when unchecked")
+        {
+            REQUIRE_THROWS_AS(std::ignore = unorm_cast_checked<std::uint8_t>(std::numeric_limits<float>::quiet_NaN()),
+                float_cast_error);
+            CHECK_EQ(unorm_cast_unchecked<std::uint8_t>(std::numeric_limits<float>::quiet_NaN()), std::uint8_t{ 0 });
+        }
+
+        TEST_CASE("Every unorm value converts back exactly and round trips")
+        {
+            for (int val = 0; val < 256; ++val)
+            {
+                const auto sample = static_cast<std::uint8_t>(val);
+
+                CHECK_EQ(unorm_cast<float>(sample), static_cast<float>(val) / 255.0F);
+                CHECK_EQ(unorm_cast<double>(sample), static_cast<double>(val) / 255.0);
+                CHECK_EQ(unorm_cast<std::uint8_t>(unorm_cast<float>(sample)), sample);
+            }
+
+            for (int val = 0; val < 65536; val += 3)
+            {
+                const auto sample = static_cast<std::uint16_t>(val);
+
+                CHECK_EQ(unorm_cast<float>(sample), static_cast<float>(val) / 65535.0F);
+                CHECK_EQ(unorm_cast<std::uint16_t>(unorm_cast<float>(sample)), sample);
+            }
+        }
+
+        TEST_CASE("Casts are usable in constant expressions")
+        {
+            static_assert(unorm_cast_unchecked<std::uint8_t>(1.0F) == 255, "unorm_cast must be constexpr");
+            static_assert(unorm_cast<float>(std::uint8_t{ 51 }) == 0.2F, "unorm_cast must be constexpr");
+            static_assert(snorm_cast_unchecked<std::int8_t>(-1.0) == -127, "snorm_cast must be constexpr");
+            static_assert(snorm_cast<double>(std::int8_t{ -128 }) == -1.0, "snorm_cast must be constexpr");
+        }
+    }
+
+    TEST_SUITE("snorm_cast")
+    {
+        TEST_CASE("Values in [-1, 1] are scaled and rounded to nearest")
+        {
+            CHECK_EQ(snorm_cast_checked<std::int8_t>(0.0F), std::int8_t{ 0 });
+            CHECK_EQ(snorm_cast_checked<std::int8_t>(1.0F), std::int8_t{ 127 });
+            CHECK_EQ(snorm_cast_checked<std::int8_t>(-1.0F), std::int8_t{ -127 });
+            CHECK_EQ(snorm_cast_checked<std::int8_t>(-0.5), std::int8_t{ -64 });
+            CHECK_EQ(snorm_cast_checked<std::int16_t>(0.5F), std::int16_t{ 16384 });
+            CHECK_EQ(snorm_cast_checked<std::int16_t>(-1.0), std::int16_t{ -32767 });
+        }
+
+        TEST_CASE("Values outside of [-1, 1] are clamped")
+        {
+            CHECK_EQ(snorm_cast_checked<std::int8_t>(-3.0F), std::int8_t{ -127 });
+            CHECK_EQ(snorm_cast_checked<std::int8_t>(3.0F), std::int8_t{ 127 });
+            CHECK_EQ(
+                snorm_cast_checked<std::int16_t>(-std::numeric_limits<double>::infinity()), std::int16_t{ -32767 });
+        }
+
+        TEST_CASE("NaN is an error when checked and 0 when unchecked")
+        {
+            REQUIRE_THROWS_AS(std::ignore = snorm_cast_checked<std::int16_t>(std::numeric_limits<double>::quiet_NaN()),
+                float_cast_error);
+            CHECK_EQ(snorm_cast_unchecked<std::int16_t>(std::numeric_limits<float>::quiet_NaN()), std::int16_t{ 0 });
+        }
+
+        TEST_CASE("Every snorm value converts back exactly and round trips")
+        {
+            CHECK_EQ(snorm_cast<float>(std::int8_t{ -128 }), -1.0F);
+            CHECK_EQ(snorm_cast<float>(std::int16_t{ -32768 }), -1.0F);
+
+            for (int val = -127; val < 128; ++val)
+            {
+                const auto sample = static_cast<std::int8_t>(val);
+
+                CHECK_EQ(snorm_cast<float>(sample), static_cast<float>(val) / 127.0F);
+                CHECK_EQ(snorm_cast<std::int8_t>(snorm_cast<float>(sample)), sample);
+            }
+
+            for (int val = -32767; val < 32768; val += 3)
+            {
+                const auto sample = static_cast<std::int16_t>(val);
+
+                CHECK_EQ(snorm_cast<double>(sample), static_cast<double>(val) / 32767.0);
+                CHECK_EQ(snorm_cast<std::int16_t>(snorm_cast<float>(sample)), sample);
+            }
+        }
+    }
+
+    TEST_SUITE("norm_cast_batch")
+    {
+        TEST_CASE("Batches match the scalar casts")
+        {
+            check_batch<std::uint8_t>([](const auto* in, std::size_t count, std::uint8_t* out)
+                { unorm_cast_batch_checked(in, count, out); },
+                [](auto val) { return unorm_cast_unchecked<std::uint8_t>(val); });
+            check_batch<std::uint16_t>([](const auto* in, std::size_t count, std::uint16_t* out)
+                { unorm_cast_batch_checked(in, count, out); },
+                [](auto val) { return unorm_cast_unchecked<std::uint16_t>(val); });
+            check_batch<std::int8_t>([](const auto* in, std::size_t count, std::int8_t* out)
+                { snorm_cast_batch_checked(in, count, out); },
+                [](auto val) { return snorm_cast_unchecked<std::int8_t>(val); });
+            check_batch<std::int16_t>([](const auto* in, std::size_t count, std::int16_t* out)
+                { snorm_cast_batch_unchecked(in, count, out); },
+                [](auto val) { return snorm_cast_unchecked<std::int16_t>(val); });
+        }
+
+        TEST_CASE("Batches convert back like the scalar casts")
+        {
+            std::vector<std::uint8_t> bytes(1027);
+            std::vector<std::int16_t> words(1027);
+
+            for (std::size_t idx = 0; idx < bytes.size(); ++idx)
+            {
+                bytes[idx] = static_cast<std::uint8_t>(idx * 7);
+                words[idx] = static_cast<std::int16_t>(idx * 67);
+            }
+
+            std::vector<float> floats(bytes.size());
+            std::vector<double> doubles(words.size());
+
+            unorm_cast_batch(bytes.data(), bytes.size(), floats.data());
+            snorm_cast_batch(words.data(), words.size(), doubles.data());
+
+            for (std::size_t idx = 0; idx < bytes.size(); ++idx)
+            {
+                CHECK_EQ(floats[idx], unorm_cast<float>(bytes[idx]));
+                CHECK_EQ(doubles[idx], snorm_cast<double>(words[idx]));
+            }
+
+            snorm_cast_batch(words.data(), words.size(), floats.data());
+
+            for (std::size_t idx = 0; idx < words.size(); ++idx)
+            {
+                CHECK_EQ(floats[idx], snorm_cast<float>(words[idx]));
+            }
+        }
+
+        TEST_CASE("RGBA pixels convert channel by channel")
+        {
+            const std::vector<float> pixels = { 1.0F, 0.5F, 0.0F, 1.0F, -0.1F, 0.2F, 1.5F, 0.75F };
+            const std::vector<std::uint8_t> expected = { 255, 128, 0, 255, 0, 51, 255, 191 };
+            std::vector<std::uint8_t> rgba(pixels.size());
+
+            unorm_cast_batch(pixels.data(), pixels.size(), rgba.data());
+
+            CHECK_EQ(rgba, expected);
+        }
+
+        TEST_CASE("Batch reports the index of a NaN")
+        {
+            std::vector<float> input = ramp<float>(30);
+            input[17] = std::numeric_limits<float>::quiet_NaN();
+            std::vector<std::int8_t> output(input.size());
+
+            CHECK_EQ(failure_message([&] { snorm_cast_batch_checked(input.data(), input.size(), output.data()); }),
+                "snorm_cast failed: cannot cast from NaN (input at index 17)");
+
+            snorm_cast_batch_unchecked(input.data(), input.size(), output.data());
+            CHECK_EQ(output[17], 0);
+            CHECK_EQ(output[0], -127);
+        }
+    }
+} //namespace tests
+} //namespace casts
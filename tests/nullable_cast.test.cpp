@@ -0,0 +1,173 @@
+#include "better_casts/nullable_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        /// Compares a nullable batch against the checked scalar cast of every element.
+        template<typename To, typename From, typename Cast, typename Checked>
+        void check_against_scalar(const std::vector<From>& input, Cast batch, Checked checked)
+        {
+            // The checked cast of each element: its value, or null (and a zero output) if it fails
+            std::vector<To> expected(input.size(), To{ 0 });
+            std::vector<bool> expected_valid(input.size(), true);
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                expected_valid[idx] = failure_message([&] { (void)checked(input[idx]); }).empty();
+
+                if (expected_valid[idx])
+                {
+                    expected[idx] = checked(input[idx]);
+                }
+            }
+
+            // Every prefix length, so the vector kernels, the scalar loop and the partial last byte are all covered
+            for (std::size_t count = 0; count <= input.size(); ++count)
+            {
+                std::vector<To> output(count, To{ 1 });
+                std::vector<std::uint8_t> validity(validity_bitmap_size(count), 0xFF);
+
+                const std::size_t nulls = batch(input.data(), count, output.data(), validity.data());
+
+                std::size_t expected_nulls = 0;
+                for (std::size_t idx = 0; idx < count; ++idx)
+                {
+                    if (!expected_valid[idx])
+                    {
+                        ++expected_nulls;
+                    }
+
+                    REQUIRE_EQ(is_valid(validity.data(), idx), expected_valid[idx]);
+                    REQUIRE_EQ(output[idx], expected[idx]);
+                }
+
+                REQUIRE_EQ(nulls, expected_nulls);
+
+                if (count % 8 != 0)
+                {
+                    CHECK_EQ(validity.back() >> (count % 8), 0);
+                }
+            }
+        }
+    } // namespace
+
+    TEST_SUITE("narrow_cast_batch_nullable")
+    {
+        TEST_CASE("Values that do not fit become null")
+        {
+            std::vector<std::int64_t> input;
+            for (std::int64_t idx = 0; idx < 45; ++idx)
+            {
+                input.push_back((idx % 2 == 0 ? -1 : 1) * idx * idx * 2'000'000);
+            }
+            input[3] = (std::numeric_limits<std::int32_t>::max)();
+            input[4] = (std::numeric_limits<std::int32_t>::min)();
+            input[5] = std::int64_t{ 1 } << 40U;
+
+            check_against_scalar<std::int32_t>(
+                input,
+                [](const std::int64_t* in, std::size_t count, std::int32_t* out, std::uint8_t* validity)
+                { return narrow_cast_batch_nullable(in, count, out, validity); },
+                [](std::int64_t val) { return narrow_cast_checked<std::int32_t>(val); });
+
+            check_against_scalar<std::int8_t>(
+                input,
+                [](const std::int64_t* in, std::size_t count, std::int8_t* out, std::uint8_t* validity)
+                { return narrow_cast_batch_nullable(in, count, out, validity); },
+                [](std::int64_t val) { return narrow_cast_checked<std::int8_t>(val); });
+        }
+        TEST_CASE("Floating point values are null exactly when narrow_cast_checked throws")
+        {
+            const std::vector<double> input{ -1.5, std::numeric_limits<double>::quiet_NaN(), 1e300, -1e300, 0.25 };
+            std::vector<float> output(input.size());
+            std::vector<std::uint8_t> validity(validity_bitmap_size(input.size()));
+
+            CHECK_EQ(narrow_cast_batch_nullable(input.data(), input.size(), output.data(), validity.data()), 2);
+
+            // NaN passes through, as it does for narrow_cast_checked
+            CHECK(is_valid(validity.data(), 1));
+            CHECK(std::isnan(output[1]));
+            CHECK(std::isnan(narrow_cast_checked<float>(input[1])));
+
+            CHECK(is_valid(validity.data(), 0));
+            CHECK_EQ(output[0], -1.5F);
+            CHECK_FALSE(is_valid(validity.data(), 2));
+            CHECK_FALSE(is_valid(validity.data(), 3));
+            CHECK_EQ(output[3], 0.0F);
+        }
+    }
+
+    TEST_SUITE("float_cast_batch_nullable")
+    {
+        TEST_CASE("Float values that cannot be cast become null")
+        {
+            std::vector<float> input;
+            for (int idx = 0; idx < 45; ++idx)
+            {
+                input.push_back(static_cast<float>((idx % 2 == 0 ? -1 : 1) * idx * idx) * 1.3e6F + 0.5F);
+            }
+            input[2] = std::numeric_limits<float>::quiet_NaN();
+            input[9] = std::numeric_limits<float>::infinity();
+            input[10] = 2147483520.0F;
+            input[11] = -2147483648.0F;
+            input[12] = 2147483648.0F;
+
+            check_against_scalar<std::int32_t>(
+                input,
+                [](const float* in, std::size_t count, std::int32_t* out, std::uint8_t* validity)
+                { return float_cast_batch_nullable(in, count, out, validity, float_cast_op::round); },
+                [](float val) { return float_cast_checked<std::int32_t>(val, float_cast_op::round); });
+
+            check_against_scalar<std::int16_t>(
+                input,
+                [](const float* in, std::size_t count, std::int16_t* out, std::uint8_t* validity)
+                { return float_cast_batch_nullable(in, count, out, validity, float_cast_op::floor); },
+                [](float val) { return float_cast_checked<std::int16_t>(val, float_cast_op::floor); });
+        }
+
+        TEST_CASE("Double values that cannot be cast become null")
+        {
+            std::vector<double> input;
+            for (int idx = 0; idx < 45; ++idx)
+            {
+                input.push_back(static_cast<double>((idx % 2 == 0 ? -1 : 1) * idx * idx) * 1.1e6 - 0.5);
+            }
+            input[1] = -std::numeric_limits<double>::infinity();
+            input[6] = 2147483647.4;
+            input[7] = 2147483647.5;
+            input[8] = -2147483648.5;
+
+            check_against_scalar<std::int32_t>(
+                input,
+                [](const double* in, std::size_t count, std::int32_t* out, std::uint8_t* validity)
+                { return float_cast_batch_nullable(in, count, out, validity, float_cast_op::round); },
+                [](double val) { return float_cast_checked<std::int32_t>(val, float_cast_op::round); });
+
+            check_against_scalar<std::int32_t>(
+                input,
+                [](const double* in, std::size_t count, std::int32_t* out, std::uint8_t* validity)
+                { return float_cast_batch_nullable(in, count, out, validity, float_cast_op::truncate); },
+                [](double val) { return float_cast_checked<std::int32_t>(val, float_cast_op::truncate); });
+        }
+    }
+} //namespace tests
+} //namespace casts
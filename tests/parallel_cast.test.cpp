@@ -0,0 +1,272 @@
+#include "better_casts/parallel_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        /// Executor running the workers as std::async tasks, standing in for a user-supplied thread pool.
+        struct async_executor
+        {
+            unsigned workers;
+            std::atomic<unsigned>* calls;
+
+            auto concurrency() const noexcept -> unsigned { return workers; }
+
+            void operator()(unsigned count, const std::function<void(unsigned)>& task) const
+            {
+                std::vector<std::future<void>> futures;
+
+                for (unsigned worker = 0; worker < count; ++worker)
+                {
+                    futures.push_back(std::async(std::launch::async, task, worker));
+                }
+
+                for (std::future<void>& future : futures)
+                {
+                    future.get();
+                }
+
+                calls->fetch_add(1);
+            }
+        };
+
+        /// Enough elements for several chunks of every input type, and a partial last chunk.
+        constexpr std::size_t large = (1U << 20U) + 37;
+
+        auto make_input(std::size_t count) -> std::vector<float>
+        {
+            std::vector<float> input(count);
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                input[idx] = static_cast<float>(static_cast<int>(idx % 2001) - 1000) / 1024.0F;
+            }
+
+            return input;
+        }
+    } // namespace
+
+    TEST_SUITE("parallel batch casts")
+    {
+        TEST_CASE("Fixed-point batch matches the sequential cast")
+        {
+            const std::vector<float> input = make_input(large);
+            std::vector<std::int32_t> expected(input.size());
+            std::vector<std::int32_t> output(input.size());
+
+            fixed_cast_batch_checked<q31>(input.data(), input.size(), expected.data(), float_cast_op::round);
+
+            for (unsigned threads : { 1U, 2U, 4U, 7U })
+            {
+                std::fill(output.begin(), output.end(), 0);
+                fixed_cast_batch_checked<q31>(
+                    thread_executor{ threads }, input.data(), input.size(), output.data(), float_cast_op::round);
+                CHECK(output == expected);
+
+                std::fill(output.begin(), output.end(), 0);
+                fixed_cast_batch_unchecked<q31>(
+                    thread_executor{ threads }, input.data(), input.size(), output.data(), float_cast_op::round);
+                CHECK(output == expected);
+            }
+        }
+
+        TEST_CASE("Lowest failing index is reported regardless of scheduling")
+        {
+            std::vector<float> input = make_input(large);
+            std::vector<std::int16_t> output(input.size());
+
+            // One error near the end of the first chunk, and more in later chunks that are likely to fail first
+            input[65535] = 2.0F;
+            input[300000] = std::numeric_limits<float>::quiet_NaN();
+            input[large - 1] = -2.0F;
+
+            for (unsigned threads : { 1U, 4U, 16U })
+            {
+                for (int run = 0; run < 4; ++run)
+                {
+                    const std::string message = failure_message(
+                        [&]
+                        {
+                            fixed_cast_batch_checked<q15>(
+                                thread_executor{ threads }, input.data(), input.size(), output.data());
+                        });
+                    CHECK_EQ(message,
+                        "fixed_cast failed: input at index 65535 is NaN, Infinity or exceeds the range of the output "
+                        "type");
+                }
+            }
+
+            input[65535] = 0.0F;
+            const std::string message = failure_message(
+                [&]
+                { fixed_cast_batch_checked<q15>(thread_executor{ 4 }, input.data(), input.size(), output.data()); });
+            CHECK_EQ(message,
+                "fixed_cast failed: input at index 300000 is NaN, Infinity or exceeds the range of the output type");
+        }
+
+        TEST_CASE("Quantized batch matches the sequential cast and reports NaN")
+        {
+            static constexpr quant_params params{ 0.01F, 3 };
+
+            std::vector<float> input = make_input(large);
+            std::vector<std::int8_t> expected(input.size());
+            std::vector<std::int8_t> output(input.size());
+
+            quantize_cast_batch_checked(input.data(), input.size(), expected.data(), params);
+            quantize_cast_batch_checked(thread_executor{ 4 }, input.data(), input.size(), output.data(), params);
+            CHECK(output == expected);
+
+            input[large - 100] = std::numeric_limits<float>::quiet_NaN();
+            const std::string message = failure_message(
+                [&]
+                {
+                    quantize_cast_batch_checked(
+                        thread_executor{ 4 }, input.data(), input.size(), output.data(), params);
+                });
+            CHECK_EQ(message, "quantize_cast failed: cannot cast from NaN (input at index 1048513)");
+        }
+
+        TEST_CASE("Half batch matches the sequential cast and rethrows the first error")
+        {
+            std::vector<float> input = make_input(large);
+            std::vector<float16_t> expected(input.size());
+            std::vector<float16_t> output(input.size());
+
+            half_cast_batch_checked(input.data(), input.size(), expected.data());
+            half_cast_batch_checked(thread_executor{ 4 }, input.data(), input.size(), output.data());
+
+            bool same = true;
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                same &= output[idx].bits == expected[idx].bits;
+            }
+            CHECK(same);
+
+            input[200000] = 1e6F;
+            REQUIRE_THROWS_AS(
+                half_cast_batch_checked(thread_executor{ 4 }, input.data(), input.size(), output.data()),
+                float_cast_error);
+            REQUIRE_NOTHROW(half_cast_batch_unchecked(thread_executor{ 4 }, input.data(), input.size(), output.data()));
+        }
+
+        TEST_CASE("Duration batch matches the sequential cast and reports the global index")
+        {
+            std::vector<std::chrono::microseconds> input(large);
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                input[idx] = std::chrono::microseconds{ static_cast<std::int64_t>(idx) * 1999 };
+            }
+
+            std::vector<std::chrono::duration<std::int32_t, std::milli>> expected(input.size());
+            std::vector<std::chrono::duration<std::int32_t, std::milli>> output(input.size());
+
+            duration_narrow_cast_batch_checked(input.data(), input.size(), expected.data());
+            duration_narrow_cast_batch_checked(thread_executor{ 4 }, input.data(), input.size(), output.data());
+            CHECK(output == expected);
+
+            input[500000] = std::chrono::microseconds{ std::int64_t{ 1 } << 50U };
+            const std::string message = failure_message(
+                [&]
+                {
+                    duration_narrow_cast_batch_checked(
+                        thread_executor{ 4 }, input.data(), input.size(), output.data());
+                });
+            CHECK_EQ(
+                message, "duration_narrow_cast failed: input at index 500000 exceeded the range of the output type");
+        }
+
+        TEST_CASE("Nullable batches write whole validity bytes per chunk")
+        {
+            std::vector<std::int64_t> ints(large);
+            for (std::size_t idx = 0; idx < ints.size(); ++idx)
+            {
+                ints[idx] = idx % 7 == 0 ? std::int64_t{ 1 } << 40U : static_cast<std::int64_t>(idx);
+            }
+
+            std::vector<std::int32_t> expected(ints.size());
+            std::vector<std::int32_t> output(ints.size());
+            std::vector<std::uint8_t> expected_validity(validity_bitmap_size(ints.size()));
+            std::vector<std::uint8_t> validity(validity_bitmap_size(ints.size()));
+
+            const std::size_t expected_nulls =
+                narrow_cast_batch_nullable(ints.data(), ints.size(), expected.data(), expected_validity.data());
+            const std::size_t nulls = narrow_cast_batch_nullable(
+                thread_executor{ 4 }, ints.data(), ints.size(), output.data(), validity.data());
+            CHECK_EQ(nulls, expected_nulls);
+            CHECK(output == expected);
+            CHECK(validity == expected_validity);
+
+            const std::vector<float> floats = make_input(large);
+            std::vector<std::int16_t> rounded(floats.size());
+            std::vector<std::int16_t> expected_rounded(floats.size());
+
+            const std::size_t expected_float_nulls = float_cast_batch_nullable(floats.data(), floats.size(),
+                expected_rounded.data(), expected_validity.data(), float_cast_op::round);
+            const std::size_t float_nulls = float_cast_batch_nullable(thread_executor{ 3 }, floats.data(),
+                floats.size(), rounded.data(), validity.data(), float_cast_op::round);
+            CHECK_EQ(float_nulls, expected_float_nulls);
+            CHECK(rounded == expected_rounded);
+            CHECK(validity == expected_validity);
+        }
+
+        TEST_CASE("User-supplied executors run the workers")
+        {
+            std::atomic<unsigned> calls{ 0 };
+            std::vector<float> input = make_input(large);
+            std::vector<std::int32_t> expected(input.size());
+            std::vector<std::int32_t> output(input.size());
+
+            fixed_cast_batch_checked<q31>(input.data(), input.size(), expected.data());
+            fixed_cast_batch_checked<q31>(async_executor{ 3, &calls }, input.data(), input.size(), output.data());
+            CHECK(output == expected);
+            CHECK_EQ(calls.load(), 1U);
+
+            input[123456] = std::numeric_limits<float>::infinity();
+            const std::string message = failure_message(
+                [&]
+                {
+                    fixed_cast_batch_checked<q31>(
+                        async_executor{ 3, &calls }, input.data(), input.size(), output.data());
+                });
+            CHECK_EQ(message,
+                "fixed_cast failed: input at index 123456 is NaN, Infinity or exceeds the range of the output type");
+        }
+
+        TEST_CASE("Small and empty inputs run on the calling thread")
+        {
+            std::atomic<unsigned> calls{ 0 };
+            const std::vector<float> input{ 0.5F, -0.25F, 0.125F };
+            std::vector<std::int16_t> output(input.size());
+
+            fixed_cast_batch_checked<q15>(async_executor{ 8, &calls }, input.data(), input.size(), output.data());
+            fixed_cast_batch_checked<q15>(async_executor{ 8, &calls }, input.data(), 0, output.data());
+            CHECK_EQ(calls.load(), 0U);
+            CHECK_EQ(output[0], std::int16_t{ 16384 });
+            CHECK_EQ(output[1], std::int16_t{ -8192 });
+        }
+    }
+} // namespace tests
+} // namespace casts
@@ -0,0 +1,205 @@
+#include "better_casts/parse_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        template<typename To>
+        auto parse_str(const std::string& text) -> To
+        {
+            return parse_cast_checked<To>(text.data(), text.data() + text.size());
+        }
+
+        template<typename To>
+        auto try_parse_str(const std::string& text) -> parse_result<To>
+        {
+            return try_parse_cast<To>(text.data(), text.data() + text.size());
+        }
+    } // namespace
+
+    TEST_SUITE("parse_cast")
+    {
+        TEST_CASE("Valid integers can be parsed")
+        {
+            CHECK_EQ(parse_str<int>("0"), 0);
+            CHECK_EQ(parse_str<int>("-0"), 0);
+            CHECK_EQ(parse_str<int>("12345"), 12345);
+            CHECK_EQ(parse_str<int>("-12345"), -12345);
+            CHECK_EQ(parse_str<std::uint32_t>("0000000000000000000000042"), 42U);
+            CHECK_EQ(parse_str<std::uint64_t>("1234567890123456789"), 1234567890123456789ULL);
+        }
+
+        TEST_CASE("Range limits are exact")
+        {
+            CHECK_EQ(parse_str<std::int8_t>("127"), std::int8_t{ 127 });
+            CHECK_EQ(parse_str<std::int8_t>("-128"), std::int8_t{ -128 });
+            CHECK_EQ(parse_str<std::uint8_t>("255"), std::uint8_t{ 255 });
+            CHECK_EQ(parse_str<std::int64_t>("-9223372036854775808"), (std::numeric_limits<std::int64_t>::min)());
+            CHECK_EQ(parse_str<std::uint64_t>("18446744073709551615"), (std::numeric_limits<std::uint64_t>::max)());
+
+            REQUIRE_THROWS_AS(std::ignore = parse_str<std::int8_t>("128"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<std::int8_t>("-129"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<std::uint8_t>("256"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<std::int64_t>("9223372036854775808"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<std::uint64_t>("18446744073709551616"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<std::uint64_t>("99999999999999999999"), parse_cast_error);
+        }
+
+        TEST_CASE("Malformed input is rejected")
+        {
+            REQUIRE_THROWS_AS(std::ignore = parse_str<int>(""), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<int>("-"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<int>("+1"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<int>(" 1"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<int>("12a"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<int>("1234567a"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_str<unsigned>("-1"), parse_cast_error);
+        }
+
+        TEST_CASE("try_parse_cast reports errors without throwing")
+        {
+            const auto result0 = try_parse_str<std::int16_t>("-300");
+            CHECK(result0);
+            CHECK_EQ(result0.value, std::int16_t{ -300 });
+
+            const auto result1 = try_parse_str<std::int16_t>("40000");
+            CHECK_FALSE(result1);
+            CHECK_EQ(result1.ec, parse_errc::result_out_of_range);
+
+            // Syntax errors win over range errors
+            const auto result2 = try_parse_str<std::int16_t>("4000000000000000000000x");
+            CHECK_EQ(result2.ec, parse_errc::invalid_argument);
+        }
+
+        TEST_CASE("Unchecked parsing matches checked parsing for valid input")
+        {
+            const std::string text = "-1234567890123";
+
+            const auto result = parse_cast_unchecked<std::int64_t>(text.data(), text.data() + text.size());
+            CHECK_EQ(result, -1234567890123LL);
+        }
+
+#ifdef __SIZEOF_INT128__
+        TEST_CASE("128-bit integers can be parsed")
+        {
+            const auto result0 = parse_str<detail::uint128_t>("340282366920938463463374607431768211455");
+            CHECK(result0 == ~detail::uint128_t{ 0 });
+
+            const auto result1 = parse_str<detail::int128_t>("-170141183460469231731687303715884105728");
+            CHECK(result1 == -static_cast<detail::int128_t>(~detail::uint128_t{ 0 } >> 1U) - 1);
+
+            const std::string too_large = "340282366920938463463374607431768211456";
+            REQUIRE_THROWS_AS(std::ignore = parse_str<detail::uint128_t>(too_large), parse_cast_error);
+        }
+#endif
+    }
+
+    TEST_SUITE("parse_cast_batch")
+    {
+        TEST_CASE("Fixed-width fields can be parsed")
+        {
+            // 40 fields so both the SIMD loop and the scalar tail are used
+            std::string text;
+            std::vector<std::int32_t> expected;
+            for (int idx = 0; idx < 40; ++idx)
+            {
+                const int value = (idx % 3 == 0 ? -1 : 1) * idx * 12345;
+                std::string field = std::to_string(value);
+                text += std::string(10 - field.size(), idx % 2 == 0 ? ' ' : '0').append(field);
+                expected.push_back(value);
+            }
+            // Zero padding cannot precede a sign
+            for (std::size_t idx = 0; idx < expected.size(); ++idx)
+            {
+                if (expected[idx] < 0 && idx % 2 != 0)
+                {
+                    text.replace(idx * 10, 10, std::string(10 - std::to_string(expected[idx]).size(), ' ')
+                                                   + std::to_string(expected[idx]));
+                }
+            }
+
+            std::vector<std::int32_t> output(expected.size());
+            parse_cast_batch_checked(text.data(), 10, expected.size(), output.data());
+            CHECK_EQ(output, expected);
+
+            std::vector<std::int32_t> unchecked(expected.size());
+            parse_cast_batch_unchecked(text.data(), 10, expected.size(), unchecked.data());
+            CHECK_EQ(unchecked, expected);
+        }
+
+        TEST_CASE("Bad fixed-width fields report their index")
+        {
+            std::string text = "   1   2   3   4   5   6 1x3   8";
+            std::vector<std::int16_t> output(8);
+
+            const std::string message =
+                failure_message([&] { parse_cast_batch_checked(text.data(), 4, 8, output.data()); });
+            CHECK_NE(std::strstr(message.c_str(), "parse_cast failed: field at index 6"), nullptr);
+
+            text = "0001 999 300";
+            std::vector<std::uint8_t> bytes(3);
+            REQUIRE_THROWS_AS(parse_cast_batch_checked(text.data(), 4, 3, bytes.data()), parse_cast_error);
+            REQUIRE_THROWS_AS(parse_cast_batch_checked("  1 2 3 ", 2, 4, bytes.data()), parse_cast_error);
+        }
+
+        TEST_CASE("Delimited fields can be parsed")
+        {
+            std::string text;
+            std::vector<std::int64_t> expected;
+            for (int idx = 0; idx < 50; ++idx)
+            {
+                const std::int64_t value = (idx % 2 == 0 ? -1 : 1) * static_cast<std::int64_t>(idx) * 987654321LL;
+                text += (idx == 0 ? "" : ",") + std::to_string(value);
+                expected.push_back(value);
+            }
+            text += ",12345678901234567"; // longer than a SIMD register
+            expected.push_back(12345678901234567LL);
+
+            std::vector<std::int64_t> output(expected.size());
+            const std::size_t count = parse_cast_batch_checked(
+                text.data(), text.data() + text.size(), ',', output.data(), output.size());
+            CHECK_EQ(count, expected.size());
+            CHECK_EQ(output, expected);
+
+            std::vector<std::int64_t> unchecked(expected.size());
+            const std::size_t unchecked_count = parse_cast_batch_unchecked(
+                text.data(), text.data() + text.size(), ',', unchecked.data(), unchecked.size());
+            CHECK_EQ(unchecked_count, expected.size());
+            CHECK_EQ(unchecked, expected);
+        }
+
+        TEST_CASE("Bad delimited fields are rejected")
+        {
+            std::vector<std::int16_t> output(8);
+            const auto parse_text = [&](const std::string& text)
+            { return parse_cast_batch_checked(text.data(), text.data() + text.size(), ';', output.data(), 8); };
+
+            CHECK_EQ(parse_text(""), 0);
+            CHECK_EQ(parse_text("7"), 1);
+            REQUIRE_THROWS_AS(std::ignore = parse_text("1;;2;3;4;5;6;7;8;9;10;11;12;13;14"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_text("1;2;40000;3;4;5;6;7;8;9;10;11;12;13"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_text("1;2;"), parse_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = parse_text("1;2;3;4;5;6;7;8;9"), parse_cast_error);
+        }
+    }
+} //namespace tests
+} //namespace casts
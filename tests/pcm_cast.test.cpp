@@ -0,0 +1,271 @@
+#include "better_casts/pcm_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        auto pcm24(std::int32_t val) -> pcm24_t
+        {
+            const auto bits = static_cast<std::uint32_t>(val);
+            return pcm24_t{ { static_cast<std::uint8_t>(bits), static_cast<std::uint8_t>(bits >> 8U),
+                static_cast<std::uint8_t>(bits >> 16U) } };
+        }
+
+        auto value_of(pcm24_t sample) -> std::int32_t
+        {
+            // Exact: every 24-bit sample is a double, and the scale is a power of two
+            return static_cast<std::int32_t>(pcm_cast<double>(sample) * 8388608.0);
+        }
+
+        auto value_of(std::int16_t sample) -> std::int32_t
+        {
+            return sample;
+        }
+
+        auto value_of(std::int32_t sample) -> std::int32_t
+        {
+            return sample;
+        }
+
+        /// Test signal: a ramp through full scale, past both clipping points, with a NaN-free mix of fractions.
+        template<typename F>
+        auto signal(std::size_t count) -> std::vector<F>
+        {
+            std::vector<F> values(count);
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                values[idx] = static_cast<F>(-1.25 + 2.5 * static_cast<double>(idx) / static_cast<double>(count));
+            }
+
+            return values;
+        }
+
+        std::uint64_t test_rng_state = 0;
+
+        auto test_rng() -> std::uint64_t
+        {
+            test_rng_state += 0x9E3779B97F4A7C15ULL;
+            return test_rng_state;
+        }
+    } // namespace
+
+    TEST_SUITE("pcm_cast")
+    {
+        TEST_CASE("Full scale maps onto the sample range")
+        {
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(0.5F), std::int16_t{ 16384 });
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(-1.0F), std::int16_t{ -32768 });
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(1.0F), std::int16_t{ 32767 });
+            CHECK_EQ(pcm_cast_checked<std::int32_t>(-1.0), std::numeric_limits<std::int32_t>::min());
+            CHECK_EQ(pcm_cast_checked<std::int32_t>(1.0), std::numeric_limits<std::int32_t>::max());
+            CHECK_EQ(value_of(pcm_cast_checked<pcm24_t>(-0.5)), -4194304);
+            CHECK_EQ(value_of(pcm_cast_checked<pcm24_t>(1.0)), 8388607);
+        }
+
+        TEST_CASE("Values are rounded to nearest, ties to even")
+        {
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(2.5 / 32768.0), std::int16_t{ 2 });
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(3.5 / 32768.0), std::int16_t{ 4 });
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(-2.6 / 32768.0), std::int16_t{ -3 });
+        }
+
+        TEST_CASE("Loud values are clipped")
+        {
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(3.0F), std::int16_t{ 32767 });
+            CHECK_EQ(pcm_cast_checked<std::int16_t>(-std::numeric_limits<float>::infinity()), std::int16_t{ -32768 });
+
+            // 2^31 - 1 is not a float, so float saturates to the largest float below it
+            CHECK_EQ(pcm_cast_checked<std::int32_t>(2.0F), std::int32_t{ 2147483520 });
+            CHECK_EQ(value_of(pcm_cast_checked<pcm24_t>(-7.0F)), -8388608);
+        }
+
+        TEST_CASE("NaN is an error when checked and silence when unchecked")
+        {
+            REQUIRE_THROWS_AS(std::ignore = pcm_cast_checked<std::int16_t>(std::numeric_limits<float>::quiet_NaN()),
+                float_cast_error);
+            CHECK_EQ(pcm_cast_unchecked<std::int16_t>(std::numeric_limits<float>::quiet_NaN()), std::int16_t{ 0 });
+        }
+
+        TEST_CASE("Samples convert back to [-1, 1)")
+        {
+            CHECK_EQ(pcm_cast<float>(std::int16_t{ -32768 }), -1.0F);
+            CHECK_EQ(pcm_cast<float>(std::int16_t{ 16384 }), 0.5F);
+            CHECK_EQ(pcm_cast<double>(pcm24(-1)), -1.0 / 8388608.0);
+            CHECK_EQ(pcm_cast<double>(pcm24(8388607)), 8388607.0 / 8388608.0);
+            CHECK_EQ(pcm_cast<double>(std::int32_t{ 1 << 30 }), 0.5);
+        }
+
+        TEST_CASE("Samples round trip")
+        {
+            for (std::int32_t val = -8388608; val < 8388608; val += 997)
+            {
+                CHECK_EQ(value_of(pcm_cast<pcm24_t>(pcm_cast<float>(pcm24(val)))), val);
+            }
+
+            for (std::int32_t val = -32768; val < 32768; val += 7)
+            {
+                const auto sample = static_cast<std::int16_t>(val);
+                CHECK_EQ(pcm_cast<std::int16_t>(pcm_cast<float>(sample)), sample);
+            }
+        }
+
+        TEST_CASE("TPDF dither stays within one LSB and averages out")
+        {
+            const double val = 100.3 / 32768.0;
+            double sum = 0.0;
+
+            for (int idx = 0; idx < 4000; ++idx)
+            {
+                const std::int16_t sample = pcm_cast_checked<std::int16_t>(val, pcm_dither::tpdf);
+
+                CHECK_GE(sample, 99);
+                CHECK_LE(sample, 102);
+                sum += sample;
+            }
+
+            CHECK(std::fabs(sum / 4000.0 - 100.3) < 0.1);
+        }
+    }
+
+    TEST_SUITE("pcm_cast_batch")
+    {
+        TEST_CASE_TEMPLATE("Batch matches the scalar cast", T, std::int16_t, pcm24_t, std::int32_t)
+        {
+            // Odd sizes leave a scalar tail after the vector blocks
+            const std::vector<float> floats = signal<float>(1003);
+            const std::vector<double> doubles = signal<double>(1001);
+            std::vector<T> from_floats(floats.size());
+            std::vector<T> from_doubles(doubles.size());
+
+            pcm_cast_batch_checked(floats.data(), floats.size(), from_floats.data());
+            pcm_cast_batch_checked(doubles.data(), doubles.size(), from_doubles.data());
+
+            for (std::size_t idx = 0; idx < floats.size(); ++idx)
+            {
+                CHECK_EQ(value_of(from_floats[idx]), value_of(pcm_cast_unchecked<T>(floats[idx])));
+            }
+
+            for (std::size_t idx = 0; idx < doubles.size(); ++idx)
+            {
+                CHECK_EQ(value_of(from_doubles[idx]), value_of(pcm_cast_unchecked<T>(doubles[idx])));
+            }
+
+            std::vector<float> back(from_floats.size());
+            pcm_cast_batch(from_floats.data(), from_floats.size(), back.data());
+
+            for (std::size_t idx = 0; idx < back.size(); ++idx)
+            {
+                CHECK_EQ(back[idx], pcm_cast<float>(from_floats[idx]));
+            }
+        }
+
+        TEST_CASE("Batch reports the index of a NaN")
+        {
+            std::vector<float> input = signal<float>(40);
+            input[21] = std::numeric_limits<float>::quiet_NaN();
+            std::vector<std::int16_t> output(input.size());
+
+            CHECK_EQ(failure_message([&] { pcm_cast_batch_checked(input.data(), input.size(), output.data()); }),
+                "pcm_cast failed: cannot cast from NaN (input at index 21)");
+
+            pcm_cast_batch_unchecked(input.data(), input.size(), output.data());
+            CHECK_EQ(output[21], 0);
+            CHECK_EQ(output[39], pcm_cast<std::int16_t>(input[39]));
+        }
+
+        TEST_CASE("In place conversion reports the index of a NaN")
+        {
+            std::vector<float> buffer = signal<float>(40);
+            buffer[3] = std::numeric_limits<float>::quiet_NaN();
+            const std::vector<float> input = buffer;
+
+            CHECK_EQ(failure_message(
+                         [&]
+                         {
+                             pcm_cast_batch_checked(static_cast<const float*>(buffer.data()), buffer.size(),
+                                 reinterpret_cast<std::int16_t*>(buffer.data()));
+                         }),
+                "pcm_cast failed: cannot cast from NaN (input at index 3)");
+
+            if (CHECK_CASTS)
+            {
+                const auto in_place = [&]
+                { std::ignore = pcm_cast_in_place<std::int16_t>(buffer.data(), buffer.size()); };
+                CHECK_EQ(failure_message(in_place), "pcm_cast failed: cannot cast from NaN (input at index 3)");
+            }
+
+            // The buffer is left unchanged
+            CHECK(std::memcmp(buffer.data(), input.data(), input.size() * sizeof(float)) == 0);
+        }
+
+        TEST_CASE_TEMPLATE("Buffers convert in place", T, std::int16_t, pcm24_t, std::int32_t)
+        {
+            const std::vector<float> input = signal<float>(77);
+            std::vector<float> buffer = input;
+
+            const T* samples = pcm_cast_in_place<T>(buffer.data(), buffer.size());
+
+            std::vector<T> converted(input.size());
+            std::memcpy(converted.data(), samples, converted.size() * sizeof(T));
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                CHECK_EQ(value_of(converted[idx]), value_of(pcm_cast<T>(input[idx])));
+            }
+
+            // And back, widening from the start of the same buffer
+            pcm_cast_batch(reinterpret_cast<const T*>(buffer.data()), buffer.size(), buffer.data());
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                CHECK_EQ(buffer[idx], pcm_cast<float>(converted[idx]));
+            }
+        }
+
+        TEST_CASE("Dither is reproducible with an installed generator")
+        {
+            const std::vector<float> input = signal<float>(50);
+            std::vector<std::int16_t> first(input.size());
+            std::vector<std::int16_t> second(input.size());
+
+            const stochastic_rng previous = set_stochastic_rng(&test_rng);
+
+            test_rng_state = 0;
+            pcm_cast_batch(input.data(), input.size(), first.data(), pcm_dither::tpdf);
+            test_rng_state = 0;
+            pcm_cast_batch(input.data(), input.size(), second.data(), pcm_dither::tpdf);
+
+            set_stochastic_rng(previous);
+
+            CHECK_EQ(first, second);
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                CHECK_LE(std::abs(first[idx] - pcm_cast<std::int16_t>(input[idx])), 1);
+            }
+        }
+    }
+} //namespace tests
+} //namespace casts
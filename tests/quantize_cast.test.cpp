@@ -0,0 +1,204 @@
+#include "better_casts/quantize_cast.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    TEST_SUITE("quantize_cast_checked")
+    {
+        TEST_CASE("Value can be quantized to int8")
+        {
+            static constexpr quant_params params{ 0.5F, 0 };
+
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(1.0F, params), std::int8_t{ 2 });
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(-1.25F, params), std::int8_t{ -3 });
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(-1.25F, params, float_cast_op::truncate), std::int8_t{ -2 });
+        }
+
+        TEST_CASE("Zero point is applied")
+        {
+            static constexpr quant_params params{ 0.1F, 128 };
+
+            CHECK_EQ(quantize_cast_checked<std::uint8_t>(0.0F, params), std::uint8_t{ 128 });
+            CHECK_EQ(quantize_cast_checked<std::uint8_t>(1.0F, params), std::uint8_t{ 138 });
+            CHECK_EQ(quantize_cast_checked<std::uint8_t>(-1.0F, params), std::uint8_t{ 118 });
+        }
+
+        TEST_CASE("Values are divided by the scale")
+        {
+            // 0.525 / 0.01 is exactly 52.5 in float, while 0.525 * (1 / 0.01) rounds to just below it
+            static constexpr quant_params params{ 0.01F, 0 };
+
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(0.525F, params), std::int8_t{ 53 });
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(-0.525F, params), std::int8_t{ -53 });
+        }
+
+        TEST_CASE("Out of range values saturate")
+        {
+            static constexpr quant_params params{ 0.01F, -10 };
+
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(100.0F, params), std::int8_t{ 127 });
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(-100.0F, params), std::int8_t{ -128 });
+            CHECK_EQ(quantize_cast_checked<std::int8_t>(std::numeric_limits<float>::infinity(), params),
+                std::int8_t{ 127 });
+        }
+
+        TEST_CASE("Cannot quantize NaN or use invalid parameters")
+        {
+            static constexpr quant_params params{ 0.5F, 0 };
+            static constexpr quant_params bad_scale{ 0.0F, 0 };
+            static constexpr quant_params bad_zero_point{ 0.5F, 300 };
+
+            REQUIRE_THROWS_AS(
+                std::ignore = quantize_cast_checked<std::int8_t>(std::numeric_limits<float>::quiet_NaN(), params),
+                float_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = quantize_cast_checked<std::int8_t>(1.0F, bad_scale), float_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = quantize_cast_checked<std::uint8_t>(1.0F, bad_zero_point), float_cast_error);
+        }
+
+        TEST_CASE("Quantized value can be converted back")
+        {
+            static constexpr quant_params params{ 0.25F, 10 };
+
+            CHECK_EQ(dequantize_cast(std::int8_t{ 14 }, params), 1.0F);
+            CHECK_EQ(dequantize_cast<double>(std::uint8_t{ 2 }, params), -2.0);
+        }
+    }
+
+    TEST_SUITE("quantize_cast_batch")
+    {
+        TEST_CASE_TEMPLATE("Batch matches the scalar cast", T, std::int8_t, std::uint8_t, std::int16_t)
+        {
+            static constexpr quant_params params{ 0.037F, std::is_signed<T>::value ? -3 : 120 };
+
+            std::vector<float> input;
+
+            for (int i = -300; i < 300; ++i)
+            {
+                input.push_back(static_cast<float>(i) * 0.0173F);
+            }
+
+            std::vector<T> output(input.size());
+
+            quantize_cast_batch_checked(input.data(), input.size(), output.data(), params);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], quantize_cast_checked<T>(input[i], params));
+            }
+
+            quantize_cast_batch_unchecked(input.data(), input.size(), output.data(), params, float_cast_op::floor);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], quantize_cast_checked<T>(input[i], params, float_cast_op::floor));
+            }
+
+            quantize_cast_batch_unchecked(input.data(), input.size(), output.data(), params, float_cast_op::round_even);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], quantize_cast_checked<T>(input[i], params, float_cast_op::round_even));
+            }
+        }
+
+        TEST_CASE("Batch divides by the scale at ties")
+        {
+            static constexpr quant_params params{ 0.01F, 0 };
+
+            // Long enough for the vector kernels, with ties in the vector blocks and the scalar tail
+            std::vector<float> input(67, 0.525F);
+            input[40] = -0.525F;
+            std::vector<std::int8_t> output(input.size());
+
+            quantize_cast_batch_checked(input.data(), input.size(), output.data(), params);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                CHECK_EQ(output[i], i == 40 ? std::int8_t{ -53 } : std::int8_t{ 53 });
+            }
+        }
+
+        TEST_CASE("Batch reports NaN")
+        {
+            static constexpr quant_params params{ 0.5F, 0 };
+
+            std::vector<float> input(100, 1.0F);
+            std::vector<std::int8_t> output(input.size());
+
+            input[77] = std::numeric_limits<float>::quiet_NaN();
+            REQUIRE_THROWS_AS(
+                quantize_cast_batch_checked(input.data(), input.size(), output.data(), params), float_cast_error);
+        }
+
+        TEST_CASE("Per-channel parameters are applied to the innermost dimension")
+        {
+            static constexpr quant_params params[]{ { 1.0F, 0 }, { 0.5F, 0 }, { 0.25F, 1 } };
+
+            const std::vector<float> input{ 1.0F, 1.0F, 1.0F, -2.0F, -2.0F, -2.0F };
+            std::vector<std::int8_t> output(input.size());
+
+            quantize_cast_batch_checked(input.data(), input.size(), output.data(), params, 3);
+
+            CHECK_EQ(output[0], 1);
+            CHECK_EQ(output[1], 2);
+            CHECK_EQ(output[2], 5);
+            CHECK_EQ(output[3], -2);
+            CHECK_EQ(output[4], -4);
+            CHECK_EQ(output[5], -7);
+        }
+
+        TEST_CASE("Per-channel counts must be a multiple of the channels")
+        {
+            static constexpr quant_params params[]{ { 1.0F, 0 }, { 0.5F, 0 } };
+
+            const std::vector<float> input{ 1.0F, 1.0F, 1.0F };
+            std::vector<std::int8_t> output(input.size() + 1, 42);
+
+            REQUIRE_THROWS_AS(
+                quantize_cast_batch_checked(input.data(), input.size(), output.data(), params, 2), float_cast_error);
+            REQUIRE_THROWS_AS(
+                quantize_cast_batch_checked(input.data(), input.size(), output.data(), params, 0), float_cast_error);
+
+            // The unchecked version stops at count, with the leading parameters for the partial row
+            quantize_cast_batch_unchecked(input.data(), input.size(), output.data(), params, 2);
+            const std::vector<std::int8_t> expected{ 1, 2, 1, 42 };
+            CHECK_EQ(output, expected);
+
+            quantize_cast_batch_unchecked(input.data(), input.size(), output.data(), params, 0);
+            CHECK_EQ(output, expected);
+        }
+
+        TEST_CASE("Batch can convert quantized values back")
+        {
+            static constexpr quant_params params{ 0.5F, -1 };
+
+            const std::vector<std::int8_t> input{ -1, 0, 1, 127 };
+            std::vector<float> output(input.size());
+
+            dequantize_cast_batch(input.data(), input.size(), output.data(), params);
+
+            CHECK_EQ(output[0], 0.0F);
+            CHECK_EQ(output[1], 0.5F);
+            CHECK_EQ(output[2], 1.0F);
+            CHECK_EQ(output[3], 64.0F);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,110 @@
+#include "better_casts/range_cast.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    static_assert(is_range_castable_v<std::int32_t, std::int64_t>, "Must be able to narrow");
+    static_assert(is_range_castable_v<std::int32_t, std::size_t>, "Must be able to narrow and change sign");
+    static_assert(is_range_castable_v<std::uint8_t, std::int16_t>, "Must be able to narrow to unsigned");
+    static_assert(!is_range_castable_v<std::int32_t, double>, "Must not be able to cast floating point");
+    static_assert(!is_range_castable_v<bool, std::int32_t>, "Must not be able to cast to bool");
+    static_assert(
+        !std::is_constructible<range_view<std::int16_t, std::int64_t>, const std::int64_t*, std::size_t>::value,
+        "Views must only be created by range_cast");
+
+    TEST_SUITE("range_cast")
+    {
+        TEST_CASE("Validated ranges can be read as the target type")
+        {
+            std::vector<std::int64_t> indices(1000);
+            std::iota(indices.begin(), indices.end(), -500);
+
+            const auto view = range_cast_checked<std::int16_t>(indices.data(), indices.size());
+            CHECK_EQ(view.size(), indices.size());
+            CHECK_EQ(view[0], std::int16_t{ -500 });
+            CHECK_EQ(view[999], std::int16_t{ 499 });
+
+            std::int64_t sum = 0;
+            for (const std::int16_t idx : view)
+            {
+                sum += idx;
+            }
+            CHECK_EQ(sum, std::accumulate(indices.begin(), indices.end(), std::int64_t{ 0 }));
+
+            const auto unchecked = range_cast_unchecked<std::int16_t>(span<const std::int64_t>(indices.data(), 10));
+            CHECK_EQ(unchecked[9], std::int16_t{ -491 });
+        }
+
+        TEST_CASE("Out of range elements are rejected")
+        {
+            std::vector<std::int64_t> indices(1000, 7);
+            indices[613] = std::int64_t{ 1 } << 31U;
+
+            REQUIRE_THROWS_AS(
+                std::ignore = range_cast_checked<std::int32_t>(indices.data(), indices.size()), narrow_cast_error);
+
+            indices[613] = -(std::int64_t{ 1 } << 31U);
+            const auto view = range_cast_checked<std::int32_t>(indices.data(), indices.size());
+            CHECK_EQ(view[613], (std::numeric_limits<std::int32_t>::min)());
+
+            indices[613] = -(std::int64_t{ 1 } << 31U) - 1;
+            REQUIRE_THROWS_AS(
+                std::ignore = range_cast_checked<std::int32_t>(indices.data(), indices.size()), narrow_cast_error);
+        }
+
+        TEST_CASE("Sign changes are checked")
+        {
+            const std::vector<std::size_t> sizes{ 1, 2, 2147483647 };
+            const std::vector<std::size_t> too_large{ 2147483648U };
+            const std::vector<std::int32_t> offsets{ 0, 5, -1 };
+
+            const auto view = range_cast_checked<std::int32_t>(span<const std::size_t>(sizes.data(), sizes.size()));
+            CHECK_EQ(view[2], 2147483647);
+
+            REQUIRE_THROWS_AS(std::ignore = range_cast_checked<std::int32_t>(too_large.data(), 1), narrow_cast_error);
+            REQUIRE_THROWS_AS(
+                std::ignore = range_cast_checked<std::uint64_t>(offsets.data(), offsets.size()), narrow_cast_error);
+            CHECK_EQ(range_cast_checked<std::uint64_t>(offsets.data(), 2)[1], 5U);
+        }
+
+        TEST_CASE("Spans of mutable elements can be cast")
+        {
+            std::vector<std::int64_t> indices{ 3, -4, 5 };
+            const span<std::int64_t> elements(indices.data(), indices.size());
+
+            const range_view<std::int8_t, std::int64_t> checked = range_cast_checked<std::int8_t>(elements);
+            const range_view<std::int8_t, std::int64_t> unchecked = range_cast_unchecked<std::int8_t>(elements);
+            const range_view<std::int8_t, std::int64_t> dispatched = range_cast<std::int8_t>(elements);
+
+            CHECK_EQ(checked[1], std::int8_t{ -4 });
+            CHECK_EQ(unchecked[2], std::int8_t{ 5 });
+            CHECK_EQ(dispatched.size(), indices.size());
+        }
+
+        TEST_CASE("Empty ranges are valid")
+        {
+            const auto view = range_cast_checked<std::int8_t>(static_cast<const std::int64_t*>(nullptr), 0);
+            CHECK(view.empty());
+            CHECK(view.begin() == view.end());
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -10,6 +10,7 @@
 #endif
 
 #include <cstdint>
+#include <limits>
 #include <tuple>
 
 namespace casts
@@ -47,6 +48,34 @@ namespace tests
             const auto result = sign_cast_checked<std::int16_t>(test_val);
             CHECK_EQ(expected, result);
         }
+
+#ifdef __SIZEOF_INT128__
+        TEST_CASE("128-bit integers can change sign")
+        {
+            __extension__ using int128_t = __int128;
+            __extension__ using uint128_t = unsigned __int128;
+
+            static constexpr std::uint64_t test_val0 = (std::numeric_limits<std::uint64_t>::max)();
+            CHECK(sign_cast_checked<int128_t>(test_val0) == int128_t{ test_val0 });
+
+            static constexpr int128_t test_val1 = -1;
+            REQUIRE_THROWS_AS(std::ignore = sign_cast_checked<uint128_t>(test_val1), sign_cast_error);
+
+            static constexpr uint128_t test_val2 = uint128_t{ 1 } << 127;
+            REQUIRE_THROWS_AS(std::ignore = sign_cast_checked<int128_t>(test_val2), sign_cast_error);
+            CHECK(sign_cast_checked<int128_t>(test_val2 - 1) == (std::numeric_limits<int128_t>::max)());
+        }
+#endif
+    }
+
+    TEST_SUITE("sign_cast_unchecked")
+    {
+        TEST_CASE("Variables can be cast")
+        {
+            const std::int32_t test_val = -1;
+
+            CHECK_EQ(sign_cast_unchecked<std::uint32_t>(test_val), (std::numeric_limits<std::uint32_t>::max)());
+        }
     }
 } //namespace tests
 } //namespace casts
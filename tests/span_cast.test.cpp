@@ -0,0 +1,102 @@
+#include "better_casts/span_cast.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        struct record
+        {
+            std::uint32_t id;
+            float value;
+        };
+
+        alignas(record) unsigned char buffer[3 * sizeof(record)] = {};
+    } // namespace
+
+    static_assert(is_span_castable_v<record, unsigned char>, "Must be able to view bytes as a struct");
+    static_assert(is_span_castable_v<const record, const char>, "Must be able to view const bytes as a const struct");
+    static_assert(is_span_castable_v<const std::uint32_t, const void>, "Must be able to view void as integers");
+    static_assert(!is_span_castable_v<record, const unsigned char>, "Must not be able to drop const");
+    static_assert(!is_span_castable_v<std::string, unsigned char>, "Must not view non-trivially copyable types");
+    static_assert(!is_span_castable_v<record, std::uint16_t>, "Must only view byte buffers");
+
+    TEST_SUITE("span_cast")
+    {
+        TEST_CASE("Aligned buffers can be viewed")
+        {
+            const auto records = span_cast<record>(buffer, sizeof(buffer));
+            CHECK_EQ(records.size(), 3);
+            CHECK_EQ(records.size_bytes(), sizeof(buffer));
+            CHECK_EQ(void_cast<void*>(records.data()), void_cast<void*>(&buffer[0]));
+
+            records[1].id = 42;
+            records[1].value = 1.5F;
+
+            const span<const unsigned char> bytes(buffer);
+            const auto const_records = span_cast_checked<const record>(bytes);
+            CHECK_EQ(const_records[1].id, 42U);
+            CHECK_EQ(const_records[1].value, 1.5F);
+
+            std::size_t count = 0;
+            for (const auto& rec : const_records)
+            {
+                std::ignore = rec;
+                ++count;
+            }
+            CHECK_EQ(count, 3);
+        }
+
+        TEST_CASE("Empty buffers produce empty views")
+        {
+            const auto result0 = span_cast_checked<record>(static_cast<unsigned char*>(nullptr), 0);
+            CHECK(result0.empty());
+
+            const auto result1 = span_cast_checked<const record>(span<const char>{});
+            CHECK(result1.empty());
+        }
+
+        TEST_CASE("Misaligned buffers are rejected")
+        {
+            REQUIRE_THROWS_AS(std::ignore = span_cast_checked<record>(buffer + 1, sizeof(record)), span_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = span_cast_checked<std::uint32_t>(buffer + 2, 4), span_cast_error);
+
+            const auto result = span_cast_checked<std::uint16_t>(buffer + 2, 4);
+            CHECK_EQ(result.size(), 2);
+        }
+
+        TEST_CASE("Partial elements are rejected")
+        {
+            REQUIRE_THROWS_AS(std::ignore = span_cast_checked<record>(buffer, sizeof(record) + 1), span_cast_error);
+            REQUIRE_THROWS_AS(std::ignore = span_cast_checked<std::uint32_t>(buffer, 6), span_cast_error);
+        }
+
+        TEST_CASE("Null buffers with a size are rejected")
+        {
+            REQUIRE_THROWS_AS(
+                std::ignore = span_cast_checked<record>(static_cast<unsigned char*>(nullptr), 8), span_cast_error);
+        }
+
+        TEST_CASE("Unchecked casts drop trailing bytes")
+        {
+            const auto result = span_cast_unchecked<record>(buffer, sizeof(record) + 3);
+            CHECK_EQ(result.size(), 1);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,179 @@
+#include "better_casts/stream_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        /// Pushes the bytes of @p input in chunks of the sizes in @p chunks (repeated), starting one byte into a buffer
+        /// so most chunks are misaligned.
+        template<typename Converter, typename From>
+        void push_chunks(Converter& converter, const std::vector<From>& input, const std::vector<std::size_t>& chunks)
+        {
+            std::vector<unsigned char> bytes(input.size() * sizeof(From) + 1);
+            std::copy_n(reinterpret_cast<const unsigned char*>(input.data()), input.size() * sizeof(From),
+                bytes.data() + 1);
+
+            std::size_t offset = 1;
+            for (std::size_t idx = 0; offset < bytes.size(); ++idx)
+            {
+                const std::size_t size = (std::min)(chunks[idx % chunks.size()], bytes.size() - offset);
+                converter.push(bytes.data() + offset, size);
+                offset += size;
+            }
+
+            converter.finish();
+        }
+    } // namespace
+
+    TEST_SUITE("stream_converter")
+    {
+        TEST_CASE("Chunks of any size produce the batch result")
+        {
+            std::vector<std::int64_t> input(1000);
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                input[idx] = static_cast<std::int64_t>(idx * 7919 % 60000) - 30000;
+            }
+
+            const std::vector<std::vector<std::size_t>> chunkings = {
+                { 1 }, { 3, 5, 7 }, { 8 }, { 513 }, { 4096 }, { 100000 }
+            };
+
+            for (const auto& chunks : chunkings)
+            {
+                std::vector<std::int16_t> output;
+                std::size_t calls = 0;
+
+                stream_converter<std::int16_t, std::int64_t, stream_family::narrow_cast> converter(
+                    [&](const std::int16_t* data, std::size_t count)
+                    {
+                        output.insert(output.end(), data, data + count);
+                        ++calls;
+                    },
+                    {}, 200);
+                push_chunks(converter, input, chunks);
+
+                REQUIRE_EQ(output.size(), input.size());
+                for (std::size_t idx = 0; idx < input.size(); ++idx)
+                {
+                    REQUIRE_EQ(output[idx], narrow_cast_checked<std::int16_t>(input[idx]));
+                }
+
+                // 200 is rounded up to 256 elements per buffer
+                CHECK_EQ(calls, 4);
+                CHECK_EQ(converter.converted(), input.size());
+                CHECK_EQ(converter.replaced(), 0);
+            }
+        }
+
+        TEST_CASE("Output alternates between two buffers")
+        {
+            std::vector<const std::uint32_t*> buffers;
+            stream_converter<std::uint32_t, std::int32_t, stream_family::sign_cast> converter(
+                [&](const std::uint32_t* data, std::size_t /*count*/) { buffers.push_back(data); }, {}, 64);
+
+            const std::vector<std::int32_t> input(64 * 5, 42);
+            converter.push(input.data(), input.size());
+            converter.finish();
+
+            REQUIRE_EQ(buffers.size(), 5);
+            CHECK_NE(buffers[0], buffers[1]);
+            CHECK_EQ(buffers[0], buffers[2]);
+            CHECK_EQ(buffers[1], buffers[3]);
+        }
+
+#ifdef __SIZEOF_INT128__
+        TEST_CASE("128-bit integers change sign without truncation")
+        {
+            __extension__ using int128_t = __int128;
+            __extension__ using uint128_t = unsigned __int128;
+
+            std::vector<int128_t> output;
+            stream_converter<int128_t, uint128_t, stream_family::sign_cast, stream_policy::zero> converter(
+                [&](const int128_t* data, std::size_t count) { output.insert(output.end(), data, data + count); });
+
+            // The second value is in range once truncated to 64 bits, only a 128-bit check rejects it
+            const std::vector<uint128_t> input = { uint128_t{ 1 } << 100, uint128_t{ 1 } << 127 };
+            push_chunks(converter, input, { 5 });
+
+            REQUIRE_EQ(output.size(), 2);
+            CHECK(output[0] == int128_t{ 1 } << 100);
+            CHECK(output[1] == 0);
+            CHECK_EQ(converter.replaced(), 1);
+        }
+#endif
+
+        TEST_CASE("Errors report the offset in the stream")
+        {
+            std::vector<double> input(300, 1.5);
+            input[277] = std::numeric_limits<double>::quiet_NaN();
+
+            stream_converter<std::int32_t, double, stream_family::float_cast> converter(
+                [](const std::int32_t* /*data*/, std::size_t /*count*/) {});
+
+            const std::string message = failure_message([&] { push_chunks(converter, input, { 17 }); });
+            CHECK_NE(std::strstr(message.c_str(), "float_cast failed: input at stream element 277 (byte offset 2216)"),
+                nullptr);
+        }
+
+        TEST_CASE("Policies replace values that cannot be cast")
+        {
+            const std::vector<float> input = { 1.5F, -1e10F, 1e10F, std::numeric_limits<float>::quiet_NaN(), -2.5F,
+                std::numeric_limits<float>::infinity() };
+
+            std::vector<std::int32_t> saturated;
+            stream_converter<std::int32_t, float, stream_family::float_cast, stream_policy::saturate,
+                detail::math::float_op_round>
+                saturate([&](const std::int32_t* data, std::size_t count)
+                    { saturated.insert(saturated.end(), data, data + count); });
+            push_chunks(saturate, input, { 5 });
+
+            const std::vector<std::int32_t> expected_saturated = { 2, (std::numeric_limits<std::int32_t>::min)(),
+                (std::numeric_limits<std::int32_t>::max)(), 0, -3, (std::numeric_limits<std::int32_t>::max)() };
+            CHECK_EQ(saturated, expected_saturated);
+            CHECK_EQ(saturate.replaced(), 4);
+
+            std::vector<std::int32_t> zeroed;
+            stream_converter<std::int32_t, float, stream_family::float_cast, stream_policy::zero,
+                detail::math::float_op_floor>
+                zero([&](const std::int32_t* data, std::size_t count)
+                    { zeroed.insert(zeroed.end(), data, data + count); });
+            push_chunks(zero, input, { 3 });
+
+            const std::vector<std::int32_t> expected_zeroed = { 1, 0, 0, 0, -3, 0 };
+            CHECK_EQ(zeroed, expected_zeroed);
+        }
+
+        TEST_CASE("A stream cannot end inside a value")
+        {
+            stream_converter<std::uint8_t, std::uint16_t, stream_family::narrow_cast> converter(
+                [](const std::uint8_t* /*data*/, std::size_t /*count*/) {});
+
+            const unsigned char bytes[] = { 1, 0, 2 };
+            converter.push(bytes, sizeof(bytes));
+            REQUIRE_THROWS_AS(converter.finish(), cast_error);
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,403 @@
+#include "better_casts/struct_cast.hpp"
+#include "failure_message.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        struct wide_point
+        {
+            std::int64_t x;
+            std::int64_t y;
+        };
+
+        struct packed_point
+        {
+            std::int16_t x;
+            std::int16_t y;
+        };
+
+        /// Stores the fields in the opposite order to packed_point.
+        struct flipped_point
+        {
+            std::int16_t y;
+            std::int16_t x;
+        };
+
+        struct wide
+        {
+            std::int64_t id;
+            double value;
+            std::int32_t count;
+            double ratio;
+            wide_point pos;
+        };
+
+        struct packed
+        {
+            std::int16_t id;
+            float value;
+            std::uint32_t count;
+            std::int32_t ratio;
+            packed_point pos;
+        };
+
+        /// A packed wire reading, read back into a wide in-memory reading.
+        struct packed_reading
+        {
+            std::int16_t id;
+            float value;
+        };
+
+        struct wide_reading
+        {
+            std::int64_t id;
+            double value;
+        };
+
+        auto make_wide(std::size_t idx) -> wide
+        {
+            const auto val = static_cast<std::int64_t>(idx);
+            return wide{ val * 3 - 1000, static_cast<double>(val) * 0.25, static_cast<std::int32_t>(val),
+                2.0 * static_cast<double>(val), wide_point{ -val, val * 7 } };
+        }
+
+        auto records(std::size_t count) -> std::vector<wide>
+        {
+            std::vector<wide> result;
+
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                result.push_back(make_wide(idx));
+            }
+
+            return result;
+        }
+
+        auto same(const packed& lhs, const packed& rhs) -> bool
+        {
+            return lhs.id == rhs.id && std::fabs(lhs.value - rhs.value) == 0.0F && lhs.count == rhs.count
+                && lhs.ratio == rhs.ratio && lhs.pos.x == rhs.pos.x && lhs.pos.y == rhs.pos.y;
+        }
+    } // namespace
+} // namespace tests
+
+// Field maps, so the records are also reflected before C++17
+
+template<>
+struct struct_fields<tests::wide_point>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&tests::wide_point::x, &tests::wide_point::y);
+    }
+};
+
+template<>
+struct struct_fields<tests::packed_point>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&tests::packed_point::x, &tests::packed_point::y);
+    }
+};
+
+template<>
+struct struct_fields<tests::flipped_point>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&tests::flipped_point::x, &tests::flipped_point::y);
+    }
+};
+
+template<>
+struct struct_fields<tests::wide>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(
+            &tests::wide::id, &tests::wide::value, &tests::wide::count, &tests::wide::ratio, &tests::wide::pos);
+    }
+};
+
+template<>
+struct struct_fields<tests::packed>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&tests::packed::id, &tests::packed::value, &tests::packed::count,
+            &tests::packed::ratio, &tests::packed::pos);
+    }
+};
+
+template<>
+struct struct_fields<tests::packed_reading>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&tests::packed_reading::id, &tests::packed_reading::value);
+    }
+};
+
+template<>
+struct struct_fields<tests::wide_reading>
+{
+    static constexpr auto members() noexcept
+    {
+        return std::make_tuple(&tests::wide_reading::id, &tests::wide_reading::value);
+    }
+};
+
+namespace tests
+{
+    TEST_SUITE("struct_cast")
+    {
+        TEST_CASE("Each field is casted by its own family")
+        {
+            const wide input{ -1000, 1.5, 7, 42.0, wide_point{ 3, -4 } };
+            const packed result = struct_cast_checked<packed>(input);
+
+            CHECK_EQ(result.id, std::int16_t{ -1000 });
+            CHECK_EQ(result.value, 1.5F);
+            CHECK_EQ(result.count, 7U);
+            CHECK_EQ(result.ratio, 42);
+            CHECK_EQ(result.pos.x, std::int16_t{ 3 });
+            CHECK_EQ(result.pos.y, std::int16_t{ -4 });
+        }
+
+        TEST_CASE("Records are castable only when every field pair is")
+        {
+            static_assert(is_struct_castable_v<packed, wide>, "wide must be castable to packed");
+            static_assert(is_struct_castable_v<packed_point, wide_point>, "points must be castable");
+            static_assert(is_struct_castable_v<wide_reading, packed_reading>, "readings must be castable");
+            // float to double and int16 to int64 widen, but int32 to double is not a cast of any family
+            static_assert(!is_struct_castable_v<wide, packed>, "packed must not be castable to wide");
+            // The field counts differ
+            static_assert(!is_struct_castable_v<packed, wide_point>, "a point must not be castable to packed");
+            static_assert(!is_struct_castable_v<packed, int>, "an int is not a record");
+        }
+
+        TEST_CASE("Floating point fields widen to double")
+        {
+            const packed_reading input{ -300, 0.1F };
+            const auto result = struct_cast_checked<wide_reading>(input);
+
+            CHECK_EQ(result.id, -300);
+            CHECK_EQ(result.value, static_cast<double>(0.1F));
+        }
+
+        TEST_CASE("A field that does not fit throws the error of its family")
+        {
+            wide input{ 40000, 1.5, 7, 42.0, wide_point{ 3, -4 } };
+            REQUIRE_THROWS_AS(std::ignore = struct_cast_checked<packed>(input), narrow_cast_error);
+
+            input.id = 0;
+            input.count = -1;
+            REQUIRE_THROWS_AS(std::ignore = struct_cast_checked<packed>(input), sign_cast_error);
+
+            input.count = 0;
+            input.ratio = std::numeric_limits<double>::quiet_NaN();
+            REQUIRE_THROWS_AS(std::ignore = struct_cast_checked<packed>(input), float_cast_error);
+
+            input.ratio = 0.0;
+            input.pos.y = 1 << 20;
+            CHECK_EQ(failure_message([&] { std::ignore = struct_cast_checked<packed>(input); }),
+                "narrow_cast failed: input exceeded max value for output type");
+
+            input.pos.y = 0;
+            input.value = -1e300;
+            REQUIRE_THROWS_AS(std::ignore = struct_cast_checked<packed>(input), narrow_cast_error);
+        }
+
+        TEST_CASE("Unchecked casts do not check the fields")
+        {
+            const wide input{ 40000, 1.5, 7, 42.0, wide_point{ 3, -4 } };
+            const packed result = struct_cast_unchecked<packed>(input);
+
+            CHECK_EQ(result.id, static_cast<std::int16_t>(40000));
+            CHECK_EQ(result.pos.y, std::int16_t{ -4 });
+        }
+
+        TEST_CASE("A field map decides the order of the fields")
+        {
+            const flipped_point result = struct_cast<flipped_point>(wide_point{ 1, 2 });
+
+            CHECK_EQ(result.x, std::int16_t{ 1 });
+            CHECK_EQ(result.y, std::int16_t{ 2 });
+        }
+
+        TEST_CASE("Records can be casted at compile time")
+        {
+            constexpr packed_point result = struct_cast_checked<packed_point>(wide_point{ 5, -6 });
+            static_assert(result.x == 5 && result.y == -6, "the point must be casted at compile time");
+        }
+
+#ifdef HAS_AGGREGATE_RECORDS
+        TEST_CASE("Aggregates are reflected without a field map")
+        {
+            enum class gain_level : std::int32_t
+            {
+                low = 1,
+                high = 2,
+            };
+
+            struct wide_sample
+            {
+                std::int64_t time;
+                std::int32_t level;
+                double gain;
+                std::uint64_t flags;
+            };
+
+            struct packed_sample
+            {
+                std::int32_t time;
+                gain_level level;
+                std::uint8_t gain;
+                std::uint8_t flags;
+            };
+
+            static_assert(is_struct_castable_v<packed_sample, wide_sample>, "the samples must be castable");
+
+            const auto result = struct_cast_checked<packed_sample>(wide_sample{ 1234567, 2, 200.0, 255 });
+
+            CHECK_EQ(result.time, 1234567);
+            CHECK_EQ(result.level, gain_level::high);
+            CHECK_EQ(result.gain, 200);
+            CHECK_EQ(result.flags, 255);
+
+            REQUIRE_THROWS_AS(
+                std::ignore = struct_cast_checked<packed_sample>(wide_sample{ 0, 1, 256.0, 0 }), float_cast_error);
+        }
+#endif
+    }
+
+    TEST_SUITE("struct_cast_batch")
+    {
+        TEST_CASE("Batch matches the scalar cast")
+        {
+            const std::vector<wide> input = records(301);
+            std::vector<packed> output(input.size());
+
+            struct_cast_batch(input.data(), input.size(), output.data());
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                CHECK(same(output[idx], struct_cast_checked<packed>(input[idx])));
+            }
+        }
+
+        TEST_CASE("Batch widens floating point fields")
+        {
+            std::vector<packed_reading> input;
+
+            for (std::size_t idx = 0; idx < 37; ++idx)
+            {
+                const auto val = static_cast<std::int16_t>(idx);
+                input.push_back(packed_reading{ static_cast<std::int16_t>(-val), static_cast<float>(val) / 3.0F });
+            }
+
+            std::vector<wide_reading> output(input.size());
+
+            struct_cast_batch_checked(input.data(), input.size(), output.data());
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                CHECK_EQ(output[idx].id, input[idx].id);
+                CHECK_EQ(output[idx].value, static_cast<double>(input[idx].value));
+            }
+        }
+
+        TEST_CASE("Batch reports the field and index of the first failure")
+        {
+            std::vector<wide> input = records(40);
+            std::vector<packed> output(input.size());
+
+            input[31].id = -40000;
+            input[17].pos.y = 40000;
+
+            CHECK_EQ(failure_message([&] { struct_cast_batch_checked(input.data(), input.size(), output.data()); }),
+                "struct_cast failed: field 4.1 of the record at index 17 does not fit the output type");
+
+            input[17].pos.y = 0;
+            REQUIRE_THROWS_AS(struct_cast_batch_checked(input.data(), input.size(), output.data()), narrow_cast_error);
+
+            input[31].id = 0;
+            input[3].count = -3;
+            CHECK_EQ(failure_message([&] { struct_cast_batch_checked(input.data(), input.size(), output.data()); }),
+                "struct_cast failed: field 2 of the record at index 3 does not fit the output type");
+            REQUIRE_THROWS_AS(struct_cast_batch_checked(input.data(), input.size(), output.data()), sign_cast_error);
+
+            struct_cast_batch_unchecked(input.data(), input.size(), output.data());
+            CHECK_EQ(output[3].count, static_cast<std::uint32_t>(-3));
+        }
+
+        TEST_CASE("Records are split into columns")
+        {
+            const std::vector<wide> input = records(257);
+            std::vector<std::int16_t> ids(input.size());
+            std::vector<float> values(input.size());
+            std::vector<std::uint32_t> counts(input.size());
+            std::vector<std::int32_t> ratios(input.size());
+            std::vector<packed_point> positions(input.size());
+
+            struct_cast_batch_soa(
+                input.data(), input.size(), ids.data(), values.data(), counts.data(), ratios.data(), positions.data());
+
+            for (std::size_t idx = 0; idx < input.size(); ++idx)
+            {
+                const packed expected = struct_cast_checked<packed>(input[idx]);
+                const packed columns{ ids[idx], values[idx], counts[idx], ratios[idx], positions[idx] };
+
+                CHECK(same(columns, expected));
+            }
+        }
+
+        TEST_CASE("Columns report the field and index of the first failure")
+        {
+            std::vector<wide> input = records(20);
+            std::vector<std::int16_t> ids(input.size());
+            std::vector<float> values(input.size());
+            std::vector<std::uint32_t> counts(input.size());
+            std::vector<std::int32_t> ratios(input.size());
+            std::vector<packed_point> positions(input.size());
+
+            input[12].ratio = std::numeric_limits<double>::infinity();
+
+            const auto cast = [&]
+            {
+                struct_cast_batch_soa_checked(input.data(), input.size(), ids.data(), values.data(), counts.data(),
+                    ratios.data(), positions.data());
+            };
+
+            CHECK_EQ(failure_message(cast),
+                "struct_cast failed: field 3 of the record at index 12 does not fit the output type");
+            REQUIRE_THROWS_AS(cast(), float_cast_error);
+
+            struct_cast_batch_soa_unchecked(
+                input.data(), input.size(), ids.data(), values.data(), counts.data(), ratios.data(), positions.data());
+            CHECK_EQ(ids[19], std::int16_t{ 19 * 3 - 1000 });
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,100 @@
+#include "better_casts.hpp"
+
+#ifdef __clang__
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#endif
+#include <doctest/doctest.h>
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#endif
+
+#include <memory>
+#include <utility>
+
+namespace casts
+{
+namespace tests
+{
+    namespace
+    {
+        struct base
+        {
+            base() = default;
+            base(const base&) = default;
+            base(base&&) = default;
+            auto operator=(const base&) -> base& = default;
+            auto operator=(base&&) -> base& = default;
+            virtual ~base() = default;
+        };
+
+        struct derived final : base
+        {
+            int value = 5;
+        };
+
+        struct plain_base
+        {
+        };
+
+        struct plain_derived final : plain_base
+        {
+        };
+    } // namespace
+
+    static_assert(is_up_castable_v<std::shared_ptr<base>, std::shared_ptr<derived>>,
+        "Must be able to cast shared_ptr<D> to shared_ptr<B>");
+    static_assert(is_up_castable_v<std::unique_ptr<base>, std::unique_ptr<derived>>,
+        "Must be able to cast unique_ptr<D> to unique_ptr<B>");
+    static_assert(!is_up_castable_v<std::shared_ptr<derived>, std::shared_ptr<base>>,
+        "Must not be able to up_cast to a derived type");
+    static_assert(!is_up_castable_v<std::shared_ptr<base>, std::shared_ptr<const derived>>,
+        "Must not be able to drop const");
+    static_assert(!is_up_castable_v<std::unique_ptr<plain_base>, std::unique_ptr<plain_derived>>,
+        "Must not be able to delete through a base without a virtual destructor");
+    static_assert(!is_up_castable_v<std::unique_ptr<base>, std::unique_ptr<derived>&>,
+        "Must not be able to copy a unique_ptr");
+
+    TEST_SUITE("up_cast")
+    {
+        TEST_CASE("Pointers and references can be cast to a base")
+        {
+            derived obj;
+            derived* const ptr = &obj;
+
+            CHECK_EQ(up_cast<base*>(ptr), &obj);
+            CHECK_EQ(&up_cast<const base&>(static_cast<const derived&>(obj)), &obj);
+        }
+
+        TEST_CASE("Rvalue shared_ptrs are moved without touching the reference count")
+        {
+            auto ptr = std::make_shared<derived>();
+            const auto* const raw = ptr.get();
+
+            const auto result = up_cast<std::shared_ptr<base>>(std::move(ptr));
+            CHECK_EQ(result.get(), raw);
+            CHECK_EQ(result.use_count(), 1);
+            CHECK_EQ(ptr, nullptr); // NOLINT(bugprone-use-after-move)
+        }
+
+        TEST_CASE("Lvalue shared_ptrs share ownership")
+        {
+            const auto ptr = std::make_shared<derived>();
+
+            const auto result = up_cast<std::shared_ptr<base>>(ptr);
+            CHECK_EQ(result.get(), ptr.get());
+            CHECK_EQ(ptr.use_count(), 2);
+        }
+
+        TEST_CASE("unique_ptrs are moved")
+        {
+            auto ptr = std::make_unique<derived>();
+            const auto* const raw = ptr.get();
+
+            const auto result = up_cast<std::unique_ptr<base>>(std::move(ptr));
+            CHECK_EQ(result.get(), raw);
+            CHECK_EQ(ptr, nullptr); // NOLINT(bugprone-use-after-move)
+        }
+    }
+} //namespace tests
+} //namespace casts
@@ -0,0 +1,829 @@
+///@file convert.cpp
+///@author Jackson Harmer
+///@brief Command-line tool converting binary column files between arithmetic types with the better_casts families.
+///@version 0.1.0
+///
+/// The input is memory-mapped and converted in large chunks; the output is written with pwrite (or through a shared
+/// mapping with --mmap-output). Each chunk is converted with the batch kernels of the library (SIMD where available),
+/// and only chunks containing values that do not fit are revisited element by element to apply the failure policy.
+///
+
+#include "better_casts.hpp"
+#include "better_casts/nullable_cast.hpp"
+#include "better_casts/range_cast.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace casts
+{
+namespace tools
+{
+    namespace
+    {
+        enum class column_type
+        {
+            i8,
+            i16,
+            i32,
+            i64,
+            u8,
+            u16,
+            u32,
+            u64,
+            f32,
+            f64,
+        };
+
+        enum class rounding
+        {
+            library_default,
+            ceiling,
+            floor,
+            round,
+            truncate,
+            round_even,
+            round_half_down,
+            stochastic,
+        };
+
+        enum class error_policy
+        {
+            fail,
+            zero,
+            saturate,
+        };
+
+        struct options
+        {
+            column_type from = column_type::i8;
+            column_type to = column_type::i8;
+            rounding op = rounding::library_default;
+            error_policy policy = error_policy::fail;
+            std::size_t chunk_bytes = std::size_t{ 16 } << 20U;
+            bool mmap_output = false;
+            bool sync = false;
+            bool quiet = false;
+            const char* input = nullptr;
+            const char* output = nullptr;
+        };
+
+        /// Thrown for invalid command lines; the usage is printed after the message.
+        class usage_error final : public std::runtime_error
+        {
+        public:
+            using std::runtime_error::runtime_error;
+        };
+
+        /// Thrown when a value does not fit and the failure policy is `fail` (the output has been created by then).
+        class conversion_error final : public std::runtime_error
+        {
+        public:
+            using std::runtime_error::runtime_error;
+        };
+
+        const char* const type_names[] = { "i8", "i16", "i32", "i64", "u8", "u16", "u32", "u64", "f32", "f64" };
+
+        auto parse_type(const std::string& name) -> column_type
+        {
+            for (std::size_t idx = 0; idx < sizeof(type_names) / sizeof(type_names[0]); ++idx)
+            {
+                if (name == type_names[idx])
+                {
+                    return static_cast<column_type>(idx);
+                }
+            }
+
+            throw usage_error("unknown column type '" + name + "'");
+        }
+
+        auto type_name(column_type type) -> const char*
+        {
+            return type_names[static_cast<std::size_t>(type)];
+        }
+
+        auto parse_rounding(const std::string& name) -> rounding
+        {
+            if (name == "ceiling")
+            {
+                return rounding::ceiling;
+            }
+            if (name == "floor")
+            {
+                return rounding::floor;
+            }
+            if (name == "round")
+            {
+                return rounding::round;
+            }
+            if (name == "truncate")
+            {
+                return rounding::truncate;
+            }
+            if (name == "round_even")
+            {
+                return rounding::round_even;
+            }
+            if (name == "round_half_down")
+            {
+                return rounding::round_half_down;
+            }
+            if (name == "stochastic")
+            {
+                return rounding::stochastic;
+            }
+
+            throw usage_error("unknown rounding operation '" + name + "'");
+        }
+
+        auto parse_policy(const std::string& name) -> error_policy
+        {
+            if (name == "fail")
+            {
+                return error_policy::fail;
+            }
+            if (name == "zero")
+            {
+                return error_policy::zero;
+            }
+            if (name == "saturate")
+            {
+                return error_policy::saturate;
+            }
+
+            throw usage_error("unknown failure policy '" + name + "'");
+        }
+
+        auto parse_options(int argc, char** argv) -> options
+        {
+            options opts{};
+            std::vector<const char*> positional;
+
+            for (int idx = 1; idx < argc; ++idx)
+            {
+                const std::string arg = argv[idx];
+                const auto value = [&]() -> std::string
+                {
+                    if (idx + 1 >= argc)
+                    {
+                        throw usage_error("missing value for " + arg);
+                    }
+
+                    return argv[++idx];
+                };
+
+                if (arg == "--op")
+                {
+                    opts.op = parse_rounding(value());
+                }
+                else if (arg == "--on-error")
+                {
+                    opts.policy = parse_policy(value());
+                }
+                else if (arg == "--chunk-mib")
+                {
+                    const std::string mib = value();
+                    char* end = nullptr;
+                    const unsigned long long parsed = std::strtoull(mib.c_str(), &end, 10);
+
+                    if (mib.empty() || *end != '\0' || parsed == 0 || parsed > 4096)
+                    {
+                        throw usage_error("--chunk-mib must be between 1 and 4096");
+                    }
+
+                    opts.chunk_bytes = static_cast<std::size_t>(parsed) << 20U;
+                }
+                else if (arg == "--mmap-output")
+                {
+                    opts.mmap_output = true;
+                }
+                else if (arg == "--sync")
+                {
+                    opts.sync = true;
+                }
+                else if (arg == "--quiet")
+                {
+                    opts.quiet = true;
+                }
+                else if (arg.size() > 1 && arg[0] == '-')
+                {
+                    throw usage_error("unknown option " + arg);
+                }
+                else
+                {
+                    positional.push_back(argv[idx]);
+                }
+            }
+
+            if (positional.size() != 4)
+            {
+                throw usage_error("expected <from> <to> <input> <output>");
+            }
+
+            opts.from = parse_type(positional[0]);
+            opts.to = parse_type(positional[1]);
+            opts.input = positional[2];
+            opts.output = positional[3];
+
+            return opts;
+        }
+
+        void print_usage()
+        {
+            std::fputs("usage: better_casts_convert [options] <from> <to> <input> <output>\n"
+                       "\n"
+                       "Converts a file of native-endian <from> values into a file of <to> values.\n"
+                       "Types: i8 i16 i32 i64 u8 u16 u32 u64 f32 f64\n"
+                       "\n"
+                       "  --op OP                        float to integer rounding (default: library default):\n"
+                       "                                 ceiling floor round truncate\n"
+                       "                                 round_even round_half_down stochastic\n"
+                       "  --on-error fail|zero|saturate  handling of values that do not fit (default: fail)\n"
+                       "  --chunk-mib N                  input converted per step, in MiB (default: 16)\n"
+                       "  --mmap-output                  write through a shared mapping instead of pwrite\n"
+                       "  --sync                         fsync the output before reporting the throughput\n"
+                       "  --quiet                        do not report the throughput\n",
+                stderr);
+        }
+
+        NORETURN void throw_errno(const std::string& what)
+        {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        /// Owns a file descriptor.
+        class file_handle
+        {
+        public:
+            file_handle(const char* path, int flags, mode_t mode = 0) : m_fd(::open(path, flags, mode))
+            {
+                if (m_fd < 0)
+                {
+                    throw_errno(std::string("cannot open ") + path);
+                }
+            }
+
+            file_handle(const file_handle&) = delete;
+            auto operator=(const file_handle&) -> file_handle& = delete;
+
+            ~file_handle() { ::close(m_fd); }
+
+            NODISCARD auto get() const noexcept -> int { return m_fd; }
+
+        private:
+            int m_fd;
+        };
+
+        /// Owns a memory mapping (empty mappings are not mapped at all, as mmap rejects a length of zero).
+        class mapping
+        {
+        public:
+            mapping(int fd, std::size_t size, int prot) : m_data(nullptr), m_size(size)
+            {
+                if (m_size == 0)
+                {
+                    return;
+                }
+
+                m_data = ::mmap(nullptr, m_size, prot, MAP_SHARED, fd, 0);
+                if (m_data == MAP_FAILED)
+                {
+                    throw_errno("mmap failed");
+                }
+
+                ::madvise(m_data, m_size, MADV_SEQUENTIAL);
+            }
+
+            mapping(const mapping&) = delete;
+            auto operator=(const mapping&) -> mapping& = delete;
+
+            ~mapping()
+            {
+                if (m_data != nullptr)
+                {
+                    ::munmap(m_data, m_size);
+                }
+            }
+
+            NODISCARD auto data() const noexcept -> void* { return m_data; }
+
+        private:
+            void* m_data;
+            std::size_t m_size;
+        };
+
+        /// Output file written either through a shared mapping or with pwrite from a reusable chunk buffer.
+        class output_file
+        {
+        public:
+            output_file(const char* path, std::size_t size, std::size_t chunk_bytes, bool mapped) :
+                m_file(path, O_RDWR | O_CREAT | O_TRUNC, 0644),
+                m_map(resize(m_file.get(), size), mapped ? size : 0, PROT_READ | PROT_WRITE),
+                m_buffer(mapped ? nullptr : new unsigned char[chunk_bytes])
+            {
+            }
+
+            /// Storage for the chunk of output starting at byte @p offset.
+            NODISCARD auto chunk(std::size_t offset) const noexcept -> void*
+            {
+                return m_buffer ? static_cast<void*>(m_buffer.get())
+                                : static_cast<void*>(static_cast<unsigned char*>(m_map.data()) + offset);
+            }
+
+            /// Writes a chunk returned by chunk() to the file (nothing to do for a mapping).
+            void commit(std::size_t offset, std::size_t bytes) const
+            {
+                if (!m_buffer)
+                {
+                    return;
+                }
+
+                const unsigned char* data = m_buffer.get();
+                while (bytes != 0)
+                {
+                    const ::ssize_t written = ::pwrite(m_file.get(), data, bytes, static_cast<::off_t>(offset));
+                    if (written < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+
+                        throw_errno("pwrite failed");
+                    }
+
+                    data += written;
+                    offset += static_cast<std::size_t>(written);
+                    bytes -= static_cast<std::size_t>(written);
+                }
+            }
+
+            void sync() const
+            {
+                if (::fsync(m_file.get()) != 0)
+                {
+                    throw_errno("fsync failed");
+                }
+            }
+
+        private:
+            /// Sizes the file up front: a mapping needs the full size, and pwrite then never extends the file.
+            static auto resize(int fd, std::size_t size) -> int
+            {
+                if (::ftruncate(fd, static_cast<::off_t>(size)) != 0)
+                {
+                    throw_errno("ftruncate failed");
+                }
+
+                return fd;
+            }
+
+            file_handle m_file;
+            mapping m_map;
+            std::unique_ptr<unsigned char[]> m_buffer;
+        };
+
+        template<typename From>
+        auto describe(From val) -> std::string
+        {
+            return std::to_string(val);
+        }
+
+        /// Writes the value stored for an element that does not fit, or throws for the `fail` policy.
+        template<typename To, typename From>
+        auto replacement(From val, std::size_t index, const options& opts) -> To
+        {
+            if (opts.policy == error_policy::fail)
+            {
+                throw conversion_error("element " + std::to_string(index) + " (" + describe(val)
+                    + ") does not fit in " + type_name(opts.to));
+            }
+
+            // NaN is neither below nor above zero
+            if (opts.policy == error_policy::zero || !(val < From{ 0 } || val > From{ 0 }))
+            {
+                return To{ 0 };
+            }
+
+            return val < From{ 0 } ? (std::numeric_limits<To>::lowest)() : (std::numeric_limits<To>::max)();
+        }
+
+        /// Integer to integer (narrow_cast, sign_cast, a sign_cast to a narrower type or widening): the chunk is range
+        /// checked with the vectorized scan of range_cast_checked and copied through the view it returns; only chunks
+        /// that fail the scan are checked per element.
+        template<typename To, typename From>
+        struct integer_family
+        {
+            /// True if every @p From fits in @p To, so range_cast_checked does not scan.
+            static constexpr bool widens = std::numeric_limits<To>::digits >= std::numeric_limits<From>::digits
+                && (std::numeric_limits<To>::is_signed || !std::numeric_limits<From>::is_signed);
+
+            static constexpr const char* name = is_narrow_castable_v<To, From> ? "narrow_cast"
+                : is_sign_castable_v<To, From>                                  ? "sign_cast"
+                : widens                                                        ? "static_cast"
+                                                                                : "sign_cast + narrow_cast";
+
+            auto operator()(const From* input, std::size_t count, To* output, std::size_t first,
+                const options& opts) const -> std::size_t
+            {
+                try
+                {
+                    const range_view<To, From> view = range_cast_checked<To>(input, count);
+
+                    for (std::size_t idx = 0; idx < count; ++idx)
+                    {
+                        output[idx] = view[idx];
+                    }
+
+                    return 0;
+                }
+                catch (const narrow_cast_error&)
+                {
+                    // Checked per element below
+                }
+
+                std::size_t errors = 0;
+                for (std::size_t idx = 0; idx < count; ++idx)
+                {
+                    try
+                    {
+                        output[idx] = range_cast_checked<To>(input + idx, 1)[0];
+                    }
+                    catch (const narrow_cast_error&)
+                    {
+                        output[idx] = replacement<To>(input[idx], first + idx, opts);
+                        ++errors;
+                    }
+                }
+
+                return errors;
+            }
+        };
+
+        /// Floating point to integer (float_cast): the chunk is converted by float_cast_batch_nullable, whose validity
+        /// bitmap locates the elements the failure policy applies to.
+        template<typename To, typename From, typename Op>
+        struct float_family
+        {
+            static constexpr const char* name = "float_cast";
+
+            auto operator()(const From* input, std::size_t count, To* output, std::size_t first,
+                const options& opts) const -> std::size_t
+            {
+                m_validity.resize(validity_bitmap_size(count));
+
+                const std::size_t nulls = float_cast_batch_nullable(input, count, output, m_validity.data(), Op{});
+                if (nulls == 0)
+                {
+                    return 0;
+                }
+
+                for (std::size_t idx = 0; idx < count; ++idx)
+                {
+                    if (!is_valid(m_validity.data(), idx))
+                    {
+                        output[idx] = replacement<To>(input[idx], first + idx, opts);
+                    }
+                }
+
+                return nulls;
+            }
+
+            mutable std::vector<std::uint8_t> m_validity{};
+        };
+
+        /// Floating point to a smaller floating point (narrow_cast): the chunk is range checked without branches like
+        /// narrow_cast_checked (NaN passes through) and copied with a plain loop; only chunks that fail the check are
+        /// checked per element.
+        template<typename To, typename From>
+        struct float_narrow_family
+        {
+            static constexpr const char* name = "narrow_cast";
+
+            static auto fits(From val) noexcept -> bool
+            {
+                constexpr From upper = static_cast<From>((std::numeric_limits<To>::max)());
+                constexpr From lower = static_cast<From>((std::numeric_limits<To>::lowest)());
+
+                return !(val > upper) & !(val < lower);
+            }
+
+            auto operator()(const From* input, std::size_t count, To* output, std::size_t first,
+                const options& opts) const -> std::size_t
+            {
+                unsigned valid = 1;
+                for (std::size_t idx = 0; idx < count; ++idx)
+                {
+                    valid &= static_cast<unsigned>(fits(input[idx]));
+                    output[idx] = static_cast<To>(input[idx]);
+                }
+
+                if (valid != 0)
+                {
+                    return 0;
+                }
+
+                std::size_t errors = 0;
+                for (std::size_t idx = 0; idx < count; ++idx)
+                {
+                    if (!fits(input[idx]))
+                    {
+                        output[idx] = replacement<To>(input[idx], first + idx, opts);
+                        ++errors;
+                    }
+                }
+
+                return errors;
+            }
+        };
+
+        /// Widening between floating point types, which never fails.
+        template<typename To, typename From>
+        struct widen_family
+        {
+            static constexpr const char* name = "static_cast";
+
+            auto operator()(const From* input, std::size_t count, To* output, std::size_t /*first*/,
+                const options& /*opts*/) const -> std::size_t
+            {
+                for (std::size_t idx = 0; idx < count; ++idx)
+                {
+                    output[idx] = static_cast<To>(input[idx]);
+                }
+
+                return 0;
+            }
+        };
+
+        struct report
+        {
+            std::size_t elements;
+            std::size_t errors;
+            const char* family;
+        };
+
+        /// Converts the whole input, one chunk of at most @p opts.chunk_bytes input bytes at a time.
+        template<typename To, typename From, typename Family>
+        auto convert_file(const options& opts, Family family) -> report
+        {
+            const file_handle input_file(opts.input, O_RDONLY);
+
+            struct stat info = {};
+            if (::fstat(input_file.get(), &info) != 0)
+            {
+                throw_errno(std::string("cannot stat ") + opts.input);
+            }
+
+            const auto input_bytes = static_cast<std::size_t>(info.st_size);
+            if (input_bytes % sizeof(From) != 0)
+            {
+                throw std::runtime_error(std::string(opts.input) + " is not a whole number of " + type_name(opts.from)
+                    + " values");
+            }
+
+            const std::size_t count = input_bytes / sizeof(From);
+            // Whole bitmap bytes per chunk, so chunk boundaries never split a validity byte
+            const std::size_t chunk_elements = (std::max)(opts.chunk_bytes / sizeof(From) / 8 * 8, std::size_t{ 8 });
+
+#ifdef POSIX_FADV_SEQUENTIAL
+            ::posix_fadvise(input_file.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+            const mapping input_map(input_file.get(), input_bytes, PROT_READ);
+            const auto* input = static_cast<const From*>(input_map.data());
+
+            output_file output(opts.output, count * sizeof(To), chunk_elements * sizeof(To), opts.mmap_output);
+
+            std::size_t errors = 0;
+            for (std::size_t first = 0; first < count; first += chunk_elements)
+            {
+                const std::size_t size = (std::min)(chunk_elements, count - first);
+                auto* chunk = static_cast<To*>(output.chunk(first * sizeof(To)));
+
+                errors += family(input + first, size, chunk, first, opts);
+                output.commit(first * sizeof(To), size * sizeof(To));
+            }
+
+            if (opts.sync)
+            {
+                output.sync();
+            }
+
+            return report{ count, errors, Family::name };
+        }
+
+        template<typename To, typename From, typename Op>
+        auto convert_float(const options& opts, Op /*tag*/) -> report
+        {
+            return convert_file<To, From>(opts, float_family<To, From, Op>{});
+        }
+
+        template<typename To, typename From,
+            std::enable_if_t<detail::is_integer<To>::value && detail::is_integer<From>::value, bool> = true>
+        auto convert(const options& opts) -> report
+        {
+            return convert_file<To, From>(opts, integer_family<To, From>{});
+        }
+
+        template<typename To, typename From, std::enable_if_t<is_float_castable_v<To, From>, bool> = true>
+        auto convert(const options& opts) -> report
+        {
+            switch (opts.op)
+            {
+            case rounding::ceiling:
+                return convert_float<To, From>(opts, float_cast_op::ceiling);
+            case rounding::floor:
+                return convert_float<To, From>(opts, float_cast_op::floor);
+            case rounding::round:
+                return convert_float<To, From>(opts, float_cast_op::round);
+            case rounding::truncate:
+                return convert_float<To, From>(opts, float_cast_op::truncate);
+            case rounding::round_even:
+                return convert_float<To, From>(opts, float_cast_op::round_even);
+            case rounding::round_half_down:
+                return convert_float<To, From>(opts, float_cast_op::round_half_down);
+            case rounding::stochastic:
+                return convert_float<To, From>(opts, float_cast_op::stochastic);
+            case rounding::library_default:
+                break;
+            }
+
+            return convert_float<To, From>(opts, detail::math::float_op_default{});
+        }
+
+        template<typename To, typename From,
+            std::enable_if_t<std::is_floating_point<To>::value && std::is_floating_point<From>::value
+                    && sizeof(To) >= sizeof(From),
+                bool> = true>
+        auto convert(const options& opts) -> report
+        {
+            return convert_file<To, From>(opts, widen_family<To, From>{});
+        }
+
+        template<typename To, typename From,
+            std::enable_if_t<std::is_floating_point<To>::value && std::is_floating_point<From>::value
+                    && sizeof(To) < sizeof(From),
+                bool> = true>
+        auto convert(const options& opts) -> report
+        {
+            return convert_file<To, From>(opts, float_narrow_family<To, From>{});
+        }
+
+        /// Integer to floating point is not a cast family (it silently rounds).
+        template<typename To, typename From,
+            std::enable_if_t<std::is_floating_point<To>::value && detail::is_integer<From>::value, bool> = true>
+        auto convert(const options& opts) -> report
+        {
+            throw usage_error(std::string("no cast family converts ") + type_name(opts.from) + " to "
+                + type_name(opts.to));
+        }
+
+        template<typename From>
+        auto dispatch_to(const options& opts) -> report
+        {
+            switch (opts.to)
+            {
+            case column_type::i8:
+                return convert<std::int8_t, From>(opts);
+            case column_type::i16:
+                return convert<std::int16_t, From>(opts);
+            case column_type::i32:
+                return convert<std::int32_t, From>(opts);
+            case column_type::i64:
+                return convert<std::int64_t, From>(opts);
+            case column_type::u8:
+                return convert<std::uint8_t, From>(opts);
+            case column_type::u16:
+                return convert<std::uint16_t, From>(opts);
+            case column_type::u32:
+                return convert<std::uint32_t, From>(opts);
+            case column_type::u64:
+                return convert<std::uint64_t, From>(opts);
+            case column_type::f32:
+                return convert<float, From>(opts);
+            case column_type::f64:
+                break;
+            }
+
+            return convert<double, From>(opts);
+        }
+
+        auto dispatch(const options& opts) -> report
+        {
+            switch (opts.from)
+            {
+            case column_type::i8:
+                return dispatch_to<std::int8_t>(opts);
+            case column_type::i16:
+                return dispatch_to<std::int16_t>(opts);
+            case column_type::i32:
+                return dispatch_to<std::int32_t>(opts);
+            case column_type::i64:
+                return dispatch_to<std::int64_t>(opts);
+            case column_type::u8:
+                return dispatch_to<std::uint8_t>(opts);
+            case column_type::u16:
+                return dispatch_to<std::uint16_t>(opts);
+            case column_type::u32:
+                return dispatch_to<std::uint32_t>(opts);
+            case column_type::u64:
+                return dispatch_to<std::uint64_t>(opts);
+            case column_type::f32:
+                return dispatch_to<float>(opts);
+            case column_type::f64:
+                break;
+            }
+
+            return dispatch_to<double>(opts);
+        }
+
+        auto element_size(column_type type) -> std::size_t
+        {
+            switch (type)
+            {
+            case column_type::i8:
+            case column_type::u8:
+                return 1;
+            case column_type::i16:
+            case column_type::u16:
+                return 2;
+            case column_type::i32:
+            case column_type::u32:
+            case column_type::f32:
+                return 4;
+            case column_type::i64:
+            case column_type::u64:
+            case column_type::f64:
+                break;
+            }
+
+            return 8;
+        }
+    } // namespace
+} //namespace tools
+} //namespace casts
+
+auto main(int argc, char** argv) -> int
+{
+    using namespace casts::tools;
+
+    options opts{};
+    try
+    {
+        opts = parse_options(argc, argv);
+
+        const auto start = std::chrono::steady_clock::now();
+        const report result = dispatch(opts);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (!opts.quiet)
+        {
+            const double mib_in =
+                static_cast<double>(result.elements * element_size(opts.from)) / static_cast<double>(1U << 20U);
+            const double mib_out =
+                static_cast<double>(result.elements * element_size(opts.to)) / static_cast<double>(1U << 20U);
+
+            std::printf("%s %s -> %s: %zu elements, %zu did not fit\n", result.family, type_name(opts.from),
+                type_name(opts.to), result.elements, result.errors);
+            std::printf("%.3f s, %.1f MiB/s read, %.1f MiB/s written, %.1f M elements/s\n", seconds, mib_in / seconds,
+                mib_out / seconds, static_cast<double>(result.elements) / seconds / 1e6);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (const usage_error& err)
+    {
+        std::fprintf(stderr, "better_casts_convert: %s\n\n", err.what());
+        print_usage();
+    }
+    catch (const conversion_error& err)
+    {
+        std::fprintf(stderr, "better_casts_convert: %s\n", err.what());
+        // Do not leave a partially converted file behind
+        ::unlink(opts.output);
+    }
+    catch (const std::exception& err)
+    {
+        std::fprintf(stderr, "better_casts_convert: %s\n", err.what());
+    }
+
+    return EXIT_FAILURE;
+}